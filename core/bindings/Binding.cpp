@@ -2,6 +2,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <map>
 #include <set>
 
 #include "Action.h"
@@ -9,14 +10,21 @@
 #include "ActionGlacierEvolutionDeltaH.h"
 #include "ActionGlacierSnowToIceTransformation.h"
 #include "ActionLandCoverChange.h"
+#include "BasinNetwork.h"
+#include "CatchmentConnectivity.h"
 #include "ContentTypes.h"
+#include "GlacierDeltaH.h"
 #include "Includes.h"
 #include "ModelHydro.h"
 #include "Parameter.h"
 #include "ParameterModifier.h"
+#include "PotentialSolarRadiation.h"
 #include "SettingsBasin.h"
 #include "SettingsModel.h"
+#include "SnowCoverAggregation.h"
+#include "StationSpatialization.h"
 #include "SubBasin.h"
+#include "Tracer.h"
 #include "Utils.h"
 
 namespace py = pybind11;
@@ -170,12 +178,78 @@ PYBIND11_MODULE(_hydrobricks, m) {
     m.def("set_max_log_level", &SetMaxLogLevel, "Set the log level to max (max verbosity).");
     m.def("set_debug_log_level", &SetDebugLogLevel, "Set the log level to debug.");
     m.def("set_message_log_level", &SetMessageLogLevel, "Set the log level to message (standard).");
+    m.def("start_tracing", &Tracer::Start,
+          "Start recording the trace spans of the runs. Requires a profiling build (USE_PROFILING): other builds "
+          "log a warning and write an empty trace. The process id is added to the file name (trace.json becomes "
+          "trace.<pid>.json).",
+          "path"_a, "steps_per_span"_a = 100);
+    m.def("stop_tracing", &Tracer::Stop, "Stop recording the trace spans and write the Chrome trace file.");
+    m.def("get_tracing_path", &Tracer::GetPath, "Get the path of the trace file of this process.");
+    m.def("spatialize_station_data", &SpatializeStationData,
+          "Spatialize a station time series to the hydro units using elevation gradients (time x units).", "data"_a,
+          "months"_a, "elevations"_a, "method"_a, "ref_elevation"_a = 0, "gradients"_a = axd(),
+          "gradients_2"_a = axd(), "elevation_threshold"_a = 0, "clip_negative"_a = false, "threads"_a = 0,
+          py::call_guard<py::gil_scoped_release>());
+
+    m.def("compute_daily_potential_radiation", &ComputeDailyPotentialRadiation,
+          "Compute the daily potential clear-sky direct solar radiation (366 days x cells, row by row).", "dem"_a,
+          "slope"_a, "aspect"_a, "pixel_size"_a, "latitude"_a, "elevation"_a, "atmos_transmissivity"_a = 0.75,
+          "steps_per_hour"_a = 4, "with_cast_shadows"_a = true, "azimuth_sectors"_a = 72, "threads"_a = 0,
+          py::call_guard<py::gil_scoped_release>());
+
+    m.def(
+        "compute_unit_connectivity",
+        [](const axxi& unitMap, const axxd& flowDir, const vecInt& unitIds, const string& routing, const string& mode,
+           bool forceConnectivity, int precision) {
+            SparseMatrixd connectivity =
+                ComputeUnitConnectivity(unitMap, flowDir, unitIds, routing, mode, forceConnectivity, precision);
+            vector<std::map<int, double>> connections(unitIds.size());
+            for (int giver = 0; giver < connectivity.outerSize(); ++giver) {
+                for (SparseMatrixd::InnerIterator it(connectivity, giver); it; ++it) {
+                    connections[giver][unitIds[it.col()]] = it.value();
+                }
+            }
+            return connections;
+        },
+        "Compute the lateral connectivity between hydro units from the flow directions (one dict per unit).",
+        "unit_map"_a, "flow_dir"_a, "unit_ids"_a, "routing"_a = "d8", "mode"_a = "multiple",
+        "force_connectivity"_a = false, "precision"_a = 3, py::call_guard<py::gil_scoped_release>());
+
+    m.def(
+        "aggregate_snow_cover",
+        [](const Eigen::Ref<const axxdRowMajor>& grids, const axxi& unitMap, const vecInt& unitIds, double nodata,
+           double validMin, double validMax, double valueScale, double minValidRatio, int threadsNb) {
+            SnowCoverAggregates aggregates = AggregateSnowCover(grids, unitMap, unitIds, nodata, validMin, validMax,
+                                                                valueScale, minValidRatio, threadsNb);
+            return std::pair{aggregates.coverFraction, aggregates.validFraction};
+        },
+        "Aggregate a stack of snow cover grids (time x cells) to the hydro units (cover and valid-pixel fractions).",
+        "grids"_a, "unit_map"_a, "unit_ids"_a, "nodata"_a = NAN_D, "valid_min"_a = NAN_D, "valid_max"_a = NAN_D,
+        "value_scale"_a = 1.0, "min_valid_ratio"_a = 0.0, "threads"_a = 0, py::call_guard<py::gil_scoped_release>());
+
+    m.def(
+        "aggregate_snow_cover_files",
+        [](const vecStr& paths, const string& varName, const axxi& unitMap, const vecInt& unitIds, double nodata,
+           double validMin, double validMax, double valueScale, double minValidRatio, int threadsNb) {
+            SnowCoverAggregates aggregates = AggregateSnowCoverFiles(paths, varName, unitMap, unitIds, nodata, validMin,
+                                                                     validMax, valueScale, minValidRatio, threadsNb);
+            return std::pair{aggregates.coverFraction, aggregates.validFraction};
+        },
+        "Read snow cover grids from netCDF/HDF5 files and aggregate them to the hydro units.", "paths"_a,
+        "var_name"_a, "unit_map"_a, "unit_ids"_a, "nodata"_a = NAN_D, "valid_min"_a = NAN_D, "valid_max"_a = NAN_D,
+        "value_scale"_a = 1.0, "min_valid_ratio"_a = 0.0, "threads"_a = 0, py::call_guard<py::gil_scoped_release>());
 
     py::class_<SettingsModel>(m, "SettingsModel")
         .def(py::init<>())
         .def("log_all", &SettingsModel::SetLogAll, "Logging all components.", "log_all"_a = true)
         .def("record_fractions", &SettingsModel::SetRecordFractions,
              "Record the land-cover fractions over time (selective recording).", "record"_a = true)
+        .def("set_hydro_unit_log_period", &SettingsModel::SetHydroUnitLogPeriod,
+             "Set the recording period of the hydro unit values ('step', 'day', 'month' or 'year').", "period"_a)
+        .def("set_log_aggregation", &SettingsModel::SetLogAggregation,
+             "Set the aggregation of a logged hydro unit value over its recording period ('sum', 'mean', 'last', "
+             "'min' or 'max').",
+             "label"_a, "aggregation"_a)
         .def("add_logging_to", &SettingsModel::AddLoggingToItem, "Add logging to the item.", "name"_a)
         .def("add_brick_logging", static_cast<void (SettingsModel::*)(const string&)>(&SettingsModel::AddBrickLogging),
              "Add logging of an item (e.g. a state) to the selected brick.", "name"_a)
@@ -186,8 +260,17 @@ PYBIND11_MODULE(_hydrobricks, m) {
         .def("add_structure", &SettingsModel::AddStructure,
              "Add a new (empty) model-structure variant and select it. Returns its id.")
         .def("set_solver", &SettingsModel::SetSolver, "Set the solver.", "name"_a)
+        .def("set_process_kernels", &SettingsModel::SetProcessKernels,
+             "Enable or disable the process kernels (grouped rate evaluation).", "enable"_a)
+        .def("set_parameter_trajectories", &SettingsModel::SetParameterTrajectories,
+             "Enable or disable the precomputation of the modified parameter values per time step.", "enable"_a)
+        .def("set_build_threads", &SettingsModel::SetBuildThreads,
+             "Set the number of threads building the hydro units (0: hardware concurrency).", "threads_nb"_a)
         .def("set_timer", &SettingsModel::SetTimer, "Set the modelling time properties.", "start_date"_a, "end_date"_a,
              "time_step"_a, "time_step_unit"_a)
+        .def("set_pet_method", &SettingsModel::SetPETMethod,
+             "Compute the PET natively (Hamon, Oudin, Hargreaves or Priestley-Taylor) from the other forcings.",
+             "method"_a)
         .def("set_spinup_days", &SettingsModel::SetSpinupDays,
              "Set the spin-up duration: the first days of the modelling period are replayed (unlogged) to "
              "initialize the states before the run restarts at the period start.",
@@ -214,6 +297,8 @@ PYBIND11_MODULE(_hydrobricks, m) {
              "Mark the selected brick as computed directly (explicitly, without the ODE solver).")
         .def("set_parameter_value", &SettingsModel::SetParameterValue, "Setting one of the model parameter.",
              "component"_a, "name"_a, "value"_a)
+        .def("set_parameter_modifier", &SettingsModel::SetParameterModifier,
+             "Set a modifier changing the value of a parameter over time.", "component"_a, "name"_a, "modifier"_a)
         .def("generate_precipitation_splitters", &SettingsModel::GeneratePrecipitationSplitters,
              "Generate the precipitation splitters.", "with_snow"_a = true, "splitter_type"_a = "snow_rain:linear")
         .def("generate_snowpacks", &SettingsModel::GenerateSnowpacks, "Generate the snowpack.", "snow_melt_process"_a)
@@ -340,9 +425,49 @@ PYBIND11_MODULE(_hydrobricks, m) {
             py::call_guard<py::gil_scoped_release>(), "Run the model.")
         .def("reset", &ModelHydro::Reset, "Reset the model before another run.")
         .def("save_as_initial_state", &ModelHydro::SaveAsInitialState, "Save the model state as initial conditions.")
+        .def("enable_profiling", &ModelHydro::EnableProfiling,
+             "Enable or disable the profiling of the next runs (requires a build with USE_PROFILING).", "enable"_a = true)
+        .def("reset_profiling", &ModelHydro::ResetProfiling, "Clear the profiling report.")
+        .def(
+            "get_profiling_report",
+            [](const ModelHydro& m) {
+                vecStr categories, names;
+                vector<long long> calls;
+                vecDouble times;
+                for (const ProfilingRecord& record : m.GetProfilingReport()) {
+                    categories.push_back(record.category);
+                    names.push_back(record.name);
+                    calls.push_back(record.calls);
+                    times.push_back(record.time);
+                }
+                py::dict report;
+                report["category"] = categories;
+                report["name"] = names;
+                report["calls"] = calls;
+                report["time"] = times;
+                return report;
+            },
+            "Get the cumulative time [s] and call count of the profiled sections, as table columns.")
+        .def(
+            "get_solver_diagnostics",
+            [](const ModelHydro& m) {
+                const SolverDiagnostics& diagnostics = m.GetSolverDiagnostics();
+                py::dict counters;
+                counters["rate_evaluations"] = diagnostics.rateEvaluations;
+                counters["constraint_sweeps"] = diagnostics.constraintSweeps;
+                counters["sweep_limit_hits"] = diagnostics.sweepLimitHits;
+                counters["bisection_iterations"] = diagnostics.bisectionIterations;
+                counters["clamped_fluxes"] = diagnostics.clampedFluxes;
+                return counters;
+            },
+            "Get the counters of the work done by the solver over the last run.")
         .def("get_outlet_discharge", &ModelHydro::GetOutletDischarge, "Get the outlet discharge.")
-        .def("get_total_outlet_discharge", &ModelHydro::GetTotalOutletDischarge, "Get the outlet discharge total.")
+        .def("get_total_outlet_discharge", &ModelHydro::GetTotalOutletDischarge,
+             "Get the outlet discharge total (including the inflow from upstream sub-basins).")
+        .def("get_total_inflow", &ModelHydro::GetTotalInflow, "Get the inflow total from upstream sub-basins.")
         .def("get_total_et", &ModelHydro::GetTotalET, "Get the total amount of water lost by evapotranspiration.")
+        .def("get_total_precipitation", &ModelHydro::GetTotalPrecipitation,
+             "Get the total precipitation over the hydro units.")
         .def("get_total_water_storage_changes", &ModelHydro::GetTotalWaterStorageChanges,
              "Get the total change in water storage.")
         .def("get_total_snow_storage_changes", &ModelHydro::GetTotalSnowStorageChanges,
@@ -357,7 +482,34 @@ PYBIND11_MODULE(_hydrobricks, m) {
         .def("get_recorded_hydro_unit_fraction_labels", &ModelHydro::GetRecordedHydroUnitFractionLabels,
              "Get the labels of the recorded land-cover fractions.")
         .def("get_hydro_unit_ids", &ModelHydro::GetHydroUnitIds, "Get the hydro unit ids in recorded order.")
-        .def("get_hydro_unit_areas", &ModelHydro::GetHydroUnitAreas, "Get the hydro unit areas in recorded order.");
+        .def("get_hydro_unit_areas", &ModelHydro::GetHydroUnitAreas, "Get the hydro unit areas in recorded order.")
+        .def("get_hydro_unit_time", &ModelHydro::GetHydroUnitTime,
+             "Get the dates (MJD) of the recorded hydro unit series (start of the recording periods).");
+
+    py::class_<BasinNetwork>(m, "BasinNetwork")
+        .def(py::init<>())
+        .def("add_model", &BasinNetwork::AddModel, "Add a sub-basin model to the network.", "model"_a,
+             py::keep_alive<1, 2>())
+        .def("connect", &BasinNetwork::Connect, "Connect the outlet of a sub-basin to a downstream sub-basin.",
+             "upstream"_a, "downstream"_a)
+        .def("set_routing", &BasinNetwork::SetRouting,
+             "Set the routing along the channel reach between a sub-basin and its downstream sub-basin.",
+             "upstream"_a, "routing"_a, "parameters"_a)
+        .def("get_model_count", &BasinNetwork::GetModelCount, "Get the number of sub-basins.")
+        .def("get_downstream", &BasinNetwork::GetDownstream, "Get the index of the downstream sub-basin.", "index"_a)
+        .def("get_execution_order", &BasinNetwork::GetExecutionOrder, "Get the sub-basins in topological order.")
+        .def(
+            "run",
+            [](BasinNetwork& n, int threadsNb) {
+                ModelResult r;
+                {
+                    py::gil_scoped_release release;
+                    r = n.Run(threadsNb);
+                }
+                if (!r) throw py::value_error(r.error());
+            },
+            "Run all sub-basins, the independent branches being run concurrently.", "threads"_a = 0)
+        .def("reset", &BasinNetwork::Reset, "Reset all sub-basin models.");
 
     py::class_<Action>(m, "Action").def(py::init<>());
 
@@ -379,6 +531,26 @@ PYBIND11_MODULE(_hydrobricks, m) {
         .def("get_lookup_table_volume", &ActionGlacierEvolutionDeltaH::GetLookupTableVolume,
              "Get the volumes lookup table.");
 
+    py::class_<GlacierDeltaH>(m, "GlacierDeltaH")
+        .def(py::init<const axd&, const axd&, const axd&, const axi&, double>(), "elevations"_a, "areas"_a,
+             "thicknesses"_a, "hydro_unit_ids"_a, "catchment_area"_a)
+        .def("set_observed_delta_h", &GlacierDeltaH::SetObservedDeltaH,
+             "Use observed normalized ice thickness changes instead of the parametrization.",
+             "normalized_elevations"_a, "normalized_delta_h"_a)
+        .def("compute", &GlacierDeltaH::Compute, "Compute the delta-h lookup tables.", "nb_increments"_a = 200,
+             "update_width"_a = true, "update_width_reference"_a = "initial",
+             py::call_guard<py::gil_scoped_release>())
+        .def("add_lookup_tables_to", &GlacierDeltaH::AddLookupTablesTo,
+             "Add the lookup tables to a glacier evolution action.", "action"_a, "month_num"_a, "land_cover"_a)
+        .def("get_hydro_unit_ids", &GlacierDeltaH::GetHydroUnitIds, "Get the hydro unit ids (table columns).")
+        .def("get_lookup_table_area", &GlacierDeltaH::GetLookupTableArea, "Get the area lookup table.")
+        .def("get_lookup_table_volume", &GlacierDeltaH::GetLookupTableVolume, "Get the volume lookup table.")
+        .def("get_we_parts", &GlacierDeltaH::GetWaterEquivalentParts, "Get the water equivalent of the parts.")
+        .def("get_areas_parts", &GlacierDeltaH::GetAreaFractionParts,
+             "Get the area of the parts (fraction of the catchment area).")
+        .def("get_elevation_parts", &GlacierDeltaH::GetElevationParts, "Get the elevation of the parts.")
+        .def("get_hydro_unit_id_parts", &GlacierDeltaH::GetHydroUnitIdParts, "Get the hydro unit id of the parts.");
+
     py::class_<ActionGlacierEvolutionAreaScaling, Action>(m, "ActionGlacierEvolutionAreaScaling")
         .def(py::init<>())
         .def("add_lookup_tables", &ActionGlacierEvolutionAreaScaling::AddLookupTables, "month_num"_a, "land_cover"_a,
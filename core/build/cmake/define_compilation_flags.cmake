@@ -54,3 +54,7 @@ endif (WIN32)
 if (USE_VLD)
     add_definitions(-DUSE_VLD)
 endif (USE_VLD)
+
+if (USE_PROFILING)
+    add_definitions(-DUSE_PROFILING)
+endif (USE_PROFILING)
@@ -13,6 +13,8 @@ file(GLOB_RECURSE src_fluxes_h ${CMAKE_SOURCE_DIR}/core/src/fluxes/*.h)
 file(GLOB_RECURSE src_fluxes_cpp ${CMAKE_SOURCE_DIR}/core/src/fluxes/*.cpp)
 file(GLOB_RECURSE src_processes_h ${CMAKE_SOURCE_DIR}/core/src/processes/*.h)
 file(GLOB_RECURSE src_processes_cpp ${CMAKE_SOURCE_DIR}/core/src/processes/*.cpp)
+file(GLOB_RECURSE src_preprocessing_h ${CMAKE_SOURCE_DIR}/core/src/preprocessing/*.h)
+file(GLOB_RECURSE src_preprocessing_cpp ${CMAKE_SOURCE_DIR}/core/src/preprocessing/*.cpp)
 file(GLOB_RECURSE src_spatial_h ${CMAKE_SOURCE_DIR}/core/src/spatial/*.h)
 file(GLOB_RECURSE src_spatial_cpp ${CMAKE_SOURCE_DIR}/core/src/spatial/*.cpp)
 list(
@@ -24,6 +26,7 @@ list(
     ${src_containers_h}
     ${src_fluxes_h}
     ${src_processes_h}
+    ${src_preprocessing_h}
     ${src_spatial_h})
 list(
     APPEND
@@ -34,6 +37,7 @@ list(
     ${src_containers_cpp}
     ${src_fluxes_cpp}
     ${src_processes_cpp}
+    ${src_preprocessing_cpp}
     ${src_spatial_cpp})
 
 # Remove eventual duplicates
@@ -50,6 +54,7 @@ list(
     "${CMAKE_SOURCE_DIR}/core/src/containers"
     "${CMAKE_SOURCE_DIR}/core/src/fluxes"
     "${CMAKE_SOURCE_DIR}/core/src/processes"
+    "${CMAKE_SOURCE_DIR}/core/src/preprocessing"
     "${CMAKE_SOURCE_DIR}/core/src/spatial")
 include_directories(${inc_dirs})
 
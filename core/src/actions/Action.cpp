@@ -1,6 +1,7 @@
 #include "Action.h"
 
 #include "ModelHydro.h"
+#include "Tracer.h"
 
 Action::Action()
     : _manager(nullptr),
@@ -49,6 +50,7 @@ bool Action::ApplyIfRecursive(const Time date) {
                 continue;
             }
 
+            HB_TRACE("action", "recursive_action");
             return Apply();
         }
     }
@@ -26,6 +26,13 @@ bool ActionGlacierEvolutionAreaScaling::Init() {
         return false;
     }
 
+    // Bind the hydro units and their glacier once, for the applications of the action.
+    _hydroUnits.clear();
+    _landCovers.clear();
+    _hydroUnits.reserve(_hydroUnitIds.size());
+    _landCovers.reserve(_hydroUnitIds.size());
+    Symbol landCoverSymbol = Symbol::Find(_landCoverName);
+
     for (int i = 0; i < _hydroUnitIds.size(); i++) {
         int id = _hydroUnitIds[i];
         HydroUnit* unit = _manager->GetHydroUnitById(id);
@@ -33,16 +40,23 @@ bool ActionGlacierEvolutionAreaScaling::Init() {
             LogError("The hydro unit {} was not found", id);
             return false;
         }
+        LandCover* brick = unit->TryGetLandCover(landCoverSymbol);
+        if (brick == nullptr) {
+            LogError("The land cover {} was not found in hydro unit {}", _landCoverName, id);
+            return false;
+        }
+        _hydroUnits.push_back(unit);
+        _landCovers.push_back(brick);
 
         // Check that the glacier area corresponds to the lookup table initial area.
         double areaRef = _tableArea(0, i);
-        double areaInModel = unit->GetLandCover(_landCoverName)->GetAreaFraction() * unit->GetArea();
+        double areaInModel = brick->GetAreaFraction() * unit->GetArea();
         if (NearlyZero(areaInModel, PRECISION)) {
             // If the glacier area is zero, initialize the fraction.
             double fraction = areaRef / unit->GetArea();
             fraction = CheckLandCoverAreaFraction(_landCoverName, id, fraction, unit->GetArea(), areaRef);
             assert(fraction >= 0 && fraction <= 1);
-            if (!unit->ChangeLandCoverAreaFraction(_landCoverName, fraction)) {
+            if (!unit->ChangeLandCoverAreaFraction(brick, fraction)) {
                 return false;
             }
         } else if (!NearlyEqual(areaInModel, areaRef, PRECISION)) {
@@ -54,11 +68,6 @@ bool ActionGlacierEvolutionAreaScaling::Init() {
         }
 
         // Initialize the glacier container.
-        LandCover* brick = unit->TryGetLandCover(_landCoverName);
-        if (brick == nullptr) {
-            LogError("The land cover {} was not found in hydro unit {}", _landCoverName, id);
-            return false;
-        }
         double iceWE = _tableVolume(0, i) * constants::iceDensity / areaRef;
         brick->UpdateContent(iceWE, ContentType::Ice);
         brick->SetInitialState(iceWE, ContentType::Ice);
@@ -73,8 +82,8 @@ void ActionGlacierEvolutionAreaScaling::Reset() {
 }
 
 bool ActionGlacierEvolutionAreaScaling::Apply(double) {
-    // Get the list of hydro units.
-    auto subBasin = _manager->GetModel()->GetSubBasin();
+    assert(_hydroUnits.size() == _hydroUnitIds.size());
+    assert(_landCovers.size() == _hydroUnitIds.size());
 
     // Get the percentage of glacier retreat for each row of the table.
     int nRows = static_cast<int>(_tableArea.rows());
@@ -83,9 +92,9 @@ bool ActionGlacierEvolutionAreaScaling::Apply(double) {
     // Change the glacier area for each hydro unit based on the lookup table.
     for (int i = 0; i < _hydroUnitIds.size(); ++i) {
         int id = _hydroUnitIds[i];
-        HydroUnit* unit = subBasin->GetHydroUnitById(id);
-        LandCover* brick = unit->TryGetLandCover(_landCoverName);
-        if (brick == nullptr || NearlyZero(brick->GetAreaFraction(), PRECISION)) {
+        HydroUnit* unit = _hydroUnits[i];
+        LandCover* brick = _landCovers[i];
+        if (NearlyZero(brick->GetAreaFraction(), PRECISION)) {
             continue;
         }
         double area = brick->GetAreaFraction() * unit->GetArea();
@@ -94,7 +103,7 @@ bool ActionGlacierEvolutionAreaScaling::Apply(double) {
 
         if (NearlyZero(iceVolume, PRECISION)) {
             // If the glacier water equivalent is zero, set the area to zero.
-            unit->ChangeLandCoverAreaFraction(_landCoverName, 0);
+            unit->ChangeLandCoverAreaFraction(brick, 0);
             continue;
         }
 
@@ -110,7 +119,7 @@ bool ActionGlacierEvolutionAreaScaling::Apply(double) {
         double newFraction = newArea / unit->GetArea();
         newFraction = CheckLandCoverAreaFraction(_landCoverName, id, newFraction, unit->GetArea(), newArea);
         assert(newFraction >= 0 && newFraction <= 1);
-        if (!unit->ChangeLandCoverAreaFraction(_landCoverName, newFraction)) {
+        if (!unit->ChangeLandCoverAreaFraction(brick, newFraction)) {
             return false;
         }
 
@@ -4,6 +4,9 @@
 #include "Action.h"
 #include "Includes.h"
 
+class HydroUnit;
+class LandCover;
+
 class ActionGlacierEvolutionAreaScaling : public Action {
   public:
     ActionGlacierEvolutionAreaScaling();
@@ -84,6 +87,8 @@ class ActionGlacierEvolutionAreaScaling : public Action {
     axi _hydroUnitIds;
     axxd _tableArea;
     axxd _tableVolume;
+    vector<HydroUnit*> _hydroUnits;  // non-owning references, bound in Init()
+    vector<LandCover*> _landCovers;  // non-owning references, bound in Init()
     axd _initialGlacierWE;
 };
 
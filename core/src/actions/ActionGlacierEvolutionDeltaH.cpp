@@ -13,8 +13,9 @@ void ActionGlacierEvolutionDeltaH::AddLookupTables(int month, const string& land
     _hydroUnitIds = hydroUnitIds;
     _tableArea = areas;
     _tableVolume = volumes;
+    _rowVolumeSums = _tableVolume.rowwise().sum();
 
-    double initialVolume = _tableVolume.row(0).sum();
+    double initialVolume = _rowVolumeSums[0];
     _initialGlacierWE = initialVolume * constants::iceDensity;  // Convert to mm w.e.
 }
 
@@ -28,6 +29,13 @@ bool ActionGlacierEvolutionDeltaH::Init() {
         return false;
     }
 
+    // Bind the hydro units and their glacier once, for the applications of the action.
+    _hydroUnits.clear();
+    _landCovers.clear();
+    _hydroUnits.reserve(_hydroUnitIds.size());
+    _landCovers.reserve(_hydroUnitIds.size());
+    Symbol landCoverSymbol = Symbol::Find(_landCoverName);
+
     for (int i = 0; i < _hydroUnitIds.size(); i++) {
         int id = _hydroUnitIds[i];
         HydroUnit* unit = _manager->GetHydroUnitById(id);
@@ -35,16 +43,23 @@ bool ActionGlacierEvolutionDeltaH::Init() {
             LogError("The hydro unit {} was not found", id);
             return false;
         }
+        LandCover* brick = unit->TryGetLandCover(landCoverSymbol);
+        if (brick == nullptr) {
+            LogError("The land cover {} was not found in hydro unit {}", _landCoverName, id);
+            return false;
+        }
+        _hydroUnits.push_back(unit);
+        _landCovers.push_back(brick);
 
         // Check that the glacier area corresponds to the lookup table initial area.
         double areaRef = _tableArea(0, i);
-        double areaInModel = unit->GetLandCover(_landCoverName)->GetAreaFraction() * unit->GetArea();
+        double areaInModel = brick->GetAreaFraction() * unit->GetArea();
         if (NearlyZero(areaInModel, PRECISION)) {
             // If the glacier area is zero, initialize the fraction.
             double fraction = areaRef / unit->GetArea();
             fraction = CheckLandCoverAreaFraction(_landCoverName, id, fraction, unit->GetArea(), areaRef);
             assert(fraction >= 0 && fraction <= 1);
-            if (!unit->ChangeLandCoverAreaFraction(_landCoverName, fraction)) {
+            if (!unit->ChangeLandCoverAreaFraction(brick, fraction)) {
                 return false;
             }
         } else if (!NearlyEqual(areaInModel, areaRef, PRECISION)) {
@@ -56,11 +71,6 @@ bool ActionGlacierEvolutionDeltaH::Init() {
         }
 
         // Initialize the glacier container.
-        LandCover* brick = unit->TryGetLandCover(_landCoverName);
-        if (brick == nullptr) {
-            LogError("The land cover {} was not found in hydro unit {}", _landCoverName, id);
-            return false;
-        }
         double iceWE = _tableVolume(0, i) * constants::iceDensity / areaRef;
         brick->UpdateContent(iceWE, ContentType::Ice);
         brick->SetInitialState(iceWE, ContentType::Ice);
@@ -77,19 +87,17 @@ void ActionGlacierEvolutionDeltaH::Reset() {
 }
 
 bool ActionGlacierEvolutionDeltaH::Apply(double) {
-    // Get the list of hydro units.
-    auto subBasin = _manager->GetSubBasin();
+    assert(_hydroUnits.size() == _hydroUnitIds.size());
+    assert(_landCovers.size() == _hydroUnitIds.size());
 
     // Compute the total glacier (_landCoverName) water equivalent (w.e.).
     double glacierWE = 0.0;
-    for (int i = 0; i < _hydroUnitIds.size(); ++i) {
-        int id = _hydroUnitIds[i];
-        HydroUnit* unit = subBasin->GetHydroUnitById(id);
-        LandCover* brick = unit->TryGetLandCover(_landCoverName);
-        if (brick == nullptr || NearlyZero(brick->GetAreaFraction(), PRECISION)) {
+    for (size_t i = 0; i < _landCovers.size(); ++i) {
+        LandCover* brick = _landCovers[i];
+        if (NearlyZero(brick->GetAreaFraction(), PRECISION)) {
             continue;
         }
-        double area = brick->GetAreaFraction() * unit->GetArea();
+        double area = brick->GetAreaFraction() * _hydroUnits[i]->GetArea();
         double brickGlacierWE = brick->GetContent(ContentType::Ice);
 
         glacierWE += area * brickGlacierWE;
@@ -109,12 +117,12 @@ bool ActionGlacierEvolutionDeltaH::Apply(double) {
     // Update the glacier area for each hydro unit if the row has changed.
     if (row != _lastRow) {
         for (int i = 0; i < _hydroUnitIds.size(); ++i) {
-            int id = _hydroUnitIds[i];
-            HydroUnit* unit = subBasin->GetHydroUnitById(id);
+            HydroUnit* unit = _hydroUnits[i];
             double fraction = _tableArea(row, i) / unit->GetArea();
-            fraction = CheckLandCoverAreaFraction(_landCoverName, id, fraction, unit->GetArea(), _tableArea(row, i));
+            fraction = CheckLandCoverAreaFraction(_landCoverName, _hydroUnitIds[i], fraction, unit->GetArea(),
+                                                  _tableArea(row, i));
             assert(fraction >= 0 && fraction <= 1);
-            if (!unit->ChangeLandCoverAreaFraction(_landCoverName, fraction)) {
+            if (!unit->ChangeLandCoverAreaFraction(_landCovers[i], fraction)) {
                 return false;
             }
         }
@@ -122,11 +130,9 @@ bool ActionGlacierEvolutionDeltaH::Apply(double) {
     }
 
     // Update the glacier water equivalent for each hydro unit to spread the glacier ice accordingly.
-    double rowVolumeSum = _tableVolume.row(row).sum();
+    double rowVolumeSum = _rowVolumeSums[row];
     for (int i = 0; i < static_cast<int>(_hydroUnitIds.size()); ++i) {
-        int id = _hydroUnitIds[i];
-        HydroUnit* unit = subBasin->GetHydroUnitById(id);
-        LandCover* brick = unit->GetLandCover(_landCoverName);
+        LandCover* brick = _landCovers[i];
         double areaGlacier = _tableArea(row, i);
         if (NearlyZero(areaGlacier, PRECISION)) {
             brick->UpdateContent(0, ContentType::Ice);
@@ -4,6 +4,9 @@
 #include "Action.h"
 #include "Includes.h"
 
+class HydroUnit;
+class LandCover;
+
 class ActionGlacierEvolutionDeltaH : public Action {
   public:
     ActionGlacierEvolutionDeltaH();
@@ -85,6 +88,9 @@ class ActionGlacierEvolutionDeltaH : public Action {
     axi _hydroUnitIds;
     axxd _tableArea;
     axxd _tableVolume;
+    axd _rowVolumeSums;              // total glacier volume of each row of the lookup table
+    vector<HydroUnit*> _hydroUnits;  // non-owning references, bound in Init()
+    vector<LandCover*> _landCovers;  // non-owning references, bound in Init()
     double _initialGlacierWE{0.0};
 };
 
@@ -14,6 +14,8 @@ ActionGlacierSnowToIceTransformation::ActionGlacierSnowToIceTransformation(int m
 bool ActionGlacierSnowToIceTransformation::Init() {
     // Loop over all hydro units in the sub-basin and register those with the specified land cover.
     _hydroUnitIds.clear();
+    _landCoverSymbol = Symbol::Find(_landCoverName);
+    _snowpackSymbol = Symbol::Find(_landCoverName + "_snowpack");
 
     if (_manager->GetSubBasin() == nullptr) {
         LogError("The model is likely not initialized (setup()) as the sub-basin is not defined.");
@@ -26,7 +28,7 @@ bool ActionGlacierSnowToIceTransformation::Init() {
 
     for (int i = 0; i < _manager->GetSubBasin()->GetHydroUnitCount(); ++i) {
         auto unit = _manager->GetSubBasin()->GetHydroUnit(i);
-        if (unit->TryGetLandCover(_landCoverName) != nullptr) {
+        if (unit->TryGetLandCover(_landCoverSymbol) != nullptr) {
             _hydroUnitIds.push_back(unit->GetId());
         }
     }
@@ -46,14 +48,14 @@ bool ActionGlacierSnowToIceTransformation::Apply(double) {
         HydroUnit* unit = subBasin->GetHydroUnitById(id);
 
         // Get the glacier brick.
-        LandCover* glacierLandCover = unit->TryGetLandCover(_landCoverName);
+        LandCover* glacierLandCover = unit->TryGetLandCover(_landCoverSymbol);
         if (glacierLandCover == nullptr || NearlyZero(glacierLandCover->GetAreaFraction(), PRECISION)) {
             continue;
         }
         Glacier* glacier = dynamic_cast<Glacier*>(glacierLandCover);
 
         // Get the associated snowpack.
-        Brick* snowpack = unit->TryGetBrick(_landCoverName + "_snowpack");
+        Brick* snowpack = unit->TryGetBrick(_snowpackSymbol);
         if (snowpack == nullptr) {
             LogError("The brick {} was not found in hydro unit {}", (_landCoverName + "_snowpack"), id);
             continue;
@@ -3,6 +3,7 @@
 
 #include "Action.h"
 #include "Includes.h"
+#include "Symbol.h"
 
 class ActionGlacierSnowToIceTransformation : public Action {
   public:
@@ -58,6 +59,8 @@ class ActionGlacierSnowToIceTransformation : public Action {
 
   protected:
     string _landCoverName;
+    Symbol _landCoverSymbol;  // resolved in Init()
+    Symbol _snowpackSymbol;   // resolved in Init()
     vecInt _hydroUnitIds;
 };
 
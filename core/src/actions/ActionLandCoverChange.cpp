@@ -3,17 +3,89 @@
 #include "HydroUnit.h"
 #include "ModelHydro.h"
 
-ActionLandCoverChange::ActionLandCoverChange() = default;
+ActionLandCoverChange::ActionLandCoverChange()
+    : _sorted(true) {}
 
 void ActionLandCoverChange::AddChange(double date, int hydroUnitId, const string& landCoverName, double area) {
     int landCoverId = GetLandCoverId(landCoverName);
 
-    int index = GetIndexForInsertion(date);
+    // The changes are appended and sorted once in Init().
+    _sporadicDates.push_back(date);
+    _hydroUnitIds.push_back(hydroUnitId);
+    _landCoverIds.push_back(landCoverId);
+    _areas.push_back(area);
+    _sorted = false;
+}
+
+bool ActionLandCoverChange::Init() {
+    if (!_sorted) {
+        // Sort by date and by hydro unit, so that the changes of a unit on a date are contiguous.
+        // For a unit and a date, the last added change comes first.
+        vecInt order(_sporadicDates.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::ranges::sort(order, [this](int a, int b) {
+            if (_sporadicDates[a] != _sporadicDates[b]) {
+                return _sporadicDates[a] < _sporadicDates[b];
+            }
+            if (_hydroUnitIds[a] != _hydroUnitIds[b]) {
+                return _hydroUnitIds[a] < _hydroUnitIds[b];
+            }
+            return a > b;
+        });
+
+        vecDouble dates(order.size());
+        vecInt hydroUnitIds(order.size());
+        vecInt landCoverIds(order.size());
+        vecDouble areas(order.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            dates[i] = _sporadicDates[order[i]];
+            hydroUnitIds[i] = _hydroUnitIds[order[i]];
+            landCoverIds[i] = _landCoverIds[order[i]];
+            areas[i] = _areas[order[i]];
+        }
+        _sporadicDates = std::move(dates);
+        _hydroUnitIds = std::move(hydroUnitIds);
+        _landCoverIds = std::move(landCoverIds);
+        _areas = std::move(areas);
+        _sorted = true;
+    }
+
+    // Resolve the hydro units and land covers, and group the changes by unit and date.
+    int changesNb = static_cast<int>(_sporadicDates.size());
+    _hydroUnits.resize(changesNb);
+    _landCovers.resize(changesNb);
+    _groupEnds.assign(changesNb, -1);
+    vector<Symbol> landCoverSymbols;
+    landCoverSymbols.reserve(_landCoverNames.size());
+    for (const auto& landCoverName : _landCoverNames) {
+        landCoverSymbols.push_back(Symbol::Find(landCoverName));
+    }
+    for (int i = 0; i < changesNb; ++i) {
+        HydroUnit* unit = _manager->GetHydroUnitById(_hydroUnitIds[i]);
+        if (unit == nullptr) {
+            LogError("The hydro unit {} was not found", _hydroUnitIds[i]);
+            return false;
+        }
+        LandCover* landCover = unit->TryGetLandCover(landCoverSymbols[_landCoverIds[i]]);
+        if (landCover == nullptr) {
+            LogError("The land cover {} was not found in hydro unit {}", _landCoverNames[_landCoverIds[i]],
+                     _hydroUnitIds[i]);
+            return false;
+        }
+        _hydroUnits[i] = unit;
+        _landCovers[i] = landCover;
 
-    _sporadicDates.insert(_sporadicDates.begin() + index, date);
-    _hydroUnitIds.insert(_hydroUnitIds.begin() + index, hydroUnitId);
-    _landCoverIds.insert(_landCoverIds.begin() + index, landCoverId);
-    _areas.insert(_areas.begin() + index, area);
+        if (i == 0 || _sporadicDates[i] != _sporadicDates[i - 1] || _hydroUnitIds[i] != _hydroUnitIds[i - 1]) {
+            int end = i + 1;
+            while (end < changesNb && _sporadicDates[end] == _sporadicDates[i] &&
+                   _hydroUnitIds[end] == _hydroUnitIds[i]) {
+                end++;
+            }
+            _groupEnds[i] = end;
+        }
+    }
+
+    return Action::Init();
 }
 
 void ActionLandCoverChange::Reset() {
@@ -24,18 +96,25 @@ void ActionLandCoverChange::Reset() {
 
 bool ActionLandCoverChange::Apply(double) {
     assert(_sporadicDates.size() > _cursor);
-    assert(_hydroUnitIds.size() > _cursor);
-    assert(_areas.size() > _cursor);
-    assert(_landCoverIds.size() > _cursor);
-    assert(_landCoverNames.size() > _landCoverIds[_cursor]);
-
-    HydroUnit* unit = _manager->GetHydroUnitById(_hydroUnitIds[_cursor]);
-    string landCoverName = _landCoverNames[_landCoverIds[_cursor]];
-    double areaFraction = _areas[_cursor] / unit->GetArea();
-    areaFraction = CheckLandCoverAreaFraction(landCoverName, _hydroUnitIds[_cursor], areaFraction, unit->GetArea(),
-                                              _areas[_cursor]);
-
-    return unit->ChangeLandCoverAreaFraction(landCoverName, areaFraction);
+    assert(_groupEnds.size() > _cursor);
+
+    // The changes of a unit on a date are applied together, with the first change of the group.
+    int end = _groupEnds[_cursor];
+    if (end < 0) {
+        return true;
+    }
+
+    HydroUnit* unit = _hydroUnits[_cursor];
+    _groupFractions.clear();
+    for (int i = _cursor; i < end; ++i) {
+        double areaFraction = _areas[i] / unit->GetArea();
+        areaFraction = CheckLandCoverAreaFraction(_landCoverNames[_landCoverIds[i]], _hydroUnitIds[i], areaFraction,
+                                                  unit->GetArea(), _areas[i]);
+        _groupFractions.push_back(areaFraction);
+    }
+
+    return unit->ChangeLandCoverAreaFractions(std::span(_landCovers).subspan(_cursor, end - _cursor),
+                                              _groupFractions);
 }
 
 int ActionLandCoverChange::GetLandCoverId(const string& landCoverName) {
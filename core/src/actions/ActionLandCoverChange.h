@@ -4,6 +4,9 @@
 #include "Action.h"
 #include "Includes.h"
 
+class HydroUnit;
+class LandCover;
+
 class ActionLandCoverChange : public Action {
   public:
     ActionLandCoverChange();
@@ -20,6 +23,14 @@ class ActionLandCoverChange : public Action {
      */
     void AddChange(double date, int hydroUnitId, const string& landCoverName, double area);
 
+    /**
+     * Initialize the action: sort the changes by date and hydro unit, and resolve the hydro units
+     * and land covers.
+     *
+     * @return true if the initialization was successful.
+     */
+    bool Init() override;
+
     /**
      * Reset the action to its initial state.
      */
@@ -56,6 +67,11 @@ class ActionLandCoverChange : public Action {
     vecInt _landCoverIds;
     vecStr _landCoverNames;
     vecDouble _areas;
+    bool _sorted;                    // the changes are sorted by date and hydro unit
+    vector<HydroUnit*> _hydroUnits;  // non-owning references, bound in Init()
+    vector<LandCover*> _landCovers;  // non-owning references, bound in Init()
+    vecInt _groupEnds;               // end of the changes of the unit on the date, for the first change of a group
+    vecDouble _groupFractions;       // area fractions of the group being applied
 
   private:
     int GetLandCoverId(const string& landCoverName);
@@ -3,11 +3,14 @@
 #include "Action.h"
 #include "ModelHydro.h"
 #include "SubBasin.h"
+#include "TimeMachine.h"
+#include "Tracer.h"
 #include "Utils.h"
 
 ActionsManager::ActionsManager()
     : _model(nullptr),
-      _cursorManager(0) {}
+      _cursorManager(0),
+      _timelineStart(0) {}
 
 void ActionsManager::SetModel(ModelHydro* model) {
     _model = model;
@@ -41,25 +44,30 @@ bool ActionsManager::AddAction(Action* action) {
     if (action->IsRecursive()) {
         _recursiveActionIndices.push_back(actionIndex);
     } else {
-        int index = 0;
-        for (auto date : action->GetSporadicDates()) {
-            // Reset the index if needed.
-            if (!_sporadicActionDates.empty() && _sporadicActionDates[index] > date) {
-                index = 0;
+        // Merge the (sorted) dates of the action into the timeline. On equal dates, the items
+        // of the last added action come first.
+        const vecDouble& actionDates = action->GetSporadicDates();
+        assert(std::is_sorted(actionDates.begin(), actionDates.end()));
+        vecDouble dates;
+        vecInt indices;
+        dates.reserve(_sporadicActionDates.size() + actionDates.size());
+        indices.reserve(dates.capacity());
+        size_t i = 0;
+        for (double date : actionDates) {
+            while (i < _sporadicActionDates.size() && _sporadicActionDates[i] < date) {
+                dates.push_back(_sporadicActionDates[i]);
+                indices.push_back(_sporadicActionIndices[i]);
+                i++;
             }
-
-            // Find index to insert the date accordingly.
-            for (int i = index; i < _sporadicActionDates.size(); ++i) {
-                if (date <= _sporadicActionDates[i]) {
-                    break;
-                }
-                index++;
-            }
-
-            // Insert date and action.
-            _sporadicActionDates.insert(_sporadicActionDates.begin() + index, date);
-            _sporadicActionIndices.insert(_sporadicActionIndices.begin() + index, actionIndex);
+            dates.push_back(date);
+            indices.push_back(actionIndex);
         }
+        dates.insert(dates.end(), _sporadicActionDates.begin() + static_cast<long>(i), _sporadicActionDates.end());
+        indices.insert(indices.end(), _sporadicActionIndices.begin() + static_cast<long>(i),
+                       _sporadicActionIndices.end());
+        _sporadicActionDates = std::move(dates);
+        _sporadicActionIndices = std::move(indices);
+        _stepEnds.clear();
     }
 
     return true;
@@ -78,9 +86,24 @@ int ActionsManager::GetSporadicActionItemCount() const {
 }
 
 void ActionsManager::DateUpdate(double date) {
+    Time dateStruct{};
+    if (!_recursiveActionIndices.empty()) {
+        dateStruct = GetTimeStructFromMJD(date);
+    }
+    ApplyActions(date, dateStruct);
+}
+
+void ActionsManager::StepUpdate(const TimeMachine& timer) {
+    int step = timer.GetCurrentStep();
+    if (step >= timer.GetCalendarStepCount()) {
+        DateUpdate(timer.GetDate());
+        return;
+    }
+
     // Recursive actions
     if (!_recursiveActionIndices.empty()) {
-        Time dateStruct = GetTimeStructFromMJD(date);
+        const CalendarStep& calendar = timer.GetCalendar();
+        Time dateStruct{calendar.year, calendar.month, calendar.day, calendar.hour, calendar.min, 0};
         for (int actionIndex : _recursiveActionIndices) {
             if (!_actions[actionIndex]->ApplyIfRecursive(dateStruct)) {
                 throw RuntimeError("Application of a recursive action failed.");
@@ -92,9 +115,53 @@ void ActionsManager::DateUpdate(double date) {
         return;
     }
 
+    // Sporadic actions
+    if (static_cast<int>(_stepEnds.size()) != timer.GetCalendarStepCount() || _timelineStart != timer.GetStart()) {
+        BuildTimeline(timer);
+    }
+    double date = timer.GetDate();
+    while (_cursorManager < _stepEnds[step]) {
+        HB_TRACE("action", "sporadic_action");
+        if (!_actions[_sporadicActionIndices[_cursorManager]]->Apply(date)) {
+            throw RuntimeError("Application of a sporadic action failed.");
+        }
+        _actions[_sporadicActionIndices[_cursorManager]]->IncrementCursor();
+        _cursorManager++;
+    }
+}
+
+void ActionsManager::BuildTimeline(const TimeMachine& timer) {
+    // The items are due at the first time step reaching their date.
+    int stepsNb = timer.GetCalendarStepCount();
+    _stepEnds.resize(stepsNb);
+    int itemsNb = static_cast<int>(_sporadicActionDates.size());
+    int end = 0;
+    for (int step = 0; step < stepsNb; ++step) {
+        double stepDate = timer.GetStepDate(step);
+        while (end < itemsNb && _sporadicActionDates[end] <= stepDate) {
+            end++;
+        }
+        _stepEnds[step] = end;
+    }
+    _timelineStart = timer.GetStart();
+}
+
+void ActionsManager::ApplyActions(double date, const Time& dateStruct) {
+    // Recursive actions
+    for (int actionIndex : _recursiveActionIndices) {
+        if (!_actions[actionIndex]->ApplyIfRecursive(dateStruct)) {
+            throw RuntimeError("Application of a recursive action failed.");
+        }
+    }
+
+    if (_sporadicActionDates.empty()) {
+        return;
+    }
+
     // Sporadic actions
     assert(_sporadicActionDates.size() == _sporadicActionIndices.size());
     while (_sporadicActionDates.size() > _cursorManager && _sporadicActionDates[_cursorManager] <= date) {
+        HB_TRACE("action", "sporadic_action");
         if (!_actions[_sporadicActionIndices[_cursorManager]]->Apply(date)) {
             throw RuntimeError("Application of a sporadic action failed.");
         }
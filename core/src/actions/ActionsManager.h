@@ -7,6 +7,7 @@
 class SubBasin;
 class ModelHydro;
 class Action;
+class TimeMachine;
 
 class ActionsManager {
   public:
@@ -64,6 +65,14 @@ class ActionsManager {
      */
     void DateUpdate(double date);
 
+    /**
+     * Update the time step during the simulation. Triggers the actions that are scheduled up to the
+     * current step of the timer, from the timeline of the actions bucketed by time step.
+     *
+     * @param timer the timer of the simulation.
+     */
+    void StepUpdate(const TimeMachine& timer);
+
     /**
      * Get the sub basin associated with the model.
      *
@@ -111,6 +120,23 @@ class ActionsManager {
     vecDouble _sporadicActionDates;
     vecInt _sporadicActionIndices;
     vecInt _recursiveActionIndices;
+    vecInt _stepEnds;       // end of the sporadic items due at each time step of the timeline
+    double _timelineStart;  // start date of the timer the timeline was bucketed for
+
+    /**
+     * Bucket the sporadic items by time step of the timer.
+     *
+     * @param timer the timer of the simulation.
+     */
+    void BuildTimeline(const TimeMachine& timer);
+
+    /**
+     * Apply the actions scheduled for a date.
+     *
+     * @param date corresponding date of the simulation.
+     * @param dateStruct the date as a time structure (used by the recursive actions).
+     */
+    void ApplyActions(double date, const Time& dateStruct);
 
   private:
 };
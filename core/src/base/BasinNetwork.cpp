@@ -0,0 +1,196 @@
+#include "BasinNetwork.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "Parallel.h"
+
+int BasinNetwork::AddModel(ModelHydro* model) {
+    if (model == nullptr || model->GetSubBasin() == nullptr) {
+        throw ModelConfigError("A model with a sub-basin must be provided to the basin network.");
+    }
+    _models.push_back(model);
+    _downstream.push_back(-1);
+    _inputConnectors.emplace_back();
+    _outputConnectors.push_back(nullptr);
+
+    return GetModelCount() - 1;
+}
+
+void BasinNetwork::Connect(int upstream, int downstream) {
+    if (upstream < 0 || upstream >= GetModelCount() || downstream < 0 || downstream >= GetModelCount()) {
+        throw ModelConfigError(std::format("Invalid sub-basin indices for the connection ({} -> {}).", upstream,
+                                           downstream));
+    }
+    if (upstream == downstream) {
+        throw ModelConfigError(std::format("The sub-basin {} cannot be connected to itself.", upstream));
+    }
+    if (_downstream[upstream] >= 0) {
+        throw ModelConfigError(std::format("The sub-basin {} is already connected to the sub-basin {}.", upstream,
+                                           _downstream[upstream]));
+    }
+
+    // Each sub-basin has a single downstream sub-basin: following them from the downstream one
+    // must not lead back to the upstream one.
+    for (int index = downstream; index >= 0; index = _downstream[index]) {
+        if (index == upstream) {
+            throw ModelConfigError(
+                std::format("Connecting the sub-basin {} to {} creates a cycle.", upstream, downstream));
+        }
+    }
+
+    auto connector = std::make_unique<Connector>();
+    connector->Connect(_models[upstream]->GetSubBasin(), _models[downstream]->GetSubBasin());
+    _downstream[upstream] = downstream;
+    _inputConnectors[downstream].push_back(connector.get());
+    _outputConnectors[upstream] = connector.get();
+    _connectors.push_back(std::move(connector));
+}
+
+void BasinNetwork::SetRouting(int upstream, const string& type, const std::unordered_map<string, double>& parameters) {
+    if (upstream < 0 || upstream >= GetModelCount() || _outputConnectors[upstream] == nullptr) {
+        throw ModelConfigError(std::format("The sub-basin {} is not connected to a downstream sub-basin.", upstream));
+    }
+
+    std::unique_ptr<ChannelRouting> routing = ChannelRouting::Factory(type);
+    for (const auto& [name, value] : parameters) {
+        routing->SetParameter(name, value);
+    }
+    _outputConnectors[upstream]->SetRouting(std::move(routing));
+}
+
+ModelHydro* BasinNetwork::GetModel(int index) const {
+    assert(index >= 0 && index < GetModelCount());
+    return _models[index];
+}
+
+int BasinNetwork::GetDownstream(int index) const {
+    assert(index >= 0 && index < GetModelCount());
+    return _downstream[index];
+}
+
+vecInt BasinNetwork::GetExecutionOrder() const {
+    vecInt pending(_models.size());
+    vecInt order;
+    order.reserve(_models.size());
+    for (int i = 0; i < GetModelCount(); ++i) {
+        pending[i] = static_cast<int>(_inputConnectors[i].size());
+        if (pending[i] == 0) {
+            order.push_back(i);
+        }
+    }
+    for (size_t i = 0; i < order.size(); ++i) {
+        int downstream = _downstream[order[i]];
+        if (downstream >= 0 && --pending[downstream] == 0) {
+            order.push_back(downstream);
+        }
+    }
+
+    return order;
+}
+
+ModelResult BasinNetwork::RunModel(int index) {
+    ModelHydro* model = _models[index];
+
+    if (!_inputConnectors[index].empty()) {
+        axd inflow = axd::Zero(model->GetTimeMachine()->GetTimeStepCount());
+        for (auto connector : _inputConnectors[index]) {
+            axd upstreamInflow = connector->GetInflow(*model->GetTimeMachine()->GetTimeStepPointer());
+            if (upstreamInflow.size() != inflow.size()) {
+                return std::unexpected(
+                    std::format("The upstream discharge ({} time steps) does not match the sub-basin period ({}).",
+                                upstreamInflow.size(), inflow.size()));
+            }
+            inflow += upstreamInflow;
+        }
+        model->SetInflow(inflow);
+    }
+
+    if (auto r = model->Run(); !r) {
+        return r;
+    }
+
+    if (_outputConnectors[index] != nullptr) {
+        _outputConnectors[index]->SetUpstreamDischarge(model->GetOutletDischarge());
+    }
+
+    return {};
+}
+
+ModelResult BasinNetwork::Run(int threadsNb) {
+    auto modelsNb = GetModelCount();
+    if (modelsNb == 0) {
+        return std::unexpected("The basin network has no sub-basin.");
+    }
+
+    // Sub-basins ready to run (all upstream sub-basins done), consumed by the workers.
+    std::mutex mutex;
+    std::condition_variable readyCondition;
+    std::deque<int> ready;
+    vecInt pending(modelsNb);
+    int remaining = modelsNb;
+    string error;
+    for (int i = 0; i < modelsNb; ++i) {
+        pending[i] = static_cast<int>(_inputConnectors[i].size());
+        if (pending[i] == 0) {
+            ready.push_back(i);
+        }
+    }
+
+    auto worker = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            readyCondition.wait(lock, [&] { return !ready.empty() || remaining == 0 || !error.empty(); });
+            if (remaining == 0 || !error.empty()) {
+                return;
+            }
+            int index = ready.front();
+            ready.pop_front();
+            lock.unlock();
+
+            ModelResult result;
+            try {
+                result = RunModel(index);
+            } catch (const std::exception& e) {
+                result = std::unexpected(string(e.what()));
+            }
+
+            lock.lock();
+            if (!result) {
+                error = std::format("Sub-basin {}: {}", index, result.error());
+            } else {
+                remaining--;
+                int downstream = _downstream[index];
+                if (downstream >= 0 && --pending[downstream] == 0) {
+                    ready.push_back(downstream);
+                }
+            }
+            readyCondition.notify_all();
+        }
+    };
+
+    int workersNb = std::min(GetThreadsCount(threadsNb), modelsNb);
+    vector<std::thread> workers;
+    workers.reserve(workersNb - 1);
+    for (int i = 1; i < workersNb; ++i) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : workers) {
+        thread.join();
+    }
+
+    if (!error.empty()) {
+        return std::unexpected(error);
+    }
+
+    return {};
+}
+
+void BasinNetwork::Reset() {
+    for (auto model : _models) {
+        model->Reset();
+    }
+}
@@ -0,0 +1,125 @@
+#ifndef HYDROBRICKS_BASIN_NETWORK_H
+#define HYDROBRICKS_BASIN_NETWORK_H
+
+#include <memory>
+#include <unordered_map>
+
+#include "Connector.h"
+#include "Includes.h"
+#include "ModelHydro.h"
+
+/**
+ * Network of sub-basin models connected by connectors (e.g. a river system).
+ *
+ * Every sub-basin is simulated by its own model (forcing, time machine, logger) over the same
+ * period. The models are run in topological order: the outlet discharge of a sub-basin is passed
+ * to the downstream sub-basin (optionally routed along the channel reach) as an inflow added to its
+ * outlet. The independent branches of the network are run concurrently on a pool of threads.
+ */
+class BasinNetwork {
+  public:
+    BasinNetwork() = default;
+
+    virtual ~BasinNetwork() = default;
+
+    /**
+     * Add a sub-basin model to the network.
+     *
+     * @param model The model of the sub-basin (non-owning, must outlive the network).
+     * @return The index of the sub-basin in the network.
+     */
+    int AddModel(ModelHydro* model);
+
+    /**
+     * Connect the outlet of a sub-basin to a downstream sub-basin.
+     *
+     * @param upstream The index of the upstream sub-basin.
+     * @param downstream The index of the downstream sub-basin.
+     * @throws ModelConfigError if the indices are invalid, if the upstream sub-basin is already
+     * connected downstream, or if the connection creates a cycle.
+     */
+    void Connect(int upstream, int downstream);
+
+    /**
+     * Set the routing along the channel reach between a sub-basin and its downstream sub-basin.
+     *
+     * @param upstream The index of the upstream sub-basin (already connected).
+     * @param type The routing name: 'lag_and_route', 'linear_reservoir_cascade' or 'muskingum_cunge'.
+     * @param parameters The parameters of the reach (see the ChannelRouting kernels).
+     * @throws ModelConfigError if the sub-basin is not connected, or if the routing or a parameter is
+     * invalid.
+     */
+    void SetRouting(int upstream, const string& type, const std::unordered_map<string, double>& parameters);
+
+    /**
+     * Get the number of sub-basins in the network.
+     *
+     * @return The number of sub-basins.
+     */
+    [[nodiscard]] int GetModelCount() const {
+        return static_cast<int>(_models.size());
+    }
+
+    /**
+     * Get the model of a sub-basin.
+     *
+     * @param index The index of the sub-basin.
+     * @return The model of the sub-basin.
+     */
+    [[nodiscard]] ModelHydro* GetModel(int index) const;
+
+    /**
+     * Get the number of connectors in the network.
+     *
+     * @return The number of connectors.
+     */
+    [[nodiscard]] int GetConnectorCount() const {
+        return static_cast<int>(_connectors.size());
+    }
+
+    /**
+     * Get the index of the downstream sub-basin of a sub-basin.
+     *
+     * @param index The index of the sub-basin.
+     * @return The index of the downstream sub-basin (-1 for an outlet of the network).
+     */
+    [[nodiscard]] int GetDownstream(int index) const;
+
+    /**
+     * Get an execution order of the sub-basins in which every sub-basin comes after its upstream
+     * sub-basins.
+     *
+     * @return The sub-basin indices in topological order.
+     */
+    [[nodiscard]] vecInt GetExecutionOrder() const;
+
+    /**
+     * Run all sub-basin models, the independent branches being run concurrently.
+     *
+     * @param threadsNb The number of threads to use (0: use the hardware concurrency).
+     * @return A ModelResult indicating success or the first failure.
+     */
+    [[nodiscard]] ModelResult Run(int threadsNb = 0);
+
+    /**
+     * Reset all sub-basin models to their initial state.
+     */
+    void Reset();
+
+  protected:
+    vector<ModelHydro*> _models;                     // non-owning references
+    vector<std::unique_ptr<Connector>> _connectors;  // owning
+    vecInt _downstream;                              // downstream sub-basin index (-1: none)
+    vector<vector<Connector*>> _inputConnectors;     // non-owning views into _connectors
+    vector<Connector*> _outputConnectors;            // non-owning views into _connectors
+
+    /**
+     * Run a single sub-basin model with the inflow from its upstream sub-basins.
+     *
+     * @param index The index of the sub-basin.
+     * @return A ModelResult indicating success or failure.
+     */
+    ModelResult RunModel(int index);
+};
+
+#endif  // HYDROBRICKS_BASIN_NETWORK_H
@@ -25,6 +25,27 @@ enum class TimeUnit {
     Variable
 };
 
+/**
+ * Recording periods of the logged hydro unit values.
+ */
+enum class LogPeriod {
+    Step,
+    Day,
+    Month,
+    Year
+};
+
+/**
+ * Aggregations of the logged values over a recording period.
+ */
+enum class LogAggregation {
+    Sum,
+    Mean,
+    Last,
+    Min,
+    Max
+};
+
 /**
  * Types of forcing variables.
  */
@@ -75,6 +75,24 @@ vecInt FileNetcdf::GetVarDimIds(int varId, int dimCount) const {
     return dimIds;
 }
 
+size_t FileNetcdf::GetVarSize(const string& varName) const {
+    int varId, dimCount;
+    CheckNcStatus(nc_inq_varid(_ncId, varName.c_str(), &varId));
+    CheckNcStatus(nc_inq_varndims(_ncId, varId, &dimCount));
+    if (dimCount == 0) {
+        return 1;
+    }
+
+    size_t size = 1;
+    for (int dimId : GetVarDimIds(varId, dimCount)) {
+        size_t dimLen;
+        CheckNcStatus(nc_inq_dimlen(_ncId, dimId, &dimLen));
+        size *= dimLen;
+    }
+
+    return size;
+}
+
 int FileNetcdf::DefDim(const string& dimName, int length) {
     int dimId;
     CheckNcStatus(nc_def_dim(_ncId, dimName.c_str(), length, &dimId));
@@ -151,7 +169,7 @@ vecFloat FileNetcdf::GetVarFloat1D(const string& varName, int size) const {
     return items;
 }
 
-vecDouble FileNetcdf::GetVarDouble1D(const string& varName, int size) const {
+vecDouble FileNetcdf::GetVarDouble1D(const string& varName, size_t size) const {
     int varId;
     vecDouble items(size);
 
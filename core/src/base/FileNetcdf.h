@@ -64,6 +64,14 @@ class FileNetcdf {
      */
     vecInt GetVarDimIds(int varId, int dimCount) const;
 
+    /**
+     * Get the total number of values of a variable (product of its dimension lengths).
+     *
+     * @param varName The name of the variable of interest.
+     * @return The number of values.
+     */
+    size_t GetVarSize(const string& varName) const;
+
     /**
      * Define a new dimension.
      *
@@ -147,7 +155,7 @@ class FileNetcdf {
      * @param size The size of the data vector.
      * @return A vector containing the data.
      */
-    vecDouble GetVarDouble1D(const string& varName, int size) const;
+    vecDouble GetVarDouble1D(const string& varName, size_t size) const;
 
     /**
      * Get values of a 2D double variable. The whole array retrieved at once.
@@ -2,9 +2,10 @@
 #define HYDROBRICKS_FORCING_H
 
 #include "Includes.h"
+#include "ModelArena.h"
 #include "TimeSeriesData.h"
 
-class Forcing {
+class Forcing : public ArenaAllocated {
   public:
     explicit Forcing(VariableType type);
 
@@ -32,7 +33,7 @@ class Forcing {
      *
      * @return the value of the forcing.
      */
-    double GetValue() const;
+    virtual double GetValue() const;
 
     /**
      * Override the forcing value for the current timestep.
@@ -55,7 +56,7 @@ class Forcing {
      *
      * @return true if the forcing is valid, false otherwise.
      */
-    [[nodiscard]] bool IsValid() const;
+    [[nodiscard]] virtual bool IsValid() const;
 
     /**
      * Validate the forcing.
@@ -0,0 +1,237 @@
+#include "ForcingPET.h"
+
+#include "TimeMachine.h"
+
+namespace {
+
+constexpr double solarConstant = 0.0820;      // [MJ m-2 min-1]
+constexpr double stefanBoltzmann = 4.903e-9;  // [MJ K-4 m-2 d-1]
+constexpr double albedo = 0.23;               // FAO-56 reference crop
+constexpr double priestleyTaylorAlpha = 1.26;
+
+/**
+ * Latent heat of vaporization [MJ kg-1].
+ */
+double LatentHeat(double temperature) {
+    return 2.501 - 0.002361 * temperature;
+}
+
+/**
+ * Saturation vapour pressure [kPa] (FAO-56, eq. 11).
+ */
+double SaturationVapourPressure(double temperature) {
+    return 0.6108 * std::exp(17.27 * temperature / (temperature + 237.3));
+}
+
+double SolarDeclination(int dayOfYear) {
+    return 0.409 * std::sin(2.0 * constants::pi * dayOfYear / 365.0 - 1.39);
+}
+
+double SunsetHourAngle(double latitude, double declination) {
+    double x = -std::tan(latitude) * std::tan(declination);
+
+    return std::acos(std::clamp(x, -1.0, 1.0));
+}
+
+}  // namespace
+
+ForcingPET::ForcingPET(PETMethod method, TimeMachine* timer)
+    : Forcing(VariableType::PET),
+      _method(method),
+      _timer(timer),
+      _temperature(nullptr),
+      _temperatureMin(nullptr),
+      _temperatureMax(nullptr),
+      _radiation(nullptr),
+      _latitude(NAN_D),
+      _elevation(0),
+      _cachedDate(NAN_D),
+      _cachedValue(0) {
+    assert(timer);
+}
+
+PETMethod ForcingPET::GetMethodFromName(const string& name) {
+    if (StringsMatch(name, "hamon")) {
+        return PETMethod::Hamon;
+    }
+    if (StringsMatch(name, "oudin")) {
+        return PETMethod::Oudin;
+    }
+    if (StringsMatch(name, "hargreaves")) {
+        return PETMethod::Hargreaves;
+    }
+    if (StringsMatch(name, "priestley-taylor") || StringsMatch(name, "priestley_taylor")) {
+        return PETMethod::PriestleyTaylor;
+    }
+
+    throw InputError(std::format("The PET method '{}' is not available natively.", name));
+}
+
+vector<VariableType> ForcingPET::GetRequiredForcing(PETMethod method) {
+    switch (method) {
+        case PETMethod::Hamon:
+        case PETMethod::Oudin:
+            return {VariableType::Temperature};
+        case PETMethod::Hargreaves:
+            return {VariableType::Temperature, VariableType::TemperatureMin, VariableType::TemperatureMax};
+        case PETMethod::PriestleyTaylor:
+            return {VariableType::Temperature, VariableType::TemperatureMin, VariableType::TemperatureMax,
+                    VariableType::Radiation};
+    }
+
+    throw ShouldNotHappen("Unknown PET method.");
+}
+
+void ForcingPET::SetLocation(double latitude, double elevation) {
+    _latitude = latitude * constants::pi / 180.0;
+    _elevation = elevation;
+}
+
+void ForcingPET::AttachInputForcing(Forcing* forcing) {
+    assert(forcing);
+    switch (forcing->GetType()) {
+        case VariableType::Temperature:
+            _temperature = forcing;
+            break;
+        case VariableType::TemperatureMin:
+            _temperatureMin = forcing;
+            break;
+        case VariableType::TemperatureMax:
+            _temperatureMax = forcing;
+            break;
+        case VariableType::Radiation:
+            _radiation = forcing;
+            break;
+        default:
+            throw ModelConfigError("The PET can only be derived from temperature and radiation forcings.");
+    }
+}
+
+double ForcingPET::GetValue() const {
+    if (_hasUpdatedValue) return _updatedValue;
+
+    double date = _timer->GetDate();
+    if (date != _cachedDate) {
+        _cachedValue = Compute();
+        _cachedDate = date;
+    }
+
+    return _cachedValue;
+}
+
+double ForcingPET::Compute() const {
+    int dayOfYear = _timer->GetCurrentDayOfYear();
+
+    switch (_method) {
+        case PETMethod::Hamon:
+            return ComputeHamon(_temperature->GetValue(), ComputeDayLength(_latitude, dayOfYear));
+        case PETMethod::Oudin:
+            return ComputeOudin(_temperature->GetValue(), ComputeExtraterrestrialRadiation(_latitude, dayOfYear));
+        case PETMethod::Hargreaves:
+            return ComputeHargreaves(_temperature->GetValue(), _temperatureMin->GetValue(),
+                                     _temperatureMax->GetValue(),
+                                     ComputeExtraterrestrialRadiation(_latitude, dayOfYear));
+        case PETMethod::PriestleyTaylor:
+            return ComputePriestleyTaylor(_temperature->GetValue(), _temperatureMin->GetValue(),
+                                          _temperatureMax->GetValue(), _radiation->GetValue(),
+                                          ComputeExtraterrestrialRadiation(_latitude, dayOfYear), _elevation);
+    }
+
+    throw ShouldNotHappen("Unknown PET method.");
+}
+
+bool ForcingPET::IsValid() const {
+    if (std::isnan(_latitude)) {
+        LogError("ForcingPET: The latitude of the hydro unit is not defined.");
+        return false;
+    }
+
+    for (auto type : GetRequiredForcing(_method)) {
+        Forcing* input = nullptr;
+        switch (type) {
+            case VariableType::Temperature:
+                input = _temperature;
+                break;
+            case VariableType::TemperatureMin:
+                input = _temperatureMin;
+                break;
+            case VariableType::TemperatureMax:
+                input = _temperatureMax;
+                break;
+            case VariableType::Radiation:
+                input = _radiation;
+                break;
+            default:
+                break;
+        }
+        if (!input) {
+            LogError("ForcingPET: An input forcing required by the PET method is not attached.");
+            return false;
+        }
+        if (!input->IsValid()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+double ForcingPET::ComputeExtraterrestrialRadiation(double latitude, int dayOfYear) {
+    double dr = 1.0 + 0.033 * std::cos(2.0 * constants::pi * dayOfYear / 365.0);
+    double declination = SolarDeclination(dayOfYear);
+    double ws = SunsetHourAngle(latitude, declination);
+
+    double ra = 24.0 * 60.0 / constants::pi * solarConstant * dr *
+                (ws * std::sin(latitude) * std::sin(declination) +
+                 std::cos(latitude) * std::cos(declination) * std::sin(ws));
+
+    return std::max(ra, 0.0);
+}
+
+double ForcingPET::ComputeDayLength(double latitude, int dayOfYear) {
+    return 24.0 / constants::pi * SunsetHourAngle(latitude, SolarDeclination(dayOfYear));
+}
+
+double ForcingPET::ComputeHamon(double temperature, double dayLength) {
+    double es = 10.0 * SaturationVapourPressure(temperature);  // [hPa]
+    double rhoSat = 216.7 * es / (temperature + 273.3);         // saturated vapour density [g m-3]
+
+    return std::max(0.1651 * dayLength / 12.0 * rhoSat, 0.0);
+}
+
+double ForcingPET::ComputeOudin(double temperature, double ra) {
+    if (temperature + 5.0 <= 0) {
+        return 0;
+    }
+
+    return ra / LatentHeat(temperature) * (temperature + 5.0) / 100.0;
+}
+
+double ForcingPET::ComputeHargreaves(double temperature, double temperatureMin, double temperatureMax, double ra) {
+    double range = std::max(temperatureMax - temperatureMin, 0.0);
+    double pet = 0.0023 * ra / LatentHeat(temperature) * (temperature + 17.8) * std::sqrt(range);
+
+    return std::max(pet, 0.0);
+}
+
+double ForcingPET::ComputePriestleyTaylor(double temperature, double temperatureMin, double temperatureMax, double rs,
+                                          double ra, double elevation) {
+    // Net radiation (FAO-56, eq. 38-40), with the actual vapour pressure estimated from the minimum temperature.
+    double rso = (0.75 + 2e-5 * elevation) * ra;
+    double relativeRs = rso > 0 ? std::min(rs / rso, 1.0) : 0.0;
+    double ea = SaturationVapourPressure(temperatureMin);
+    double tMaxK = temperatureMax + 273.16;
+    double tMinK = temperatureMin + 273.16;
+    double rnl = stefanBoltzmann * (std::pow(tMaxK, 4) + std::pow(tMinK, 4)) / 2.0 * (0.34 - 0.14 * std::sqrt(ea)) *
+                 (1.35 * relativeRs - 0.35);
+    double rn = (1.0 - albedo) * rs - rnl;
+
+    // Slope of the vapour pressure curve and psychrometric constant (FAO-56, eq. 7-8 and 13).
+    double delta = 4098.0 * SaturationVapourPressure(temperature) / std::pow(temperature + 237.3, 2);
+    double pressure = 101.3 * std::pow((293.0 - 0.0065 * elevation) / 293.0, 5.26);
+    double gamma = 0.000665 * pressure;
+
+    double pet = priestleyTaylorAlpha * delta / (delta + gamma) * rn / LatentHeat(temperature);
+
+    return std::max(pet, 0.0);
+}
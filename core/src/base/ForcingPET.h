@@ -0,0 +1,156 @@
+#ifndef HYDROBRICKS_FORCING_PET_H
+#define HYDROBRICKS_FORCING_PET_H
+
+#include "Forcing.h"
+#include "Includes.h"
+
+class TimeMachine;
+
+enum class PETMethod {
+    Hamon,
+    Oudin,
+    Hargreaves,
+    PriestleyTaylor
+};
+
+/**
+ * Potential evapotranspiration forcing derived on the fly from the other forcings of the
+ * hydro unit (temperature, min/max temperature, solar radiation) and its location (latitude,
+ * elevation), instead of being read from a time series. The kernels are daily formulations
+ * (PET in mm/d, radiation in MJ m-2 d-1). The value is computed once per time step and cached.
+ */
+class ForcingPET : public Forcing {
+  public:
+    ForcingPET(PETMethod method, TimeMachine* timer);
+
+    ~ForcingPET() override = default;
+
+    /**
+     * Get the PET method from its name (e.g. 'Hamon', 'oudin', 'Priestley-Taylor').
+     *
+     * @param name the method name.
+     * @return the PET method.
+     * @throws InputError if the method is not supported natively.
+     */
+    static PETMethod GetMethodFromName(const string& name);
+
+    /**
+     * Get the forcing types required by a PET method.
+     *
+     * @param method the PET method.
+     * @return the required forcing types.
+     */
+    static vector<VariableType> GetRequiredForcing(PETMethod method);
+
+    /**
+     * Set the location of the hydro unit.
+     *
+     * @param latitude the latitude [degrees].
+     * @param elevation the elevation [m].
+     */
+    void SetLocation(double latitude, double elevation);
+
+    /**
+     * Attach one of the forcings the PET is derived from.
+     *
+     * @param forcing the input forcing (temperature, min/max temperature or radiation).
+     */
+    void AttachInputForcing(Forcing* forcing);
+
+    /**
+     * Get the PET value at the current time in the simulation.
+     *
+     * @return the PET value [mm/d].
+     */
+    double GetValue() const override;
+
+    /**
+     * Check if the forcing is valid (all input forcings attached and valid).
+     *
+     * @return true if the forcing is valid, false otherwise.
+     */
+    [[nodiscard]] bool IsValid() const override;
+
+    /**
+     * Compute the extraterrestrial radiation (FAO-56, eq. 21).
+     *
+     * @param latitude the latitude [rad].
+     * @param dayOfYear the day of the year.
+     * @return the extraterrestrial radiation [MJ m-2 d-1].
+     */
+    static double ComputeExtraterrestrialRadiation(double latitude, int dayOfYear);
+
+    /**
+     * Compute the day length (FAO-56, eq. 34).
+     *
+     * @param latitude the latitude [rad].
+     * @param dayOfYear the day of the year.
+     * @return the day length [h].
+     */
+    static double ComputeDayLength(double latitude, int dayOfYear);
+
+    /**
+     * Compute the PET with the Hamon method (Lu et al., 2005 formulation).
+     *
+     * @param temperature the mean temperature [°C].
+     * @param dayLength the day length [h].
+     * @return the PET [mm/d].
+     */
+    static double ComputeHamon(double temperature, double dayLength);
+
+    /**
+     * Compute the PET with the Oudin et al. (2005) method.
+     *
+     * @param temperature the mean temperature [°C].
+     * @param ra the extraterrestrial radiation [MJ m-2 d-1].
+     * @return the PET [mm/d].
+     */
+    static double ComputeOudin(double temperature, double ra);
+
+    /**
+     * Compute the PET with the Hargreaves and Samani (1985) method.
+     *
+     * @param temperature the mean temperature [°C].
+     * @param temperatureMin the minimum temperature [°C].
+     * @param temperatureMax the maximum temperature [°C].
+     * @param ra the extraterrestrial radiation [MJ m-2 d-1].
+     * @return the PET [mm/d].
+     */
+    static double ComputeHargreaves(double temperature, double temperatureMin, double temperatureMax, double ra);
+
+    /**
+     * Compute the PET with the Priestley and Taylor (1972) method. The net radiation is
+     * estimated from the incoming solar radiation following FAO-56 (albedo of 0.23).
+     *
+     * @param temperature the mean temperature [°C].
+     * @param temperatureMin the minimum temperature [°C].
+     * @param temperatureMax the maximum temperature [°C].
+     * @param rs the incoming solar radiation [MJ m-2 d-1].
+     * @param ra the extraterrestrial radiation [MJ m-2 d-1].
+     * @param elevation the elevation [m].
+     * @return the PET [mm/d].
+     */
+    static double ComputePriestleyTaylor(double temperature, double temperatureMin, double temperatureMax, double rs,
+                                         double ra, double elevation);
+
+  protected:
+    PETMethod _method;
+    TimeMachine* _timer;         // non-owning reference
+    Forcing* _temperature;       // non-owning reference
+    Forcing* _temperatureMin;    // non-owning reference
+    Forcing* _temperatureMax;    // non-owning reference
+    Forcing* _radiation;         // non-owning reference
+    double _latitude;            // [rad]
+    double _elevation;           // [m]
+    mutable double _cachedDate;  // date of the cached value
+    mutable double _cachedValue;
+
+    /**
+     * Compute the PET for the current date.
+     *
+     * @return the PET value [mm/d].
+     */
+    double Compute() const;
+};
+
+#endif  // HYDROBRICKS_FORCING_PET_H
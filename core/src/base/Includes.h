@@ -15,6 +15,7 @@
 #include <cassert>
 #include <cmath>
 #include <concepts>
+#include <cstdint>
 #include <exception>
 #include <expected>
 #include <filesystem>
@@ -42,6 +43,8 @@ using vecDoublePt = vector<double*>;
 using axd = Eigen::ArrayXd;
 using axi = Eigen::ArrayXi;
 using axxd = Eigen::ArrayXXd;
+using axxdRowMajor = Eigen::Array<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+using axxi = Eigen::ArrayXXi;
 using vecAxd = vector<Eigen::ArrayXd>;
 using vecAxxd = vector<Eigen::ArrayXXd>;
 
@@ -54,6 +57,17 @@ struct Time {
     int sec;
 };
 
+struct CalendarStep {
+    std::int16_t year;
+    std::int16_t dayOfYear;  // 1-366
+    std::int8_t month;
+    std::int8_t day;
+    std::int8_t hour;
+    std::int8_t min;
+    bool newYear;   // the year differs from the one of the previous time step
+    bool newMonth;  // the month differs from the one of the previous time step
+};
+
 //---------------------------------
 // Own classes
 //---------------------------------
@@ -2,7 +2,9 @@
 
 #include <cmath>
 
+#include "Profiler.h"
 #include "ResultWriter.h"
+#include "TimeMachine.h"
 
 namespace {
 // Omitted (unit, label) cells are NaN (a label absent from a unit's structure
@@ -11,13 +13,62 @@ namespace {
 double NanToZero(double v) {
     return std::isnan(v) ? 0.0 : v;
 }
+
+// A fraction is recorded when it differs from the last recorded value (NaN being equal to NaN).
+bool HasChanged(double value, double last) {
+    return value != last && !(std::isnan(value) && std::isnan(last));
+}
+
+bool StartsNewPeriod(LogPeriod period, const CalendarStep& previous, const CalendarStep& current) {
+    switch (period) {
+        case LogPeriod::Step:
+            return true;
+        case LogPeriod::Day:
+            return current.day != previous.day || current.month != previous.month || current.year != previous.year;
+        case LogPeriod::Month:
+            return current.month != previous.month || current.year != previous.year;
+        case LogPeriod::Year:
+            return current.year != previous.year;
+    }
+    return true;
+}
+
+// Contents tracked by the running storage totals (water, snow and ice).
+constexpr std::array<std::string_view, 3> storageTags = {":water_content", ":snow_content", ":ice_content"};
+
+// Aggregate a value into the record of its period (stepsNb: number of steps in the period so far).
+double Aggregate(LogAggregation aggregation, double record, double value, double stepsNb) {
+    switch (aggregation) {
+        case LogAggregation::Sum:
+            return record + value;
+        case LogAggregation::Mean:
+            return record + (value - record) / stepsNb;
+        case LogAggregation::Last:
+            return value;
+        case LogAggregation::Min:
+            return std::min(record, value);
+        case LogAggregation::Max:
+            return std::max(record, value);
+    }
+    return value;
+}
 }  // namespace
 
 Logger::Logger()
     : _cursor(0),
-      _recordFractions(false) {}
-
-void Logger::InitContainers(int timeSize, SubBasin* subBasin, SettingsModel& modelSettings) {
+      _recordFractions(false),
+      _hydroUnitValuesTransposed(false),
+      _periodStart(0),
+      _fractionSteps(0),
+      _hydroUnitFractionsDirty(false),
+      _inflowPt(nullptr),
+      _totalPrecipitation(0),
+      _totalOutletDischarge(0),
+      _totalInflow(0),
+      _totalEt(0) {}
+
+void Logger::InitContainers(const TimeMachine& timer, SubBasin* subBasin, SettingsModel& modelSettings) {
+    int timeSize = timer.GetTimeStepCount();
     vecInt hydroUnitIds = subBasin->GetHydroUnitIds();
     vecDouble hydroUnitAreas = subBasin->GetHydroUnitAreas();
     vecStr subBasinLabels = modelSettings.GetSubBasinLogLabels();
@@ -32,21 +83,75 @@ void Logger::InitContainers(int timeSize, SubBasin* subBasin, SettingsModel& mod
     _hydroUnitAreas = Eigen::Map<axd>(hydroUnitAreas.data(), hydroUnitAreas.size());
     _hydroUnitLabels = hydroUnitLabels;
     _hydroUnitInitialValues = vecAxd(hydroUnitLabels.size(), axd::Ones(hydroUnitIds.size()) * NAN_D);
-    _hydroUnitValues = vecAxxd(hydroUnitLabels.size(), axxd::Ones(timeSize, hydroUnitIds.size()) * NAN_D);
+    _inflowPt = subBasin->GetValuePointer("inflow");
+    _precipitationPt.assign(hydroUnitIds.size(), nullptr);
+    for (int iUnit = 0; iUnit < subBasin->GetHydroUnitCount(); ++iUnit) {
+        HydroUnit* unit = subBasin->GetHydroUnit(iUnit);
+        if (unit->HasForcing(VariableType::Precipitation)) {
+            _precipitationPt[iUnit] = unit->GetForcing(VariableType::Precipitation);
+        }
+    }
+
+    // Recording periods of the hydro unit values.
+    const LoggerSettings& loggerSettings = modelSettings.GetLoggerSettings();
+    _stepPeriods.resize(timeSize);
+    vecDouble periodDates;
+    for (int step = 0; step < timeSize; ++step) {
+        if (step == 0 ||
+            StartsNewPeriod(loggerSettings.hydroUnitPeriod, timer.GetCalendar(step - 1), timer.GetCalendar(step))) {
+            periodDates.push_back(timer.GetStepDate(step));
+        }
+        _stepPeriods[step] = static_cast<int>(periodDates.size()) - 1;
+    }
+    _hydroUnitTime = Eigen::Map<axd>(periodDates.data(), static_cast<Eigen::Index>(periodDates.size()));
+    _periodStart = 0;
+
+    // Aggregations over the periods: the contents keep their last value and the other values are summed.
+    _hydroUnitAggregations.resize(hydroUnitLabels.size());
+    for (size_t i = 0; i < hydroUnitLabels.size(); ++i) {
+        _hydroUnitAggregations[i] = hydroUnitLabels[i].ends_with("_content") ? LogAggregation::Last
+                                                                             : LogAggregation::Sum;
+        for (size_t j = 0; j < loggerSettings.aggregatedLabels.size(); ++j) {
+            if (loggerSettings.aggregatedLabels[j] == hydroUnitLabels[i]) {
+                _hydroUnitAggregations[i] = loggerSettings.aggregations[j];
+            }
+        }
+    }
+
+    auto periodsNb = static_cast<Eigen::Index>(_hydroUnitTime.size());
+    // The values are recorded with the units along the rows so that a record of all the units is
+    // contiguous in memory. They are transposed in place to the public (time × unit) layout when accessed.
+    _hydroUnitValues = vecAxxd(hydroUnitLabels.size(), axxd::Ones(hydroUnitIds.size(), periodsNb) * NAN_D);
+    _hydroUnitValuesTransposed = false;
     _hydroUnitValuesPt = vector<vecDoublePt>(hydroUnitLabels.size(), vecDoublePt(hydroUnitIds.size(), nullptr));
     _subBasinEtIndices.clear();
     _hydroUnitEtIndices.clear();
     if (_recordFractions) {
         _hydroUnitFractionLabels = modelSettings.GetLandCoverBricksNames();
-        _hydroUnitFractions = vecAxxd(_hydroUnitFractionLabels.size(),
-                                      axxd::Ones(timeSize, hydroUnitIds.size()) * NAN_D);
         _hydroUnitFractionsPt = vector<vecDoublePt>(_hydroUnitFractionLabels.size(),
                                                     vecDoublePt(hydroUnitIds.size(), nullptr));
+        _hydroUnitLastFractions = vecAxd(_hydroUnitFractionLabels.size());
+        ClearFractionChanges();
     }
 }
 
 void Logger::Reset() {
     _cursor = 0;
+    if (_recordFractions) {
+        ClearFractionChanges();
+    }
+}
+
+void Logger::ClearFractionChanges() {
+    for (auto& lastFractions : _hydroUnitLastFractions) {
+        lastFractions = axd::Ones(static_cast<Eigen::Index>(_hydroUnitIds.size())) * NAN_D;
+    }
+    _fractionChangeSteps.clear();
+    _fractionChangeLabels.clear();
+    _fractionChangeUnits.clear();
+    _fractionChangeValues.clear();
+    _fractionSteps = 0;
+    _hydroUnitFractionsDirty = true;
 }
 
 void Logger::SetSubBasinValuePointer(int iLabel, double* valPt) {
@@ -80,7 +185,7 @@ void Logger::SaveInitialValues() {
     }
 
     for (int iUnitVal = 0; iUnitVal < _hydroUnitValuesPt.size(); ++iUnitVal) {
-        for (int iUnit = 0; iUnit < _hydroUnitValues[iUnitVal].cols(); ++iUnit) {
+        for (int iUnit = 0; iUnit < _hydroUnitValuesPt[iUnitVal].size(); ++iUnit) {
             // A label absent from a unit's structure variant is left unconnected
             // (NaN); skip it so the initial value stays NaN.
             if (_hydroUnitValuesPt[iUnitVal][iUnit] != nullptr) {
@@ -88,9 +193,62 @@ void Logger::SaveInitialValues() {
             }
         }
     }
+
+    InitTotals();
+}
+
+void Logger::InitTotals() {
+    _hydroUnitWeights = _hydroUnitAreas / _hydroUnitAreas.sum();
+    _outletIndices = GetIndicesForSubBasinElements("outlet");
+    _hydroUnitEtFractionIndices.clear();
+    for (int i : _hydroUnitEtIndices) {
+        _hydroUnitEtFractionIndices.push_back(GetFractionIndexForComponent(_hydroUnitLabels[i]));
+    }
+    for (auto [totals, tag] : std::views::zip(_storageTotals, storageTags)) {
+        totals.subBasinIndices = GetIndicesForSubBasinElements(string(tag));
+        totals.hydroUnitIndices = GetIndicesForHydroUnitElements(string(tag));
+        totals.fractionIndices.clear();
+        for (int i : totals.hydroUnitIndices) {
+            totals.fractionIndices.push_back(GetFractionIndexForComponent(_hydroUnitLabels[i]));
+        }
+        totals.initial = 0;
+        totals.final = 0;
+    }
+    _totalOutletDischarge = 0;
+    _totalInflow = 0;
+    _totalEt = 0;
+    _totalPrecipitation = 0;
+}
+
+double Logger::GetCurrentFraction(int fractionIndex, int iUnit) const {
+    if (fractionIndex < 0) {
+        return 1.0;
+    }
+    // A cover absent from a unit has no fraction there: it contributes nothing.
+    const double* fraction = _hydroUnitFractionsPt[fractionIndex][iUnit];
+    return fraction != nullptr ? NanToZero(*fraction) : 0.0;
+}
+
+double Logger::ComputeStorageState(const StorageTotals& totals, bool initial) const {
+    double state = 0;
+    for (int i : totals.subBasinIndices) {
+        state += initial ? _subBasinInitialValues[i] : *_subBasinValuesPt[i];
+    }
+    for (auto [i, fractionIndex] : std::views::zip(totals.hydroUnitIndices, totals.fractionIndices)) {
+        for (int iUnit = 0; iUnit < _hydroUnitWeights.size(); ++iUnit) {
+            if (_hydroUnitValuesPt[i][iUnit] == nullptr) {
+                continue;
+            }
+            double value = initial ? _hydroUnitInitialValues[i](iUnit) : *_hydroUnitValuesPt[i][iUnit];
+            state += NanToZero(value) * GetCurrentFraction(fractionIndex, iUnit) * _hydroUnitWeights[iUnit];
+        }
+    }
+
+    return state;
 }
 
 void Logger::Record() {
+    HB_PROFILE("model", "record");
     assert(_cursor < _time.size());
 
     for (auto [values, pt] : std::views::zip(_subBasinValues, _subBasinValuesPt)) {
@@ -98,25 +256,142 @@ void Logger::Record() {
         values[_cursor] = *pt;
     }
 
+    // Running water balance totals. ET fluxes are identified by the to-atmosphere tag recorded
+    // during model building. Sub-basin ET already represents the whole basin; hydro unit ET is
+    // area-weighted, and weighted by the (time-varying) fraction of its land cover if any. The
+    // outlet includes the inflow from the upstream sub-basins, which is totalled as an input, as
+    // is the area-weighted precipitation of the units.
+    for (int i : _outletIndices) {
+        _totalOutletDischarge += *_subBasinValuesPt[i];
+    }
+    _totalInflow += *_inflowPt;
+    for (int iUnit = 0; iUnit < _hydroUnitWeights.size(); ++iUnit) {
+        if (_precipitationPt[iUnit] != nullptr) {
+            _totalPrecipitation += _precipitationPt[iUnit]->GetValue() * _hydroUnitWeights[iUnit];
+        }
+    }
+    for (int i : _subBasinEtIndices) {
+        _totalEt += *_subBasinValuesPt[i];
+    }
+    for (auto [i, fractionIndex] : std::views::zip(_hydroUnitEtIndices, _hydroUnitEtFractionIndices)) {
+        for (int iUnit = 0; iUnit < _hydroUnitWeights.size(); ++iUnit) {
+            if (_hydroUnitValuesPt[i][iUnit] != nullptr) {
+                _totalEt += NanToZero(*_hydroUnitValuesPt[i][iUnit]) * GetCurrentFraction(fractionIndex, iUnit) *
+                            _hydroUnitWeights[iUnit];
+            }
+        }
+    }
+    if (_cursor == 0) {
+        for (auto& totals : _storageTotals) {
+            totals.initial = ComputeStorageState(totals, true);
+        }
+    }
+    if (_cursor == _time.size() - 1) {
+        for (auto& totals : _storageTotals) {
+            totals.final = ComputeStorageState(totals, false);
+        }
+    }
+
+    // The hydro unit values are aggregated over their recording period: the first step of a
+    // period overwrites the record, the next ones are aggregated into it.
+    int period = _stepPeriods[_cursor];
+    bool newPeriod = _cursor == 0 || _stepPeriods[_cursor - 1] != period;
+    if (newPeriod) {
+        _periodStart = _cursor;
+    }
+    auto periodStepsNb = static_cast<double>(_cursor - _periodStart + 1);
+
+    SetHydroUnitValuesLayout(false);
     for (int iUnitVal = 0; iUnitVal < _hydroUnitValuesPt.size(); ++iUnitVal) {
-        for (int iUnit = 0; iUnit < _hydroUnitValues[iUnitVal].cols(); ++iUnit) {
+        LogAggregation aggregation = newPeriod ? LogAggregation::Last : _hydroUnitAggregations[iUnitVal];
+        const vecDoublePt& valuesPt = _hydroUnitValuesPt[iUnitVal];
+        double* records = _hydroUnitValues[iUnitVal].col(period).data();
+        for (int iUnit = 0; iUnit < valuesPt.size(); ++iUnit) {
             // Unconnected (unit, label) pairs — a label not in this unit's structure
             // variant — stay NaN (omitted).
-            if (_hydroUnitValuesPt[iUnitVal][iUnit] != nullptr) {
-                _hydroUnitValues[iUnitVal](_cursor, iUnit) = *_hydroUnitValuesPt[iUnitVal][iUnit];
+            if (valuesPt[iUnit] != nullptr) {
+                records[iUnit] = Aggregate(aggregation, records[iUnit], *valuesPt[iUnit], periodStepsNb);
             }
         }
     }
 
     if (_recordFractions) {
+        // The fractions only change when an action is applied: record the changes only.
         for (int iUnitVal = 0; iUnitVal < _hydroUnitFractionsPt.size(); ++iUnitVal) {
-            for (int iUnit = 0; iUnit < _hydroUnitFractions[iUnitVal].cols(); ++iUnit) {
-                if (_hydroUnitFractionsPt[iUnitVal][iUnit] != nullptr) {
-                    _hydroUnitFractions[iUnitVal](_cursor, iUnit) = *_hydroUnitFractionsPt[iUnitVal][iUnit];
+            axd& lastFractions = _hydroUnitLastFractions[iUnitVal];
+            for (int iUnit = 0; iUnit < lastFractions.size(); ++iUnit) {
+                if (_hydroUnitFractionsPt[iUnitVal][iUnit] == nullptr) {
+                    continue;
+                }
+                double value = *_hydroUnitFractionsPt[iUnitVal][iUnit];
+                if (HasChanged(value, lastFractions[iUnit])) {
+                    lastFractions[iUnit] = value;
+                    _fractionChangeSteps.push_back(_cursor);
+                    _fractionChangeLabels.push_back(iUnitVal);
+                    _fractionChangeUnits.push_back(iUnit);
+                    _fractionChangeValues.push_back(value);
                 }
             }
         }
+        _fractionSteps = _cursor + 1;
+        _hydroUnitFractionsDirty = true;
+    }
+}
+
+const vecAxxd& Logger::GetHydroUnitValues() const {
+    SetHydroUnitValuesLayout(true);
+
+    return _hydroUnitValues;
+}
+
+void Logger::SetHydroUnitValuesLayout(bool transposed) const {
+    if (_hydroUnitValuesTransposed == transposed) {
+        return;
+    }
+    for (axxd& values : _hydroUnitValues) {
+        values.transposeInPlace();
     }
+    _hydroUnitValuesTransposed = transposed;
+}
+
+const vecAxxd& Logger::GetHydroUnitFractions() const {
+    if (!_hydroUnitFractionsDirty) {
+        return _hydroUnitFractions;
+    }
+
+    // Each recorded value holds until the next change of the same (label, unit) cell, or until the
+    // last recorded time step. The cells that were never recorded stay NaN. The changes are applied
+    // in order, so that a period holds the value at its end.
+    auto periodsNb = static_cast<Eigen::Index>(_hydroUnitTime.size());
+    auto unitsNb = static_cast<Eigen::Index>(_hydroUnitIds.size());
+    _hydroUnitFractions = vecAxxd(_hydroUnitFractionLabels.size(), axxd::Ones(periodsNb, unitsNb) * NAN_D);
+
+    vector<vecInt> lastChanges(_hydroUnitFractionLabels.size(), vecInt(unitsNb, -1));
+    auto fillUntil = [this](int iChange, int endStep) {
+        int startPeriod = _stepPeriods[_fractionChangeSteps[iChange]];
+        int endPeriod = _stepPeriods[endStep - 1] + 1;
+        _hydroUnitFractions[_fractionChangeLabels[iChange]]
+            .col(_fractionChangeUnits[iChange])
+            .segment(startPeriod, endPeriod - startPeriod)
+            .setConstant(_fractionChangeValues[iChange]);
+    };
+    for (int iChange = 0; iChange < static_cast<int>(_fractionChangeValues.size()); ++iChange) {
+        int& lastChange = lastChanges[_fractionChangeLabels[iChange]][_fractionChangeUnits[iChange]];
+        if (lastChange >= 0) {
+            fillUntil(lastChange, _fractionChangeSteps[iChange]);
+        }
+        lastChange = iChange;
+    }
+    for (const vecInt& labelLastChanges : lastChanges) {
+        for (int lastChange : labelLastChanges) {
+            if (lastChange >= 0) {
+                fillUntil(lastChange, _fractionSteps);
+            }
+        }
+    }
+    _hydroUnitFractionsDirty = false;
+
+    return _hydroUnitFractions;
 }
 
 void Logger::Increment() {
@@ -127,9 +402,9 @@ bool Logger::DumpOutputs(const string& path) {
     // Delegate output writing to ResultWriter
     ResultWriter writer;
 
-    return writer.WriteNetCDF(path, _time, _hydroUnitIds, _hydroUnitStructureIds, _hydroUnitAreas, _subBasinLabels,
-                              _subBasinValues, _hydroUnitLabels, _hydroUnitValues, _hydroUnitFractionLabels,
-                              _hydroUnitFractions);
+    return writer.WriteNetCDF(path, _time, _hydroUnitTime, _hydroUnitIds, _hydroUnitStructureIds, _hydroUnitAreas,
+                              _subBasinLabels, _subBasinValues, _hydroUnitLabels, GetHydroUnitValues(),
+                              _hydroUnitFractionLabels, GetHydroUnitFractions());
 }
 
 axd Logger::GetOutletDischarge() const {
@@ -177,41 +452,42 @@ double Logger::GetTotalSubBasin(const string& item) const {
 
 double Logger::GetTotalHydroUnits(const string& item, bool needsAreaWeighting) const {
     vecInt indices = GetIndicesForHydroUnitElements(item);
+    const vecAxxd& hydroUnitValues = GetHydroUnitValues();
     double sum = 0;
     size_t found = item.find(":content");
     if (found != std::string::npos) {
         // Storage content: fraction must be accounted for.
         // Precompute areas matrix once (assuming all values have the same number of rows)
-        axxd areas = _hydroUnitAreas.transpose().replicate(_hydroUnitValues[0].rows(), 1);
+        axxd areas = _hydroUnitAreas.transpose().replicate(hydroUnitValues[0].rows(), 1);
         double areasSum = _hydroUnitAreas.sum();
 
         for (int i : indices) {
-            axxd fraction = axxd::Ones(_hydroUnitValues[i].rows(), _hydroUnitValues[i].cols());
+            axxd fraction = axxd::Ones(hydroUnitValues[i].rows(), hydroUnitValues[i].cols());
             string componentName = _hydroUnitLabels[i];
             for (int j = 0; j < _hydroUnitFractionLabels.size(); ++j) {
                 string fractionLabel = _hydroUnitFractionLabels[j];
                 if (componentName == fractionLabel + ":content") {
-                    fraction = _hydroUnitFractions[j];
+                    fraction = GetHydroUnitFractions()[j];
                     break;
                 }
             }
-            axxd values = fraction * _hydroUnitValues[i].unaryExpr(&NanToZero);
+            axxd values = fraction * hydroUnitValues[i].unaryExpr(&NanToZero);
             sum += (values * areas).sum() / areasSum;
         }
     } else {
         // Not a storage content: fraction is already accounted for.
         if (needsAreaWeighting) {
             // Precompute areas matrix once (assuming all values have the same number of rows)
-            axxd areas = _hydroUnitAreas.transpose().replicate(_hydroUnitValues[0].rows(), 1);
+            axxd areas = _hydroUnitAreas.transpose().replicate(hydroUnitValues[0].rows(), 1);
             double areasSum = _hydroUnitAreas.sum();
 
             for (int i : indices) {
-                axxd values = _hydroUnitValues[i].unaryExpr(&NanToZero);
+                axxd values = hydroUnitValues[i].unaryExpr(&NanToZero);
                 sum += (values * areas).sum() / areasSum;
             }
         } else {
             for (int i : indices) {
-                sum += _hydroUnitValues[i].unaryExpr(&NanToZero).sum();
+                sum += hydroUnitValues[i].unaryExpr(&NanToZero).sum();
             }
         }
     }
@@ -219,42 +495,6 @@ double Logger::GetTotalHydroUnits(const string& item, bool needsAreaWeighting) c
     return sum;
 }
 
-double Logger::GetTotalOutletDischarge() const {
-    return GetTotalSubBasin("outlet");
-}
-
-double Logger::GetTotalET() const {
-    // ET fluxes are identified by the to-atmosphere tag recorded during model building,
-    // not by label matching: process names (e.g. "interception") need not contain "et".
-    double sum = 0;
-
-    // Sub-basin ET: already represents the whole basin, no area weighting.
-    for (int i : _subBasinEtIndices) {
-        sum += _subBasinValues[i].sum();
-    }
-
-    // Hydro unit ET: area-weighted basin average. ET on a full-unit brick (e.g. the soil
-    // moisture) carries no land-cover fraction; ET on a per-cover surface component (e.g. a
-    // forest canopy) must be weighted by that cover's (time-varying) fraction so it scales
-    // to the basin like the matching storage change does.
-    if (!_hydroUnitEtIndices.empty()) {
-        axxd areas = _hydroUnitAreas.transpose().replicate(_hydroUnitValues[0].rows(), 1);
-        double areasSum = _hydroUnitAreas.sum();
-        for (int i : _hydroUnitEtIndices) {
-            axxd values = _hydroUnitValues[i].unaryExpr(&NanToZero);
-            int fractionIndex = GetFractionIndexForComponent(_hydroUnitLabels[i]);
-            if (fractionIndex >= 0) {
-                // A cover absent from a unit has a NaN fraction there; zero it so the
-                // already-zeroed value contributes nothing (NaN * 0 would be NaN).
-                values *= _hydroUnitFractions[fractionIndex].unaryExpr(&NanToZero);
-            }
-            sum += (values * areas).sum() / areasSum;
-        }
-    }
-
-    return sum;
-}
-
 int Logger::GetFractionIndexForComponent(const string& componentName) const {
     for (int j = 0; j < static_cast<int>(_hydroUnitFractionLabels.size()); ++j) {
         const string& fractionLabel = _hydroUnitFractionLabels[j];
@@ -294,7 +534,7 @@ double Logger::GetHydroUnitsInitialStorageState(const string& tag) const {
         int fractionIndex = GetFractionIndexForComponent(_hydroUnitLabels[i]);
         if (fractionIndex >= 0) {
             // A cover absent from a unit has a NaN fraction there; zero it (NaN * 0 = NaN).
-            fraction = _hydroUnitFractions[fractionIndex](0, Eigen::placeholders::all).unaryExpr(&NanToZero);
+            fraction = GetHydroUnitFractions()[fractionIndex](0, Eigen::placeholders::all).unaryExpr(&NanToZero);
         }
         axd values = _hydroUnitInitialValues[i].unaryExpr(&NanToZero);
         values *= fraction;
@@ -308,32 +548,20 @@ double Logger::GetHydroUnitsFinalStorageState(const string& tag) const {
     vecInt indices = GetIndicesForHydroUnitElements(tag);
     double sum = 0;
     for (int i : indices) {
-        axd fraction = axd::Ones(_hydroUnitValues[i].cols());
+        axd fraction = axd::Ones(static_cast<Eigen::Index>(_hydroUnitIds.size()));
         int fractionIndex = GetFractionIndexForComponent(_hydroUnitLabels[i]);
         if (fractionIndex >= 0) {
             // A cover absent from a unit has a NaN fraction there; zero it (NaN * 0 = NaN).
-            fraction = _hydroUnitFractions[fractionIndex](Eigen::placeholders::last, Eigen::placeholders::all)
+            fraction = GetHydroUnitFractions()[fractionIndex](Eigen::placeholders::last, Eigen::placeholders::all)
                            .unaryExpr(&NanToZero);
         }
-        axd values = _hydroUnitValues[i](Eigen::placeholders::last, Eigen::placeholders::all).unaryExpr(&NanToZero);
+        const axxd& records = _hydroUnitValues[i];
+        axd values = _hydroUnitValuesTransposed ? axd(records.row(records.rows() - 1).transpose())
+                                                : axd(records.col(records.cols() - 1));
+        values = values.unaryExpr(&NanToZero);
         values *= fraction;
         sum += (values * _hydroUnitAreas).sum() / _hydroUnitAreas.sum();
     }
 
     return sum;
 }
-
-double Logger::GetTotalWaterStorageChanges() const {
-    return GetSubBasinFinalStorageState(":water_content") - GetSubBasinInitialStorageState(":water_content") +
-           GetHydroUnitsFinalStorageState(":water_content") - GetHydroUnitsInitialStorageState(":water_content");
-}
-
-double Logger::GetTotalSnowStorageChanges() const {
-    return GetSubBasinFinalStorageState(":snow_content") - GetSubBasinInitialStorageState(":snow_content") +
-           GetHydroUnitsFinalStorageState(":snow_content") - GetHydroUnitsInitialStorageState(":snow_content");
-}
-
-double Logger::GetTotalGlacierStorageChanges() const {
-    return GetSubBasinFinalStorageState(":ice_content") - GetSubBasinInitialStorageState(":ice_content") +
-           GetHydroUnitsFinalStorageState(":ice_content") - GetHydroUnitsInitialStorageState(":ice_content");
-}
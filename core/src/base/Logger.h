@@ -1,10 +1,14 @@
 #ifndef HYDROBRICKS_LOGGER_H
 #define HYDROBRICKS_LOGGER_H
 
+#include <array>
+
 #include "Includes.h"
 #include "SettingsModel.h"
 #include "SubBasin.h"
 
+class TimeMachine;
+
 class Logger {
   public:
     explicit Logger();
@@ -12,13 +16,13 @@ class Logger {
     virtual ~Logger() = default;
 
     /**
-     * Initialize the logger with the size of the time vector and the sub-basin object.
+     * Initialize the logger with the time steps of the timer and the sub-basin object.
      *
-     * @param timeSize size of the time vector.
+     * @param timer the timer of the model (initialized).
      * @param subBasin pointer to the sub-basin object.
      * @param modelSettings settings of the model.
      */
-    void InitContainers(int timeSize, SubBasin* subBasin, SettingsModel& modelSettings);
+    void InitContainers(const TimeMachine& timer, SubBasin* subBasin, SettingsModel& modelSettings);
 
     /**
      * Reset the logger.
@@ -122,18 +126,42 @@ class Logger {
     [[nodiscard]] double GetTotalHydroUnits(const string& item, bool needsAreaWeighting = false) const;
 
     /**
-     * Get the total outlet discharge over time.
+     * Get the total outlet discharge over time (accumulated during the run). It includes the
+     * inflow from the upstream sub-basins (see GetTotalInflow).
      *
      * @return total outlet discharge.
      */
-    [[nodiscard]] double GetTotalOutletDischarge() const;
+    [[nodiscard]] double GetTotalOutletDischarge() const {
+        return _totalOutletDischarge;
+    }
+
+    /**
+     * Get the total inflow from the upstream sub-basins over time (accumulated during the run).
+     *
+     * @return total inflow.
+     */
+    [[nodiscard]] double GetTotalInflow() const {
+        return _totalInflow;
+    }
 
     /**
-     * Get the total ET over time.
+     * Get the total ET over time (accumulated during the run).
      *
      * @return total ET.
      */
-    [[nodiscard]] double GetTotalET() const;
+    [[nodiscard]] double GetTotalET() const {
+        return _totalEt;
+    }
+
+    /**
+     * Get the total precipitation over time (accumulated during the run), area-weighted over
+     * the hydro units.
+     *
+     * @return total precipitation.
+     */
+    [[nodiscard]] double GetTotalPrecipitation() const {
+        return _totalPrecipitation;
+    }
 
     /**
      * Get the initial storage state of a sub-basin for a given tag.
@@ -181,25 +209,31 @@ class Logger {
     [[nodiscard]] double GetHydroUnitsFinalStorageState(const string& tag) const;
 
     /**
-     * Get the total water storage changes.
+     * Get the total water storage changes (between the first and the last record of the run).
      *
      * @return the total water storage changes.
      */
-    [[nodiscard]] double GetTotalWaterStorageChanges() const;
+    [[nodiscard]] double GetTotalWaterStorageChanges() const {
+        return _storageTotals[0].GetChange();
+    }
 
     /**
-     * Get the total snow storage changes.
+     * Get the total snow storage changes (between the first and the last record of the run).
      *
      * @return the total snow storage changes.
      */
-    [[nodiscard]] double GetTotalSnowStorageChanges() const;
+    [[nodiscard]] double GetTotalSnowStorageChanges() const {
+        return _storageTotals[1].GetChange();
+    }
 
     /**
-     * Get the total glacier storage changes.
+     * Get the total glacier storage changes (between the first and the last record of the run).
      *
      * @return the total glacier storage changes.
      */
-    [[nodiscard]] double GetTotalGlacierStorageChanges() const;
+    [[nodiscard]] double GetTotalGlacierStorageChanges() const {
+        return _storageTotals[2].GetChange();
+    }
 
     /**
      * Get all the sub-basin values.
@@ -211,13 +245,12 @@ class Logger {
     }
 
     /**
-     * Get all the hydro unit values.
+     * Get all the hydro unit values. The records are transposed in place to this layout on the
+     * first access after recording.
      *
-     * @return vector of hydro unit values.
+     * @return vector of hydro unit values (time × unit).
      */
-    const vecAxxd& GetHydroUnitValues() const {
-        return _hydroUnitValues;
-    }
+    const vecAxxd& GetHydroUnitValues() const;
 
     /**
      * Get the time series.
@@ -228,6 +261,16 @@ class Logger {
         return _time;
     }
 
+    /**
+     * Get the start dates of the recording periods of the hydro unit values. It is the time
+     * series when the hydro unit values are recorded at every time step.
+     *
+     * @return time series vector of the hydro unit values.
+     */
+    const axd& GetHydroUnitTime() const {
+        return _hydroUnitTime;
+    }
+
     /**
      * Get the hydro unit IDs.
      *
@@ -274,12 +317,21 @@ class Logger {
     }
 
     /**
-     * Get the hydro unit fractions.
+     * Get the hydro unit fractions. The fractions are recorded only when they change and the
+     * arrays (periods x units) are rebuilt from the recorded changes when needed, with the value
+     * at the end of each recording period of the hydro unit values.
      *
      * @return vector of fraction arrays.
      */
-    const vecAxxd& GetHydroUnitFractions() const {
-        return _hydroUnitFractions;
+    const vecAxxd& GetHydroUnitFractions() const;
+
+    /**
+     * Get the number of recorded changes of the hydro unit fractions.
+     *
+     * @return number of recorded changes.
+     */
+    [[nodiscard]] int GetHydroUnitFractionChangeCount() const {
+        return static_cast<int>(_fractionChangeValues.size());
     }
 
     /**
@@ -308,6 +360,22 @@ class Logger {
     }
 
   protected:
+    /**
+     * Storage state of a content type (water, snow or ice) over the basin, at the start and at the
+     * end of the run.
+     */
+    struct StorageTotals {
+        vecInt subBasinIndices;
+        vecInt hydroUnitIndices;
+        vecInt fractionIndices;  // fraction index of each hydro unit label (-1: none)
+        double initial = 0;
+        double final = 0;
+
+        [[nodiscard]] double GetChange() const {
+            return final - initial;
+        }
+    };
+
     int _cursor;
     axd _time;
     bool _recordFractions;
@@ -320,13 +388,72 @@ class Logger {
     axd _hydroUnitAreas;
     vecStr _hydroUnitLabels;
     vecAxd _hydroUnitInitialValues;
-    vecAxxd _hydroUnitValues;
+    mutable vecAxxd _hydroUnitValues;         // values, (unit × period) while recording, (period × unit) once read
+    mutable bool _hydroUnitValuesTransposed;  // the values are in the public (period × unit) layout
     vector<vecDoublePt> _hydroUnitValuesPt;
+    axd _hydroUnitTime;                             // start date of each recording period
+    vecInt _stepPeriods;                            // recording period of each time step
+    vector<LogAggregation> _hydroUnitAggregations;  // aggregation over the period, per hydro unit label
+    int _periodStart;                               // first time step of the current recording period
     vecStr _hydroUnitFractionLabels;
-    vecAxxd _hydroUnitFractions;
     vector<vecDoublePt> _hydroUnitFractionsPt;
-    vecInt _subBasinEtIndices;   // indices into _subBasinValues that are ET (to-atmosphere) fluxes
-    vecInt _hydroUnitEtIndices;  // indices into _hydroUnitValues that are ET (to-atmosphere) fluxes
+    vecAxd _hydroUnitLastFractions;         // last recorded fraction of each unit, per label
+    vecInt _fractionChangeSteps;            // time step of each recorded fraction change
+    vecInt _fractionChangeLabels;           // label index of each recorded fraction change
+    vecInt _fractionChangeUnits;            // unit index of each recorded fraction change
+    vecDouble _fractionChangeValues;        // new value of each recorded fraction change
+    int _fractionSteps;                     // number of time steps with recorded fractions
+    mutable vecAxxd _hydroUnitFractions;    // fractions rebuilt from the recorded changes
+    mutable bool _hydroUnitFractionsDirty;  // the rebuilt fractions are out of date
+
+    /**
+     * Transpose the hydro unit values in place to the given layout, one label at a time, so that
+     * a single copy of the records is kept.
+     *
+     * @param transposed true for the public (period × unit) layout, false for the recording
+     * (unit × period) layout.
+     */
+    void SetHydroUnitValuesLayout(bool transposed) const;
+
+    /**
+     * Clear the recorded changes of the hydro unit fractions.
+     */
+    void ClearFractionChanges();
+
+    /**
+     * Resolve the labels and weights of the running water balance totals and reset them.
+     */
+    void InitTotals();
+
+    /**
+     * Get the fraction of the land cover of a logged hydro unit value in a unit.
+     *
+     * @param fractionIndex fraction index of the hydro unit label (-1: none).
+     * @param iUnit index of the hydro unit.
+     * @return the current fraction (1 if none, 0 if the land cover is absent from the unit).
+     */
+    [[nodiscard]] double GetCurrentFraction(int fractionIndex, int iUnit) const;
+
+    /**
+     * Compute the current storage state of a content type over the basin.
+     *
+     * @param totals the storage totals of the content type.
+     * @param initial use the initial values instead of the current ones.
+     * @return the storage state, area-weighted over the basin.
+     */
+    [[nodiscard]] double ComputeStorageState(const StorageTotals& totals, bool initial) const;
+    vecInt _subBasinEtIndices;                    // indices into _subBasinValues that are ET (to-atmosphere) fluxes
+    vecInt _hydroUnitEtIndices;                   // indices into _hydroUnitValues that are ET (to-atmosphere) fluxes
+    vecInt _hydroUnitEtFractionIndices;           // fraction index of each hydro unit ET label (-1: none)
+    vecInt _outletIndices;                        // indices into _subBasinValues of the outlet
+    axd _hydroUnitWeights;                        // area of each unit over the total area
+    const double* _inflowPt;                      // inflow from the upstream sub-basins (non-owning reference)
+    vector<const Forcing*> _precipitationPt;      // precipitation of each unit (non-owning, nullptr: none)
+    double _totalPrecipitation;                   // running total of the precipitation
+    double _totalOutletDischarge;                 // running total of the outlet discharge
+    double _totalInflow;                          // running total of the inflow
+    double _totalEt;                              // running total of the ET
+    std::array<StorageTotals, 3> _storageTotals;  // water, snow and ice contents
 };
 
 #endif  // HYDROBRICKS_LOGGER_H
@@ -0,0 +1,58 @@
+#include "ModelArena.h"
+
+#include <cstddef>
+#include <new>
+
+namespace {
+
+thread_local ModelArena* currentArena = nullptr;
+
+// Prepended to every object so that its deletion knows where the memory comes from.
+struct alignas(std::max_align_t) AllocationHeader {
+    bool inArena;
+};
+
+constexpr size_t arenaInitialBlockSize = 64 * 1024;
+
+}  // namespace
+
+ModelArena::ModelArena()
+    : _resource(arenaInitialBlockSize),
+      _allocatedSize(0) {}
+
+void* ModelArena::Allocate(size_t size) {
+    _allocatedSize += size;
+    return _resource.allocate(size, alignof(std::max_align_t));
+}
+
+ModelArena* ModelArena::GetCurrent() {
+    return currentArena;
+}
+
+ModelArena::Scope::Scope(ModelArena* arena)
+    : _previous(currentArena) {
+    currentArena = arena;
+}
+
+ModelArena::Scope::~Scope() {
+    currentArena = _previous;
+}
+
+void* ArenaAllocated::operator new(size_t size) {
+    ModelArena* arena = ModelArena::GetCurrent();
+    size_t totalSize = sizeof(AllocationHeader) + size;
+    void* memory = arena != nullptr ? arena->Allocate(totalSize) : ::operator new(totalSize);
+    auto header = new (memory) AllocationHeader{arena != nullptr};
+
+    return header + 1;
+}
+
+void ArenaAllocated::operator delete(void* pointer) {
+    if (pointer == nullptr) {
+        return;
+    }
+    auto header = static_cast<AllocationHeader*>(pointer) - 1;
+    if (!header->inArena) {
+        ::operator delete(header);
+    }
+}
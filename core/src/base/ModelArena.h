@@ -0,0 +1,84 @@
+#ifndef HYDROBRICKS_MODEL_ARENA_H
+#define HYDROBRICKS_MODEL_ARENA_H
+
+#include <memory_resource>
+
+#include "Includes.h"
+
+/**
+ * Monotonic memory arena holding the object graph of a model (bricks, containers, processes,
+ * fluxes, splitters, forcing and properties). The objects are allocated contiguously in build
+ * order, which follows the traversal order of the time loop (unit by unit, brick by brick), and
+ * the memory is released at once when the arena is destroyed. Deleting an object allocated in
+ * the arena runs its destructor but does not free its memory.
+ *
+ * The arena is not thread-safe: it is used by the thread building the model, through a Scope.
+ */
+class ModelArena {
+  public:
+    ModelArena();
+
+    virtual ~ModelArena() = default;
+
+    ModelArena(const ModelArena&) = delete;
+    ModelArena& operator=(const ModelArena&) = delete;
+
+    /**
+     * Allocate memory in the arena.
+     *
+     * @param size The size to allocate [bytes].
+     * @return The allocated memory (aligned for any scalar type).
+     */
+    void* Allocate(size_t size);
+
+    /**
+     * Get the total size allocated in the arena.
+     *
+     * @return The allocated size [bytes].
+     */
+    [[nodiscard]] size_t GetAllocatedSize() const {
+        return _allocatedSize;
+    }
+
+    /**
+     * Get the arena used by the current thread for the objects of the model graph.
+     *
+     * @return The current arena, or nullptr if none is in use (the objects are then allocated
+     * on the heap).
+     */
+    static ModelArena* GetCurrent();
+
+    /**
+     * Use an arena for the objects of the model graph created by the current thread while the
+     * scope is alive.
+     */
+    class Scope {
+      public:
+        explicit Scope(ModelArena* arena);
+
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+      private:
+        ModelArena* _previous;  // non-owning reference
+    };
+
+  protected:
+    std::pmr::monotonic_buffer_resource _resource;
+    size_t _allocatedSize;
+};
+
+/**
+ * Base of the objects of the model graph: they are allocated in the current model arena, if
+ * any, and on the heap otherwise.
+ */
+class ArenaAllocated {
+  public:
+    static void* operator new(size_t size);
+
+    static void operator delete(void* pointer);
+};
+
+#endif  // HYDROBRICKS_MODEL_ARENA_H
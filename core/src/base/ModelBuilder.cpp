@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <limits>
 #include <map>
+#include <mutex>
+#include <optional>
 #include <set>
 
 #include "FluxForcing.h"
@@ -12,9 +14,12 @@
 #include "FluxToBrickInstantaneous.h"
 #include "FluxToOutlet.h"
 #include "Forcing.h"
+#include "ForcingPET.h"
 #include "HydroUnit.h"
 #include "LandCover.h"
 #include "Logger.h"
+#include "ModelArena.h"
+#include "Parallel.h"
 #include "Process.h"
 #include "ProcessLateral.h"
 #include "SettingsBasin.h"
@@ -23,6 +28,14 @@
 #include "SubBasin.h"
 #include "SurfaceComponent.h"
 #include "TimeMachine.h"
+#include "Tracer.h"
+
+namespace {
+
+// Minimum number of hydro units built by a thread (smaller models are built serially).
+constexpr int minUnitsPerBuildBlock = 64;
+
+}  // namespace
 
 ModelBuilder::ModelBuilder(SubBasin* subBasin, TimeMachine* timer, Logger* logger)
     : _subBasin(subBasin),
@@ -34,6 +47,7 @@ ModelBuilder::ModelBuilder(SubBasin* subBasin, TimeMachine* timer, Logger* logge
 }
 
 void ModelBuilder::AssignHydroUnitStructures(SettingsModel& modelSettings, SettingsBasin& basinSettings) {
+    HB_TRACE("build", "assign_structures");
     int structureCount = modelSettings.GetStructureCount();
     if (structureCount <= 1) {
         return;  // single structure: every unit keeps the default id 1
@@ -100,12 +114,17 @@ void ModelBuilder::BuildModelStructure(SettingsModel& modelSettings) {
     // The sub-basin is catchment-level and built from the primary structure (1);
     // each hydro unit then builds its own assigned structure variant.
     modelSettings.SelectStructure(1);
+    _petMethod = modelSettings.GetPETMethod();
+
+    // The components are allocated in the sub-basin arena, in the order they are built.
+    ModelArena::Scope arenaScope(_subBasin->GetArena());
 
     CreateSubBasinComponents(modelSettings);
     CreateHydroUnitsComponents(modelSettings);
 }
 
 void ModelBuilder::CreateSubBasinComponents(SettingsModel& modelSettings) {
+    HB_TRACE("build", "sub_basin_components");
     for (int iBrick = 0; iBrick < modelSettings.GetSubBasinBrickCount(); ++iBrick) {
         modelSettings.SelectSubBasinBrick(iBrick);
         const BrickSettings& brickSettings = modelSettings.GetSubBasinBrickSettings(iBrick);
@@ -150,51 +169,47 @@ void ModelBuilder::CreateSubBasinComponents(SettingsModel& modelSettings) {
 }
 
 void ModelBuilder::CreateHydroUnitsComponents(SettingsModel& modelSettings) {
+    HB_TRACE("build", "hydro_units_components");
     int hydroUnitCount = _subBasin->GetHydroUnitCount();
 
+    // The name index of the components is built by the first unit of each structure variant and
+    // shared by the others. These first units are built serially; the others only read the shared
+    // name index and are built concurrently, each worker thread allocating in its own arena.
+    std::map<int, std::shared_ptr<HydroUnitNameIndex>> nameIndices;
+    vector<HydroUnit*> sharingUnits;
+    sharingUnits.reserve(hydroUnitCount);
+
     for (int iUnit = 0; iUnit < hydroUnitCount; ++iUnit) {
         HydroUnit* unit = _subBasin->GetHydroUnit(iUnit);
-
-        // Each unit builds its assigned structure variant (defaults to structure 1).
-        modelSettings.SelectStructure(unit->GetStructureId());
-        vecInt surfaceCompIndices = modelSettings.GetSurfaceComponentBricksIndices();
-        vecInt landCoversIndices = modelSettings.GetLandCoverBricksIndices();
-
-        for (int iBrick : surfaceCompIndices) {
-            CreateHydroUnitBrick(modelSettings, unit, iBrick);
-        }
-
-        for (int iBrick : landCoversIndices) {
-            CreateHydroUnitBrick(modelSettings, unit, iBrick);
+        auto nameIndex = nameIndices.find(unit->GetStructureId());
+        if (nameIndex != nameIndices.end()) {
+            unit->SetNameIndex(nameIndex->second);
+            sharingUnits.push_back(unit);
+            continue;
         }
+        nameIndices[unit->GetStructureId()] = unit->GetNameIndex();
+        CreateHydroUnitComponents(GetStructureSettings(modelSettings, unit), unit);
+    }
 
-        for (int iBrick = 0; iBrick < modelSettings.GetHydroUnitBrickCount(); ++iBrick) {
-            if (std::find(surfaceCompIndices.begin(), surfaceCompIndices.end(), iBrick) != surfaceCompIndices.end()) {
-                continue;
+    std::mutex arenaMutex;
+    ParallelFor(
+        static_cast<int>(sharingUnits.size()),
+        [&](int start, int end) {
+            HB_TRACE("build", "hydro_units_block");
+
+            // The calling thread keeps the arena of the sub-basin.
+            std::optional<ModelArena::Scope> arenaScope;
+            if (ModelArena::GetCurrent() == nullptr) {
+                std::lock_guard<std::mutex> lock(arenaMutex);
+                arenaScope.emplace(_subBasin->AddArena());
             }
-            if (std::find(landCoversIndices.begin(), landCoversIndices.end(), iBrick) != landCoversIndices.end()) {
-                continue;
+            for (int i = start; i < end; ++i) {
+                CreateHydroUnitComponents(GetStructureSettings(modelSettings, sharingUnits[i]), sharingUnits[i]);
             }
-            CreateHydroUnitBrick(modelSettings, unit, iBrick);
-        }
-
-        for (int iSplitter = 0; iSplitter < modelSettings.GetHydroUnitSplitterCount(); ++iSplitter) {
-            modelSettings.SelectHydroUnitSplitter(iSplitter);
-            const SplitterSettings& splitterSettings = modelSettings.GetHydroUnitSplitterSettings(iSplitter);
-
-            auto splitterPtr = Splitter::Factory(splitterSettings);
-            Splitter* splitter = splitterPtr.get();
-            splitter->SetName(splitterSettings.name);
-            splitter->SetParameters(splitterSettings);
-            unit->AddSplitter(std::move(splitterPtr));
-
-            BuildForcingConnections(splitterSettings, unit, splitter);
-            splitter->SetHydroUnitProperties(unit);
-        }
-
-        LinkSurfaceComponentsParents(modelSettings, unit);
-    }
+        },
+        modelSettings.GetBuildThreads(), minUnitsPerBuildBlock);
 
+    // The targets can be in other units or in the sub-basin: the fluxes are wired serially.
     for (int iUnit = 0; iUnit < hydroUnitCount; ++iUnit) {
         HydroUnit* unit = _subBasin->GetHydroUnit(iUnit);
         modelSettings.SelectStructure(unit->GetStructureId());
@@ -204,10 +219,54 @@ void ModelBuilder::CreateHydroUnitsComponents(SettingsModel& modelSettings) {
     }
 }
 
-void ModelBuilder::CreateHydroUnitBrick(SettingsModel& modelSettings, HydroUnit* unit, int iBrick) {
-    modelSettings.SelectHydroUnitBrick(iBrick);
-    const BrickSettings& brickSettings = modelSettings.GetHydroUnitBrickSettings(iBrick);
+const ModelStructure& ModelBuilder::GetStructureSettings(const SettingsModel& modelSettings, HydroUnit* unit) {
+    // Each unit builds its assigned structure variant (defaults to structure 1).
+    const ModelStructure* structure = modelSettings.GetStructure(unit->GetStructureId());
+    if (structure == nullptr) {
+        throw ModelConfigError(std::format("The structure {} of the hydro unit {} is not defined.",
+                                           unit->GetStructureId(), unit->GetId()));
+    }
+
+    return *structure;
+}
+
+void ModelBuilder::CreateHydroUnitComponents(const ModelStructure& structure, HydroUnit* unit) {
+    const vecInt& surfaceCompIndices = structure.surfaceComponentBricks;
+    const vecInt& landCoversIndices = structure.landCoverBricks;
+
+    for (int iBrick : surfaceCompIndices) {
+        CreateHydroUnitBrick(structure.hydroUnitBricks[iBrick], unit);
+    }
 
+    for (int iBrick : landCoversIndices) {
+        CreateHydroUnitBrick(structure.hydroUnitBricks[iBrick], unit);
+    }
+
+    for (int iBrick = 0; iBrick < static_cast<int>(structure.hydroUnitBricks.size()); ++iBrick) {
+        if (std::find(surfaceCompIndices.begin(), surfaceCompIndices.end(), iBrick) != surfaceCompIndices.end()) {
+            continue;
+        }
+        if (std::find(landCoversIndices.begin(), landCoversIndices.end(), iBrick) != landCoversIndices.end()) {
+            continue;
+        }
+        CreateHydroUnitBrick(structure.hydroUnitBricks[iBrick], unit);
+    }
+
+    for (const auto& splitterSettings : structure.hydroUnitSplitters) {
+        auto splitterPtr = Splitter::Factory(splitterSettings);
+        Splitter* splitter = splitterPtr.get();
+        splitter->SetName(splitterSettings.name);
+        splitter->SetParameters(splitterSettings);
+        unit->AddSplitter(std::move(splitterPtr));
+
+        BuildForcingConnections(splitterSettings, unit, splitter);
+        splitter->SetHydroUnitProperties(unit);
+    }
+
+    LinkSurfaceComponentsParents(structure, unit);
+}
+
+void ModelBuilder::CreateHydroUnitBrick(const BrickSettings& brickSettings, HydroUnit* unit) {
     auto brickPtr = std::unique_ptr<Brick>(Brick::Factory(brickSettings));
     Brick* brick = brickPtr.get();
     brick->SetName(brickSettings.name);
@@ -219,10 +278,7 @@ void ModelBuilder::CreateHydroUnitBrick(SettingsModel& modelSettings, HydroUnit*
 
     BuildForcingConnections(brickSettings, unit, brick);
 
-    for (int iProcess = 0; iProcess < modelSettings.GetProcessCount(); ++iProcess) {
-        modelSettings.SelectProcess(iProcess);
-        const ProcessSettings& processSettings = modelSettings.GetProcessSettings(iProcess);
-
+    for (const auto& processSettings : brickSettings.processes) {
         auto processPtr = std::unique_ptr<Process>(Process::Factory(processSettings, brick));
         Process* process = processPtr.get();
         process->SetName(processSettings.name);
@@ -272,7 +328,7 @@ void ModelBuilder::UpdateHydroUnitsParameters(SettingsModel& modelSettings) {
         for (int iBrick = 0; iBrick < modelSettings.GetHydroUnitBrickCount(); ++iBrick) {
             modelSettings.SelectHydroUnitBrick(iBrick);
             const BrickSettings& brickSettings = modelSettings.GetHydroUnitBrickSettings(iBrick);
-            Brick* brick = unit->GetBrick(modelSettings.GetHydroUnitBrickSettings(iBrick).name);
+            Brick* brick = unit->GetBrick(modelSettings.GetHydroUnitBrickSettings(iBrick).symbol);
             brick->SetParameters(brickSettings);
 
             for (int iProcess = 0; iProcess < modelSettings.GetProcessCount(); ++iProcess) {
@@ -292,12 +348,12 @@ void ModelBuilder::UpdateHydroUnitsParameters(SettingsModel& modelSettings) {
     }
 }
 
-void ModelBuilder::LinkSurfaceComponentsParents(SettingsModel& modelSettings, HydroUnit* unit) {
-    for (int iBrick = 0; iBrick < modelSettings.GetSurfaceComponentBrickCount(); ++iBrick) {
-        const BrickSettings& brickSettings = modelSettings.GetSurfaceComponentBrickSettings(iBrick);
+void ModelBuilder::LinkSurfaceComponentsParents(const ModelStructure& structure, HydroUnit* unit) {
+    for (int brickIndex : structure.surfaceComponentBricks) {
+        const BrickSettings& brickSettings = structure.hydroUnitBricks[brickIndex];
         if (!brickSettings.parent.empty()) {
-            auto surfaceComponentBrick = dynamic_cast<SurfaceComponent*>(unit->GetBrick(brickSettings.name));
-            auto landCoverBrick = dynamic_cast<LandCover*>(unit->GetBrick(brickSettings.parent));
+            auto surfaceComponentBrick = dynamic_cast<SurfaceComponent*>(unit->GetBrick(brickSettings.symbol));
+            auto landCoverBrick = dynamic_cast<LandCover*>(unit->GetBrick(brickSettings.parentSymbol));
             assert(surfaceComponentBrick);
             assert(landCoverBrick);
             surfaceComponentBrick->SetParent(landCoverBrick);
@@ -331,15 +387,15 @@ void ModelBuilder::LinkHydroUnitProcessesTargetBricks(SettingsModel& modelSettin
         for (int iProcess = 0; iProcess < modelSettings.GetProcessCount(); ++iProcess) {
             const ProcessSettings& processSettings = modelSettings.GetProcessSettings(iProcess);
 
-            Brick* brick = unit->GetBrick(modelSettings.GetHydroUnitBrickSettings(iBrick).name);
+            Brick* brick = unit->GetBrick(modelSettings.GetHydroUnitBrickSettings(iBrick).symbol);
             Process* process = brick->GetProcess(iProcess);
 
             if (process->NeedsTargetBrickLinking()) {
                 if (process->LinksMultipleTargets()) {
                     for (const auto& output : processSettings.outputs) {
                         Brick* targetBrick = nullptr;
-                        if (unit->HasBrick(output.target)) {
-                            targetBrick = unit->GetBrick(output.target);
+                        if (unit->HasBrick(output.targetSymbol)) {
+                            targetBrick = unit->GetBrick(output.targetSymbol);
                         } else {
                             targetBrick = _subBasin->GetBrick(output.target);
                         }
@@ -351,8 +407,8 @@ void ModelBuilder::LinkHydroUnitProcessesTargetBricks(SettingsModel& modelSettin
                         throw ModelConfigError("There can only be a single process output for brick linking.");
                     }
                     Brick* targetBrick = nullptr;
-                    if (unit->HasBrick(processSettings.outputs[0].target)) {
-                        targetBrick = unit->GetBrick(processSettings.outputs[0].target);
+                    if (unit->HasBrick(processSettings.outputs[0].targetSymbol)) {
+                        targetBrick = unit->GetBrick(processSettings.outputs[0].targetSymbol);
                     } else {
                         targetBrick = _subBasin->GetBrick(processSettings.outputs[0].target);
                     }
@@ -372,10 +428,10 @@ std::vector<Brick*> ModelBuilder::FindLandCoversFeeding(const string& targetName
     std::vector<Brick*> covers;
     for (int iBrick = 0; iBrick < modelSettings.GetHydroUnitBrickCount(); ++iBrick) {
         const BrickSettings& brickSettings = modelSettings.GetHydroUnitBrickSettings(iBrick);
-        if (!unit->HasBrick(brickSettings.name)) {
+        if (!unit->HasBrick(brickSettings.symbol)) {
             continue;
         }
-        Brick* brick = unit->GetBrick(brickSettings.name);
+        Brick* brick = unit->GetBrick(brickSettings.symbol);
         if (!brick->CanHaveAreaFraction()) {
             continue;  // only land covers carry an area fraction
         }
@@ -451,7 +507,7 @@ void ModelBuilder::BuildHydroUnitBricksFluxes(SettingsModel& modelSettings, Hydr
         for (int iProcess = 0; iProcess < modelSettings.GetProcessCount(); ++iProcess) {
             const ProcessSettings& processSettings = modelSettings.GetProcessSettings(iProcess);
 
-            Brick* brick = unit->GetBrick(modelSettings.GetHydroUnitBrickSettings(iBrick).name);
+            Brick* brick = unit->GetBrick(modelSettings.GetHydroUnitBrickSettings(iBrick).symbol);
             Process* process = brick->GetProcess(iProcess);
 
             if (process->ToAtmosphere()) {
@@ -507,12 +563,12 @@ void ModelBuilder::BuildHydroUnitBricksFluxes(SettingsModel& modelSettings, Hydr
                         }
                     }
 
-                } else if (unit->HasBrick(output.target) || _subBasin->HasBrick(output.target)) {
+                } else if (unit->HasBrick(output.targetSymbol) || _subBasin->HasBrick(output.target)) {
                     bool toSubBasin = false;
                     Brick* targetBrick = nullptr;
 
-                    if (unit->HasBrick(output.target)) {
-                        targetBrick = unit->GetBrick(output.target);
+                    if (unit->HasBrick(output.targetSymbol)) {
+                        targetBrick = unit->GetBrick(output.targetSymbol);
                     } else {
                         targetBrick = _subBasin->GetBrick(output.target);
                         toSubBasin = true;
@@ -542,12 +598,12 @@ void ModelBuilder::BuildHydroUnitBricksFluxes(SettingsModel& modelSettings, Hydr
                     targetBrick->AttachFluxIn(flux);
                     process->AttachFluxOut(std::move(fluxPtr));
 
-                } else if (unit->HasSplitter(output.target) || _subBasin->HasSplitter(output.target)) {
+                } else if (unit->HasSplitter(output.targetSymbol) || _subBasin->HasSplitter(output.target)) {
                     bool toSubBasin = false;
                     Splitter* targetSplitter = nullptr;
 
-                    if (unit->HasSplitter(output.target)) {
-                        targetSplitter = unit->GetSplitter(output.target);
+                    if (unit->HasSplitter(output.targetSymbol)) {
+                        targetSplitter = unit->GetSplitter(output.targetSymbol);
                     } else {
                         targetSplitter = _subBasin->GetSplitter(output.target);
                         toSubBasin = true;
@@ -637,12 +693,12 @@ void ModelBuilder::BuildHydroUnitSplittersFluxes(SettingsModel& modelSettings, H
                 flux->SetFractionUnitArea(unit->GetArea() / _subBasin->GetArea());
                 _subBasin->AttachOutletFlux(flux);
 
-            } else if (unit->HasBrick(output.target) || _subBasin->HasBrick(output.target)) {
+            } else if (unit->HasBrick(output.targetSymbol) || _subBasin->HasBrick(output.target)) {
                 bool toSubBasin = false;
                 Brick* targetBrick = nullptr;
 
-                if (unit->HasBrick(output.target)) {
-                    targetBrick = unit->GetBrick(output.target);
+                if (unit->HasBrick(output.targetSymbol)) {
+                    targetBrick = unit->GetBrick(output.targetSymbol);
                 } else {
                     targetBrick = _subBasin->GetBrick(output.target);
                     toSubBasin = true;
@@ -659,12 +715,12 @@ void ModelBuilder::BuildHydroUnitSplittersFluxes(SettingsModel& modelSettings, H
 
                 targetBrick->AttachFluxIn(flux);
 
-            } else if (unit->HasSplitter(output.target) || _subBasin->HasSplitter(output.target)) {
+            } else if (unit->HasSplitter(output.targetSymbol) || _subBasin->HasSplitter(output.target)) {
                 bool toSubBasin = false;
                 Splitter* targetSplitter = nullptr;
 
-                if (unit->HasSplitter(output.target)) {
-                    targetSplitter = unit->GetSplitter(output.target);
+                if (unit->HasSplitter(output.targetSymbol)) {
+                    targetSplitter = unit->GetSplitter(output.targetSymbol);
                 } else {
                     targetSplitter = _subBasin->GetSplitter(output.target);
                     toSubBasin = true;
@@ -690,13 +746,36 @@ void ModelBuilder::BuildHydroUnitSplittersFluxes(SettingsModel& modelSettings, H
     }
 }
 
+Forcing* ModelBuilder::GetOrCreateForcing(HydroUnit* unit, VariableType type) {
+    if (unit->HasForcing(type)) {
+        return unit->GetForcing(type);
+    }
+
+    if (type != VariableType::PET || _petMethod.empty()) {
+        unit->AddForcing(std::make_unique<Forcing>(type));
+        return unit->GetForcing(type);
+    }
+
+    // The PET is derived on the fly from the other forcings of the unit.
+    PETMethod method = ForcingPET::GetMethodFromName(_petMethod);
+    auto forcingPET = std::make_unique<ForcingPET>(method, _timer);
+    if (!unit->HasProperty("latitude")) {
+        throw ModelConfigError(
+            std::format("The latitude of the hydro unit {} is required to compute the PET.", unit->GetId()));
+    }
+    double elevation = unit->HasProperty("elevation") ? unit->GetPropertyDouble("elevation", "m") : 0;
+    forcingPET->SetLocation(unit->GetPropertyDouble("latitude", "degrees"), elevation);
+    for (auto inputType : ForcingPET::GetRequiredForcing(method)) {
+        forcingPET->AttachInputForcing(GetOrCreateForcing(unit, inputType));
+    }
+    unit->AddForcing(std::move(forcingPET));
+
+    return unit->GetForcing(type);
+}
+
 void ModelBuilder::BuildForcingConnections(const BrickSettings& brickSettings, HydroUnit* unit, Brick* brick) {
     for (auto forcingType : brickSettings.forcing) {
-        if (!unit->HasForcing(forcingType)) {
-            unit->AddForcing(std::make_unique<Forcing>(forcingType));
-        }
-
-        auto forcing = unit->GetForcing(forcingType);
+        auto forcing = GetOrCreateForcing(unit, forcingType);
         auto forcingFlux = std::make_unique<FluxForcing>();
         forcingFlux->AttachForcing(forcing);
         brick->AttachFluxIn(std::move(forcingFlux));
@@ -705,11 +784,7 @@ void ModelBuilder::BuildForcingConnections(const BrickSettings& brickSettings, H
 
 void ModelBuilder::BuildForcingConnections(const ProcessSettings& processSettings, HydroUnit* unit, Process* process) {
     for (auto forcingType : processSettings.forcing) {
-        if (!unit->HasForcing(forcingType)) {
-            unit->AddForcing(std::make_unique<Forcing>(forcingType));
-        }
-
-        auto forcing = unit->GetForcing(forcingType);
+        auto forcing = GetOrCreateForcing(unit, forcingType);
         process->AttachForcing(forcing);
     }
 }
@@ -717,16 +792,13 @@ void ModelBuilder::BuildForcingConnections(const ProcessSettings& processSetting
 void ModelBuilder::BuildForcingConnections(const SplitterSettings& splitterSettings, HydroUnit* unit,
                                            Splitter* splitter) {
     for (auto forcingType : splitterSettings.forcing) {
-        if (!unit->HasForcing(forcingType)) {
-            unit->AddForcing(std::make_unique<Forcing>(forcingType));
-        }
-
-        auto forcing = unit->GetForcing(forcingType);
+        auto forcing = GetOrCreateForcing(unit, forcingType);
         splitter->AttachForcing(forcing);
     }
 }
 
 void ModelBuilder::ConnectLoggerToValues(SettingsModel& modelSettings) {
+    HB_TRACE("build", "logger_connection");
     double* valPt = nullptr;
 
     // Sub basin values. The sub-basin is catchment-level and built from the primary
@@ -804,23 +876,62 @@ void ModelBuilder::ConnectLoggerToValues(SettingsModel& modelSettings) {
     }
 
     // Hydro unit values. Labels are the union across structure variants; each unit
-    // connects only the labels its own structure provides (others stay NaN). The
-    // value pointers are therefore keyed by label string, not by position.
+    // connects only the labels its own structure provides (others stay NaN). The label
+    // indices are resolved once per structure variant, in the order the units connect them.
     vecStr hydroUnitLabels = modelSettings.GetHydroUnitLogLabels();
     std::map<string, int> labelIndex;
     for (int i = 0; i < static_cast<int>(hydroUnitLabels.size()); ++i) {
         labelIndex[hydroUnitLabels[i]] = i;
     }
+    vecStr fractionLabels = modelSettings.GetLandCoverBricksNames();
+    std::map<string, int> fractionIndex;
+    for (int i = 0; i < static_cast<int>(fractionLabels.size()); ++i) {
+        fractionIndex[fractionLabels[i]] = i;
+    }
+
+    struct StructureLabels {
+        vecInt values;
+        vecInt fractions;
+    };
+    std::map<int, StructureLabels> structureLabels;
+    auto getStructureLabels = [&](const ModelStructure& structure) -> const StructureLabels& {
+        auto it = structureLabels.find(structure.id);
+        if (it != structureLabels.end()) {
+            return it->second;
+        }
+        StructureLabels& labels = structureLabels[structure.id];
+        for (const auto& brickSettings : structure.hydroUnitBricks) {
+            for (const auto& logItem : brickSettings.logItems) {
+                labels.values.push_back(labelIndex.at(brickSettings.name + ":" + logItem));
+            }
+            for (const auto& processSettings : brickSettings.processes) {
+                for (const auto& logItem : processSettings.logItems) {
+                    labels.values.push_back(
+                        labelIndex.at(brickSettings.name + ":" + processSettings.name + ":" + logItem));
+                }
+            }
+        }
+        for (const auto& splitterSettings : structure.hydroUnitSplitters) {
+            for (const auto& logItem : splitterSettings.logItems) {
+                labels.values.push_back(labelIndex.at(splitterSettings.name + ":" + logItem));
+            }
+        }
+        for (int iBrickType : structure.landCoverBricks) {
+            labels.fractions.push_back(fractionIndex.at(structure.hydroUnitBricks[iBrickType].name));
+        }
+        return labels;
+    };
     std::set<int> etIndicesSeen;  // an ET label must be registered once, not once per unit
 
     for (int iUnit = 0; iUnit < _subBasin->GetHydroUnitCount(); ++iUnit) {
         auto unit = _subBasin->GetHydroUnit(iUnit);
-        modelSettings.SelectStructure(unit->GetStructureId());
+        const ModelStructure* structure = modelSettings.GetStructure(unit->GetStructureId());
+        assert(structure);
+        const StructureLabels& labels = getStructureLabels(*structure);
+        size_t iLabel = 0;
 
-        for (int iBrickType = 0; iBrickType < modelSettings.GetHydroUnitBrickCount(); ++iBrickType) {
-            modelSettings.SelectHydroUnitBrick(iBrickType);
-            const BrickSettings& brickSettings = modelSettings.GetHydroUnitBrickSettings(iBrickType);
-            Brick* brick = unit->GetBrick(brickSettings.name);
+        for (const auto& brickSettings : structure->hydroUnitBricks) {
+            Brick* brick = unit->GetBrick(brickSettings.symbol);
 
             for (const auto& logItem : brickSettings.logItems) {
                 valPt = brick->GetBaseValuePointer(logItem);
@@ -833,12 +944,11 @@ void ModelBuilder::ConnectLoggerToValues(SettingsModel& modelSettings) {
                                     "{} brick {}",
                                     logItem, iUnit, brickSettings.name));
                 }
-                _logger->SetHydroUnitValuePointer(iUnit, labelIndex.at(brickSettings.name + ":" + logItem), valPt);
+                _logger->SetHydroUnitValuePointer(iUnit, labels.values[iLabel++], valPt);
             }
 
-            for (int iProcess = 0; iProcess < modelSettings.GetProcessCount(); ++iProcess) {
-                modelSettings.SelectProcess(iProcess);
-                const ProcessSettings& processSettings = modelSettings.GetProcessSettings(iProcess);
+            for (int iProcess = 0; iProcess < static_cast<int>(brickSettings.processes.size()); ++iProcess) {
+                const ProcessSettings& processSettings = brickSettings.processes[iProcess];
 
                 for (const auto& logItem : processSettings.logItems) {
                     Process* process = brick->GetProcess(iProcess);
@@ -849,7 +959,7 @@ void ModelBuilder::ConnectLoggerToValues(SettingsModel& modelSettings) {
                                         "unit {} process {} of brick {}",
                                         logItem, iUnit, processSettings.name, brickSettings.name));
                     }
-                    int idx = labelIndex.at(brickSettings.name + ":" + processSettings.name + ":" + logItem);
+                    int idx = labels.values[iLabel++];
                     _logger->SetHydroUnitValuePointer(iUnit, idx, valPt);
                     if (logItem == "output" && process->ToAtmosphere() && etIndicesSeen.insert(idx).second) {
                         _logger->AddHydroUnitEtIndex(idx);
@@ -858,9 +968,8 @@ void ModelBuilder::ConnectLoggerToValues(SettingsModel& modelSettings) {
             }
         }
 
-        for (int iSplitter = 0; iSplitter < modelSettings.GetHydroUnitSplitterCount(); ++iSplitter) {
-            modelSettings.SelectHydroUnitSplitter(iSplitter);
-            const SplitterSettings& splitterSettings = modelSettings.GetHydroUnitSplitterSettings(iSplitter);
+        for (int iSplitter = 0; iSplitter < static_cast<int>(structure->hydroUnitSplitters.size()); ++iSplitter) {
+            const SplitterSettings& splitterSettings = structure->hydroUnitSplitters[iSplitter];
 
             for (const auto& logItem : splitterSettings.logItems) {
                 valPt = unit->GetSplitter(iSplitter)->GetValuePointer(logItem);
@@ -870,26 +979,14 @@ void ModelBuilder::ConnectLoggerToValues(SettingsModel& modelSettings) {
                                     "{} splitter {}",
                                     logItem, iUnit, splitterSettings.name));
                 }
-                _logger->SetHydroUnitValuePointer(iUnit, labelIndex.at(splitterSettings.name + ":" + logItem), valPt);
+                _logger->SetHydroUnitValuePointer(iUnit, labels.values[iLabel++], valPt);
             }
         }
-    }
-
-    // Fractions. Same per-unit, union-keyed approach as the hydro-unit values.
-    vecStr fractionLabels = modelSettings.GetLandCoverBricksNames();
-    std::map<string, int> fractionIndex;
-    for (int i = 0; i < static_cast<int>(fractionLabels.size()); ++i) {
-        fractionIndex[fractionLabels[i]] = i;
-    }
-
-    for (int iUnit = 0; iUnit < _subBasin->GetHydroUnitCount(); ++iUnit) {
-        auto unit = _subBasin->GetHydroUnit(iUnit);
-        modelSettings.SelectStructure(unit->GetStructureId());
 
-        for (int iBrickType : modelSettings.GetLandCoverBricksIndices()) {
-            modelSettings.SelectHydroUnitBrick(iBrickType);
-            const BrickSettings& brickSettings = modelSettings.GetHydroUnitBrickSettings(iBrickType);
-            LandCover* brick = dynamic_cast<LandCover*>(unit->GetBrick(brickSettings.name));
+        // Fractions, with the same per-unit, union-keyed approach as the hydro-unit values.
+        for (size_t iFraction = 0; iFraction < structure->landCoverBricks.size(); ++iFraction) {
+            const BrickSettings& brickSettings = structure->hydroUnitBricks[structure->landCoverBricks[iFraction]];
+            LandCover* brick = dynamic_cast<LandCover*>(unit->GetBrick(brickSettings.symbol));
             valPt = brick->GetAreaFractionPointer();
 
             if (valPt == nullptr) {
@@ -898,7 +995,7 @@ void ModelBuilder::ConnectLoggerToValues(SettingsModel& modelSettings) {
                                 "cover brick '{}' in unit {}",
                                 brickSettings.name, iUnit));
             }
-            _logger->SetHydroUnitFractionPointer(iUnit, fractionIndex.at(brickSettings.name), valPt);
+            _logger->SetHydroUnitFractionPointer(iUnit, labels.fractions[iFraction], valPt);
         }
     }
 }
@@ -8,11 +8,13 @@ class SettingsBasin;
 class SubBasin;
 class HydroUnit;
 class Brick;
+class Forcing;
 class Process;
 class Splitter;
 class TimeMachine;
 class Logger;
 struct BrickSettings;
+struct ModelStructure;
 struct ProcessSettings;
 struct SplitterSettings;
 
@@ -33,7 +35,9 @@ class ModelBuilder {
     /**
      * Build the full model structure. The sub-basin components are built from the
      * primary structure (1), then each hydro unit builds the structure variant it was
-     * assigned by AssignHydroUnitStructures.
+     * assigned by AssignHydroUnitStructures. The components of the hydro units are built
+     * concurrently (see SettingsModel::SetBuildThreads); the fluxes between them and to the
+     * sub-basin are then wired serially.
      *
      * @param modelSettings the model settings (defines the structure variants).
      */
@@ -68,14 +72,18 @@ class ModelBuilder {
     SubBasin* _subBasin;
     TimeMachine* _timer;
     Logger* _logger;
+    string _petMethod;
 
     void CreateSubBasinComponents(SettingsModel& modelSettings);
     void CreateHydroUnitsComponents(SettingsModel& modelSettings);
-    void CreateHydroUnitBrick(SettingsModel& modelSettings, HydroUnit* unit, int iBrick);
-    void LinkSurfaceComponentsParents(SettingsModel& modelSettings, HydroUnit* unit);
+    static const ModelStructure& GetStructureSettings(const SettingsModel& modelSettings, HydroUnit* unit);
+    void CreateHydroUnitComponents(const ModelStructure& structure, HydroUnit* unit);
+    void CreateHydroUnitBrick(const BrickSettings& brickSettings, HydroUnit* unit);
+    void LinkSurfaceComponentsParents(const ModelStructure& structure, HydroUnit* unit);
     void LinkSubBasinProcessesTargetBricks(SettingsModel& modelSettings);
     void LinkHydroUnitProcessesTargetBricks(SettingsModel& modelSettings, HydroUnit* unit);
     std::vector<Brick*> FindLandCoversFeeding(const string& targetName, HydroUnit* unit, SettingsModel& modelSettings);
+    Forcing* GetOrCreateForcing(HydroUnit* unit, VariableType type);
     void BuildForcingConnections(const BrickSettings& brickSettings, HydroUnit* unit, Brick* brick);
     void BuildForcingConnections(const ProcessSettings& processSettings, HydroUnit* unit, Process* process);
     void BuildForcingConnections(const SplitterSettings& splitterSettings, HydroUnit* unit, Splitter* splitter);
@@ -4,8 +4,10 @@
 #include <memory>
 #include <stdexcept>
 
+#include "ForcingPET.h"
 #include "Includes.h"
 #include "ModelBuilder.h"
+#include "Tracer.h"
 
 ModelHydro::ModelHydro(SubBasin* subBasin)
     : _subBasin(subBasin) {
@@ -32,6 +34,8 @@ ModelResult ModelHydro::InitializeWithBasin(SettingsModel& modelSettings, Settin
 }
 
 ModelResult ModelHydro::Initialize(SettingsModel& modelSettings, SettingsBasin& basinSettings, bool checkProcesses) {
+    HB_TRACE("model", "initialize");
+
     try {
         if (!modelSettings.IsValid()) {
             return std::unexpected("Model settings are not valid.");
@@ -45,6 +49,12 @@ ModelResult ModelHydro::Initialize(SettingsModel& modelSettings, SettingsBasin&
         if (!_timer.IsValid()) {
             return std::unexpected("Timer initialization failed validation.");
         }
+        for (Parameter* parameter : modelSettings.GetParametersWithModifier()) {
+            _parametersUpdater.AddParameter(parameter);
+        }
+        if (modelSettings.GetTimerSettings().parameterTrajectories) {
+            _parametersUpdater.BuildTrajectories(_timer);
+        }
 
         // Convert the spin-up duration into time steps; a spin-up longer than the
         // modelling period degrades to replaying the whole period once.
@@ -56,7 +66,7 @@ ModelResult ModelHydro::Initialize(SettingsModel& modelSettings, SettingsBasin&
         if (modelSettings.LogAll() || modelSettings.RecordsFractions()) {
             _logger.RecordFractions();
         }
-        _logger.InitContainers(_timer.GetTimeStepCount(), _subBasin, modelSettings);
+        _logger.InitContainers(_timer, _subBasin, modelSettings);
         if (auto r = _subBasin->AssignFractions(basinSettings); !r) {
             return r;
         }
@@ -98,6 +108,9 @@ bool ModelHydro::ForcingLoaded() const {
 }
 
 ModelResult ModelHydro::Run() {
+    Profiler::Scope profilerScope(_profilingEnabled ? &_profiler : nullptr);
+    _processor.GetDiagnostics().Reset();
+
     if (auto r = InitializeTimeSeries(); !r) {
         return r;
     }
@@ -114,7 +127,10 @@ ModelResult ModelHydro::Run() {
     // flood the output during calibration (thousands of runs).
     LogDebug("Simulation starting.");
 
-    while (!_timer.IsOver()) {
+    HB_TRACE_STEPS("main_loop");
+    for (int step = 0; !_timer.IsOver(); ++step) {
+        HB_TRACE_STEP(step);
+        ApplyInflow(step);
         if (!_processor.ProcessTimeStep(*_timer.GetTimeStepPointer())) {
             return std::unexpected("Time step processing failed.");
         }
@@ -133,6 +149,7 @@ ModelResult ModelHydro::Run() {
 }
 
 ModelResult ModelHydro::RunSpinup() {
+    HB_TRACE("model", "spinup");
     LogDebug("Spin-up starting ({} time steps).", _spinupSteps);
 
     // Actions and date-driven parameter updates must not fire during the spin-up: the
@@ -144,6 +161,7 @@ ModelResult ModelHydro::RunSpinup() {
 
     ModelResult result{};
     for (int i = 0; i < _spinupSteps; ++i) {
+        ApplyInflow(i);
         if (!_processor.ProcessTimeStep(*_timer.GetTimeStepPointer())) {
             result = std::unexpected("Time step processing failed during spin-up.");
             break;
@@ -180,6 +198,12 @@ ModelResult ModelHydro::RewindAfterSpinup() {
     return {};
 }
 
+void ModelHydro::ApplyInflow(int step) {
+    if (step < _inflow.size()) {
+        _subBasin->SetInflow(_inflow[step]);
+    }
+}
+
 void ModelHydro::Reset() {
     _timer.Reset();
     _logger.Reset();
@@ -196,6 +220,15 @@ void ModelHydro::SaveAsInitialState() {
     _subBasin->SaveAsInitialState();
 }
 
+void ModelHydro::EnableProfiling(bool enable) {
+#ifndef USE_PROFILING
+    if (enable) {
+        LogWarning("The profiling instrumentation is not compiled in (USE_PROFILING): the report will be empty.");
+    }
+#endif
+    _profilingEnabled = enable;
+}
+
 bool ModelHydro::DumpOutputs(const string& path) {
     return _logger.DumpOutputs(path);
 }
@@ -208,10 +241,18 @@ double ModelHydro::GetTotalOutletDischarge() const {
     return _logger.GetTotalOutletDischarge();
 }
 
+double ModelHydro::GetTotalInflow() const {
+    return _logger.GetTotalInflow();
+}
+
 double ModelHydro::GetTotalET() const {
     return _logger.GetTotalET();
 }
 
+double ModelHydro::GetTotalPrecipitation() const {
+    return _logger.GetTotalPrecipitation();
+}
+
 double ModelHydro::GetTotalWaterStorageChanges() const {
     return _logger.GetTotalWaterStorageChanges();
 }
@@ -262,6 +303,10 @@ axd ModelHydro::GetHydroUnitAreas() const {
     return _logger.GetHydroUnitAreas();
 }
 
+axd ModelHydro::GetHydroUnitTime() const {
+    return _logger.GetHydroUnitTime();
+}
+
 bool ModelHydro::AddTimeSeries(std::unique_ptr<TimeSeries> timeSeries) {
     // Validate time series before adding
     if (!timeSeries->IsValid()) {
@@ -331,6 +376,11 @@ bool ModelHydro::AttachTimeSeriesToHydroUnits() {
             HydroUnit* unit = _subBasin->GetHydroUnit(iUnit);
             if (unit->HasForcing(type)) {
                 Forcing* forcing = unit->GetForcing(type);
+                if (dynamic_cast<ForcingPET*>(forcing)) {
+                    LogError("A PET time series was provided while the PET is computed natively (unit {}).",
+                             unit->GetId());
+                    return false;
+                }
                 forcing->AttachTimeSeriesData(timeSeries->GetDataPointer(unit->GetId()));
 
                 // Validate forcing after attaching data
@@ -342,6 +392,15 @@ bool ModelHydro::AttachTimeSeriesToHydroUnits() {
         }
     }
 
+    // The native PET has no series of its own: check its inputs once everything is attached.
+    for (int iUnit = 0; iUnit < _subBasin->GetHydroUnitCount(); ++iUnit) {
+        HydroUnit* unit = _subBasin->GetHydroUnit(iUnit);
+        if (unit->HasForcing(VariableType::PET) && !unit->GetForcing(VariableType::PET)->IsValid()) {
+            LogError("The PET forcing of unit {} is not valid.", unit->GetId());
+            return false;
+        }
+    }
+
     return true;
 }
 
@@ -357,6 +416,8 @@ ModelResult ModelHydro::InitializeTimeSeries() {
 }
 
 ModelResult ModelHydro::UpdateForcing() {
+    HB_PROFILE("model", "update_forcing");
+
     for (const auto& timeSeries : _timeSeries) {
         if (!timeSeries->AdvanceOneTimeStep()) {
             return std::unexpected("Time series ended before simulation period.");
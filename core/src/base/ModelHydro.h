@@ -7,6 +7,7 @@
 #include "Includes.h"
 #include "Logger.h"
 #include "Processor.h"
+#include "Profiler.h"
 #include "SettingsModel.h"
 #include "SubBasin.h"
 #include "TimeSeries.h"
@@ -82,6 +83,40 @@ class ModelHydro {
      */
     void SaveAsInitialState();
 
+    /**
+     * Enable or disable the profiling of the next runs. The instrumentation must be compiled in
+     * (USE_PROFILING), otherwise the report stays empty.
+     *
+     * @param enable true to profile the runs.
+     */
+    void EnableProfiling(bool enable = true);
+
+    /**
+     * Clear the profiling report.
+     */
+    void ResetProfiling() {
+        _profiler.Reset();
+    }
+
+    /**
+     * Get the cumulative time and call count of the profiled sections, over the profiled runs.
+     *
+     * @return the profiling records, by decreasing time.
+     */
+    [[nodiscard]] vector<ProfilingRecord> GetProfilingReport() const {
+        return _profiler.GetReport();
+    }
+
+    /**
+     * Get the counters of the work done by the solver over the last run (spin-up included), e.g.
+     * to compare the cost of the solvers on a catchment.
+     *
+     * @return the solver diagnostics.
+     */
+    [[nodiscard]] const SolverDiagnostics& GetSolverDiagnostics() const {
+        return _processor.GetDiagnostics();
+    }
+
     /**
      * Dump the outputs as betCDF file to the specified path.
      *
@@ -90,6 +125,16 @@ class ModelHydro {
      */
     bool DumpOutputs(const string& path);
 
+    /**
+     * Set the discharge entering the sub-basin from upstream sub-basins (e.g. in a basin network).
+     * It is added to the outlet discharge at every time step.
+     *
+     * @param inflow The inflow series [mm] (relative to the sub-basin area), one value per time step.
+     */
+    void SetInflow(const axd& inflow) {
+        _inflow = inflow;
+    }
+
     /**
      * Get the outlet discharge series.
      *
@@ -98,12 +143,19 @@ class ModelHydro {
     axd GetOutletDischarge() const;
 
     /**
-     * Get the total outlet discharge.
+     * Get the total outlet discharge. It includes the inflow from the upstream sub-basins.
      *
      * @return total outlet discharge.
      */
     [[nodiscard]] double GetTotalOutletDischarge() const;
 
+    /**
+     * Get the total inflow from the upstream sub-basins, an input of the water balance.
+     *
+     * @return total inflow.
+     */
+    [[nodiscard]] double GetTotalInflow() const;
+
     /**
      * Get the total amount of water lost by evapotranspiration.
      *
@@ -111,6 +163,13 @@ class ModelHydro {
      */
     [[nodiscard]] double GetTotalET() const;
 
+    /**
+     * Get the total precipitation over the hydro units, an input of the water balance.
+     *
+     * @return total precipitation.
+     */
+    [[nodiscard]] double GetTotalPrecipitation() const;
+
     /**
      * Get the total change in water storage.
      *
@@ -287,6 +346,14 @@ class ModelHydro {
      */
     [[nodiscard]] axd GetHydroUnitAreas() const;
 
+    /**
+     * Get the dates (MJD) of the recorded hydro unit series: the time steps, or the start of the
+     * recording periods when the values are aggregated over longer periods.
+     *
+     * @return array of the dates of the recorded hydro unit series.
+     */
+    [[nodiscard]] axd GetHydroUnitTime() const;
+
   protected:
     Processor _processor;
     std::unique_ptr<SubBasin> _ownedSubBasin;  // owning: set only when ModelHydro creates the SubBasin
@@ -297,12 +364,17 @@ class ModelHydro {
     ParametersUpdater _parametersUpdater;
     std::vector<std::unique_ptr<TimeSeries>> _timeSeries;  // owning
     int _spinupSteps = 0;                                  // time steps replayed as spin-up at the start of each run
+    axd _inflow;                                           // mm, from upstream sub-basins (empty: none)
+    Profiler _profiler;
+    bool _profilingEnabled = false;
 
   private:
     ModelResult InitializeTimeSeries();
 
     ModelResult UpdateForcing();
 
+    void ApplyInflow(int step);
+
     ModelResult RunSpinup();
 
     ModelResult RewindAfterSpinup();
@@ -0,0 +1,64 @@
+#include "Parallel.h"
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+int GetThreadsCount(int requested) {
+    if (requested > 0) {
+        return requested;
+    }
+    unsigned int hardware = std::thread::hardware_concurrency();
+
+    return hardware > 0 ? static_cast<int>(hardware) : 1;
+}
+
+void ParallelFor(int count, const std::function<void(int, int)>& body, int threadsNb, int minBlockSize) {
+    if (count <= 0) {
+        return;
+    }
+
+    int blocksNb = std::min(GetThreadsCount(threadsNb), std::max(1, count / std::max(1, minBlockSize)));
+    if (blocksNb <= 1) {
+        body(0, count);
+        return;
+    }
+
+    int blockSize = count / blocksNb;
+    int remainder = count % blocksNb;
+
+    std::exception_ptr error = nullptr;
+    std::mutex errorMutex;
+    std::vector<std::thread> workers;
+    workers.reserve(blocksNb - 1);
+
+    auto runBlock = [&](int start, int end) {
+        try {
+            body(start, end);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    };
+
+    // The calling thread processes the first block itself.
+    int start = blockSize + (remainder > 0 ? 1 : 0);
+    for (int i = 1; i < blocksNb; ++i) {
+        int end = start + blockSize + (i < remainder ? 1 : 0);
+        workers.emplace_back(runBlock, start, end);
+        start = end;
+    }
+    runBlock(0, blockSize + (remainder > 0 ? 1 : 0));
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
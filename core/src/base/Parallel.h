@@ -0,0 +1,28 @@
+#ifndef HYDROBRICKS_PARALLEL_H
+#define HYDROBRICKS_PARALLEL_H
+
+#include <functional>
+
+/**
+ * Get the number of worker threads to use for a parallel section.
+ *
+ * @param requested The requested number of threads (0 or negative: use the hardware concurrency).
+ * @return The number of threads to use (at least 1).
+ */
+int GetThreadsCount(int requested = 0);
+
+/**
+ * Split the range [0, count) into contiguous blocks and process them on worker threads.
+ *
+ * The body is called once per block with the block start (inclusive) and end (exclusive). Blocks
+ * do not overlap, so the body can write to disjoint parts of a shared output without locking. The
+ * first exception thrown by a block is rethrown in the calling thread once all workers joined.
+ *
+ * @param count The size of the range to process.
+ * @param body The function processing one block (start, end).
+ * @param threadsNb The number of threads to use (0: use the hardware concurrency).
+ * @param minBlockSize The minimum number of items per block (avoids spawning threads for small ranges).
+ */
+void ParallelFor(int count, const std::function<void(int, int)>& body, int threadsNb = 0, int minBlockSize = 1);
+
+#endif  // HYDROBRICKS_PARALLEL_H
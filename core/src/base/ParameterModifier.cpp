@@ -95,3 +95,24 @@ float ParameterModifier::UpdateValue(double date) {
 
     return NAN_F;
 }
+
+float ParameterModifier::GetValue(double date, const CalendarStep& calendar) const {
+    int i = NOT_FOUND;
+    switch (_type) {
+        case ParameterModifierType::Yearly:
+            if (!_dates.empty()) {
+                i = Find(&_dates.front(), &_dates.back(), static_cast<double>(calendar.year), 0.0, false);
+            }
+            break;
+        case ParameterModifierType::Monthly:
+            i = calendar.month - 1;
+            break;
+        case ParameterModifierType::Dates:
+            if (!_dates.empty()) {
+                i = Find(&_dates.front(), &_dates.back(), date, 0.0, false);
+            }
+            break;
+    }
+
+    return i >= 0 && i < static_cast<int>(_values.size()) ? _values[i] : NAN_F;
+}
@@ -78,6 +78,16 @@ class ParameterModifier {
      */
     float UpdateValue(double date);
 
+    /**
+     * Get the parameter value for a date from its precomputed calendar, without logging when
+     * the date is not covered by the modifier.
+     *
+     * @param date date in MJD format.
+     * @param calendar calendar of the date.
+     * @return the parameter value, or NaN if the date is not covered.
+     */
+    float GetValue(double date, const CalendarStep& calendar) const;
+
     /**
      * Check if the modifier needs to update for a year change.
      *
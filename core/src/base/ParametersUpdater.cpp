@@ -2,10 +2,15 @@
 
 #include "Parameter.h"
 #include "ParameterModifier.h"
+#include "TimeMachine.h"
 
 ParametersUpdater::ParametersUpdater()
     : _active(false),
-      _previousDate(0) {}
+      _previousDate(0),
+      _previousYear(0),
+      _previousMonth(0),
+      _hasTrajectories(false),
+      _changeCursor(0) {}
 
 void ParametersUpdater::AddParameter(Parameter* parameter) {
     if (!parameter || !parameter->HasModifier()) {
@@ -13,6 +18,7 @@ void ParametersUpdater::AddParameter(Parameter* parameter) {
     }
 
     ParameterModifier* modifier = parameter->GetModifier();
+    _hasTrajectories = false;
 
     if (modifier->UpdatesOnYearChange()) {
         _parametersYearly.push_back(parameter);
@@ -35,14 +41,95 @@ void ParametersUpdater::DateUpdate(double date) {
         return;
     }
 
-    Time prevDate = GetTimeStructFromMJD(_previousDate);
     Time newDate = GetTimeStructFromMJD(date);
+    Update(date, newDate.year, newDate.month);
+}
+
+void ParametersUpdater::DateUpdate(double date, const CalendarStep& calendar) {
+    if (!_active) {
+        return;
+    }
+
+    // The changes are checked against the last update rather than with the flags of the
+    // calendar, as the timer can be reset between runs.
+    Update(date, calendar.year, calendar.month);
+}
+
+void ParametersUpdater::BuildTrajectories(const TimeMachine& timer) {
+    _changeSteps.clear();
+    _changeParameters.clear();
+    _changeValues.clear();
+    _changeCursor = 0;
+    _hasTrajectories = false;
+    if (!_active) {
+        return;
+    }
+
+    struct Change {
+        int step;
+        Parameter* parameter;
+        float value;
+    };
+    vector<Change> changes;
+
+    // The parameters are updated when the timer is incremented (from the second step), and
+    // only when their yearly or monthly value can change.
+    int stepsNb = timer.GetCalendarStepCount();
+    auto addChanges = [&](const vector<Parameter*>& parameters, auto needsUpdate) {
+        for (Parameter* parameter : parameters) {
+            const ParameterModifier* modifier = parameter->GetModifier();
+            float lastValue = NAN_F;
+            for (int step = 1; step < stepsNb; ++step) {
+                const CalendarStep& calendar = timer.GetCalendar(step);
+                if (step > 1 && !needsUpdate(calendar)) {
+                    continue;
+                }
+                float value = modifier->GetValue(timer.GetStepDate(step), calendar);
+                if (std::isnan(value) || value == lastValue) {
+                    continue;
+                }
+                changes.push_back({step, parameter, value});
+                lastValue = value;
+            }
+        }
+    };
+    addChanges(_parametersYearly, [](const CalendarStep& calendar) { return calendar.newYear; });
+    addChanges(_parametersMonthly, [](const CalendarStep& calendar) { return calendar.newMonth; });
+    addChanges(_parametersDates, [](const CalendarStep&) { return true; });
+
+    std::stable_sort(changes.begin(), changes.end(), [](const Change& a, const Change& b) { return a.step < b.step; });
+
+    _changeSteps.reserve(changes.size());
+    _changeParameters.reserve(changes.size());
+    _changeValues.reserve(changes.size());
+    for (const auto& change : changes) {
+        _changeSteps.push_back(change.step);
+        _changeParameters.push_back(change.parameter);
+        _changeValues.push_back(change.value);
+    }
+    _hasTrajectories = true;
+}
+
+void ParametersUpdater::StepUpdate(int step) {
+    assert(_hasTrajectories);
+
+    // The timer was reset: go back to the changes of the current step.
+    if (_changeCursor > 0 && _changeSteps[_changeCursor - 1] >= step) {
+        _changeCursor = std::lower_bound(_changeSteps.begin(), _changeSteps.end(), step) - _changeSteps.begin();
+    }
+
+    while (_changeCursor < _changeSteps.size() && _changeSteps[_changeCursor] <= step) {
+        _changeParameters[_changeCursor]->SetValue(_changeValues[_changeCursor]);
+        _changeCursor++;
+    }
+}
 
-    if (prevDate.year != newDate.year) {
+void ParametersUpdater::Update(double date, int year, int month) {
+    if (_previousYear != year) {
         ChangingYear(date);
         ChangingMonth(date);
         ChangingDate(date);
-    } else if (prevDate.month != newDate.month) {
+    } else if (_previousMonth != month) {
         ChangingMonth(date);
         ChangingDate(date);
     } else {
@@ -50,6 +137,8 @@ void ParametersUpdater::DateUpdate(double date) {
     }
 
     _previousDate = date;
+    _previousYear = year;
+    _previousMonth = month;
 }
 
 void ParametersUpdater::ChangingYear(double date) {
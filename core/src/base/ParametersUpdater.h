@@ -4,6 +4,7 @@
 #include "Includes.h"
 
 class Parameter;
+class TimeMachine;
 
 class ParametersUpdater {
   public:
@@ -25,6 +26,39 @@ class ParametersUpdater {
      */
     void DateUpdate(double date);
 
+    /**
+     * Update the parameters based on the current date, using its precomputed calendar.
+     *
+     * @param date current date in MJD format.
+     * @param calendar calendar of the current date.
+     */
+    void DateUpdate(double date, const CalendarStep& calendar);
+
+    /**
+     * Expand the modifiers of the parameters into a table of the value changes over the time
+     * steps of the timer, so that the updates during the run only apply the precomputed values.
+     * The table is discarded when a parameter is added.
+     *
+     * @param timer the initialized timer of the model.
+     */
+    void BuildTrajectories(const TimeMachine& timer);
+
+    /**
+     * Check if the value changes were precomputed for the time steps.
+     *
+     * @return true if the parameters are updated from their trajectories.
+     */
+    bool HasTrajectories() const {
+        return _hasTrajectories;
+    }
+
+    /**
+     * Update the parameters from their precomputed trajectories.
+     *
+     * @param step index of the current time step of the timer.
+     */
+    void StepUpdate(int step);
+
     /**
      * Get the previous date used for updating parameters.
      *
@@ -56,12 +90,28 @@ class ParametersUpdater {
      */
     void ChangingDate(double date);
 
+    /**
+     * Update the parameters depending on the changes since the previous update.
+     *
+     * @param date new date in MJD format.
+     * @param year year of the new date.
+     * @param month month of the new date.
+     */
+    void Update(double date, int year, int month);
+
   private:
     bool _active;
     double _previousDate;
+    int _previousYear;
+    int _previousMonth;
+    bool _hasTrajectories;
     vector<Parameter*> _parametersYearly;   // non-owning, parameters with yearly modifiers
     vector<Parameter*> _parametersMonthly;  // non-owning, parameters with monthly modifiers
     vector<Parameter*> _parametersDates;    // non-owning, parameters with date modifiers
+    size_t _changeCursor;                   // next change to apply
+    vecInt _changeSteps;                    // time steps of the value changes (sorted)
+    vector<Parameter*> _changeParameters;   // non-owning, parameters of the value changes
+    vecFloat _changeValues;                 // values of the value changes
 };
 
 #endif  // HYDROBRICKS_PARAMETERS_UPDATER_H
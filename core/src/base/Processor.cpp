@@ -1,9 +1,22 @@
 #include "Processor.h"
 
+#include <map>
+#include <typeindex>
+
 #include "FluxToBrick.h"
 #include "ModelHydro.h"
+#include "Profiler.h"
 #include "SubBasin.h"
 
+namespace {
+
+// The processes and bricks are profiled by type (the name when created outside the factories).
+[[maybe_unused]] int RegisterSection(const string& category, std::string_view type, const string& name) {
+    return Profiler::RegisterSection(category, type.empty() ? name : string(type));
+}
+
+}  // namespace
+
 Processor::Processor()
     : _solver(nullptr),
       _model(nullptr),
@@ -22,6 +35,9 @@ void Processor::Initialize(const SolverSettings& solverSettings) {
     _solver->Connect(this);
     ConnectToElementsToSolve();
     ValidateFluxTopology();
+    if (solverSettings.processKernels) {
+        BuildProcessKernels();
+    }
     _solver->InitializeContainers();
     _changeRatesNoSolver = axd::Zero(_directConnectionCount);
 }
@@ -51,6 +67,37 @@ void Processor::ValidateFluxTopology() const {
     }
 }
 
+void Processor::BuildProcessKernels() {
+    // Units of the same structure variant run the same process chain; the sub-basin bricks are
+    // grouped apart (variant 0).
+    std::map<std::pair<int, std::type_index>, ProcessKernel*> groups;
+    int iRate = 0;
+    for (auto brick : _iterableBricks) {
+        int structureId = brick->GetHydroUnit() != nullptr ? brick->GetHydroUnit()->GetStructureId() : 0;
+        for (int i = 0; i < brick->GetProcessCount(); ++i) {
+            auto process = brick->GetProcess(i);
+            auto key = std::make_pair(structureId, std::type_index(typeid(*process)));
+            auto group = groups.find(key);
+            if (group == groups.end()) {
+                std::unique_ptr<ProcessKernel> kernel = process->CreateKernel();
+                group = groups.emplace(key, kernel.get()).first;
+                if (kernel) {
+                    _kernels.push_back(std::move(kernel));
+#ifdef USE_PROFILING
+                    _kernelSections.push_back(RegisterSection("process", process->GetType(), process->GetName()));
+#endif
+                }
+            }
+            bool computedByKernel = group->second != nullptr && process->GetConnectionCount() == 1;
+            if (computedByKernel) {
+                group->second->Add(process, iRate);
+            }
+            _computedByKernel.push_back(computedByKernel);
+            iRate += process->GetConnectionCount();
+        }
+    }
+}
+
 void Processor::SetModel(ModelHydro* model) {
     _model = model;
 }
@@ -73,6 +120,12 @@ void Processor::ConnectToElementsToSolve() {
 
             if (brick->NeedsSolver()) {
                 _iterableBricks.push_back(brick);
+#ifdef USE_PROFILING
+                for (int i = 0; i < brick->GetProcessCount(); ++i) {
+                    Process* process = brick->GetProcess(i);
+                    _processSections.push_back(RegisterSection("process", process->GetType(), process->GetName()));
+                }
+#endif
 
                 // Get state variables from bricks
                 vecDoublePt bricksValues = brick->GetDynamicContentChanges();
@@ -87,6 +140,9 @@ void Processor::ConnectToElementsToSolve() {
             } else {
                 // Count connections
                 _directConnectionCount += brick->GetProcessConnectionCount();
+#ifdef USE_PROFILING
+                _directBrickSections.push_back(RegisterSection("brick", brick->GetType(), brick->GetName()));
+#endif
             }
         }
     }
@@ -97,6 +153,12 @@ void Processor::ConnectToElementsToSolve() {
 
         // Add the bricks need a solver here
         _iterableBricks.push_back(brick);
+#ifdef USE_PROFILING
+        for (int i = 0; i < brick->GetProcessCount(); ++i) {
+            Process* process = brick->GetProcess(i);
+            _processSections.push_back(RegisterSection("process", process->GetType(), process->GetName()));
+        }
+#endif
 
         // Get state variables from bricks
         vecDoublePt bricksValues = brick->GetDynamicContentChanges();
@@ -144,11 +206,31 @@ void Processor::ResetState() {
 }
 
 void Processor::EvaluateRates(axd& rates, double timeStepInDays, bool applyConstraints) {
+    HB_PROFILE("solver", "evaluate_rates");
+    _diagnostics.rateEvaluations += static_cast<long long>(_iterableBricks.size());
+
+    for (size_t iKernel = 0; iKernel < _kernels.size(); ++iKernel) {
+        HB_PROFILE_SECTION(_kernelSections[iKernel]);
+        _kernels[iKernel]->EvaluateRates(rates);
+    }
+
     int iRate = 0;
+    int iProcess = 0;
     for (auto brick : _iterableBricks) {
-        for (int i = 0; i < brick->GetProcessCount(); ++i) {
+        for (int i = 0; i < brick->GetProcessCount(); ++i, ++iProcess) {
             auto process = brick->GetProcess(i);
 
+            // The rate was already computed by the kernel of the process group.
+            if (!_computedByKernel.empty() && _computedByKernel[iProcess]) {
+                if (applyConstraints) {
+                    process->StoreInOutgoingFlux(&rates(iRate), 0);
+                }
+                iRate++;
+                continue;
+            }
+
+            HB_PROFILE_SECTION(_processSections[iProcess]);
+
             // Get the change rates (per day) independently of the time step and constraints (null bricks handled).
             // Reference into the process's reusable buffer; consumed below before the next process is queried.
             const vecDouble& processRates = process->GetChangeRates();
@@ -197,6 +279,8 @@ void Processor::EnforceConstraints(axd& rates, double timeStepInDays) {
     // two sweeps (the second one confirming the first).
     constexpr int maxSweeps = 10;
     for (int sweep = 0; sweep < maxSweeps; ++sweep) {
+        HB_PROFILE("solver", "constraint_sweep");
+        _diagnostics.constraintSweeps++;
         _ratesBeforeSweep = rates;
         for (auto brick : _iterableBricks) {
             brick->ApplyConstraints(timeStepInDays);
@@ -205,10 +289,13 @@ void Processor::EnforceConstraints(axd& rates, double timeStepInDays) {
             return;
         }
     }
+    _diagnostics.sweepLimitHits++;
     LogWarning("The storage constraints did not stabilize after {} sweeps.", maxSweeps);
 }
 
 void Processor::ApplyRates(const axd& rates, double timeStepInDays) {
+    HB_PROFILE("solver", "apply_rates");
+
     int iRate = 0;
     for (auto brick : _iterableBricks) {
         if (brick->IsNull()) {
@@ -239,8 +326,12 @@ bool Processor::ProcessTimeStep(double timeStepInDays) {
 
     SubBasin* basin = _model->GetSubBasin();
 
+    // The storage constraints count their clamped fluxes in the current diagnostics.
+    SolverDiagnostics::Scope diagnosticsScope(&_diagnostics);
+
     // Process the bricks that do not need a solver.
     int ptIndex = 0;
+    [[maybe_unused]] int iDirectBrick = 0;
     int hydroUnitCount = basin->GetHydroUnitCount();
     for (int iUnit = 0; iUnit < hydroUnitCount; ++iUnit) {
         HydroUnit* unit = basin->GetHydroUnit(iUnit);
@@ -255,6 +346,8 @@ bool Processor::ProcessTimeStep(double timeStepInDays) {
             if (brick->NeedsSolver()) {
                 continue;
             }
+            HB_PROFILE_SECTION(_directBrickSections[iDirectBrick]);
+            iDirectBrick++;
             if (brick->IsNull()) {
                 continue;
             }
@@ -264,8 +357,11 @@ bool Processor::ProcessTimeStep(double timeStepInDays) {
     }
 
     // Process the bricks that need a solver
-    if (!_solver->Solve(timeStepInDays)) {
-        return false;
+    {
+        HB_PROFILE("solver", "solve");
+        if (!_solver->Solve(timeStepInDays)) {
+            return false;
+        }
     }
 
     if (!basin->ComputeOutletDischarge()) {
@@ -5,7 +5,9 @@
 
 #include "Brick.h"
 #include "Includes.h"
+#include "ProcessKernel.h"
 #include "Solver.h"
+#include "SolverDiagnostics.h"
 
 class ModelHydro;
 
@@ -137,6 +139,15 @@ class Processor {
         return _iterableBricks;
     }
 
+    /**
+     * Get the number of process kernels used to evaluate the solvable rates.
+     *
+     * @return the number of process kernels.
+     */
+    int GetProcessKernelCount() const {
+        return static_cast<int>(_kernels.size());
+    }
+
     /**
      * Get the number of direct connections.
      *
@@ -146,6 +157,24 @@ class Processor {
         return _directConnectionCount;
     }
 
+    /**
+     * Get the counters of the work done by the solver since they were last reset.
+     *
+     * @return the solver diagnostics.
+     */
+    SolverDiagnostics& GetDiagnostics() {
+        return _diagnostics;
+    }
+
+    /**
+     * Get the counters of the work done by the solver since they were last reset.
+     *
+     * @return the solver diagnostics.
+     */
+    const SolverDiagnostics& GetDiagnostics() const {
+        return _diagnostics;
+    }
+
   protected:
     std::unique_ptr<Solver> _solver;  // owning
     ModelHydro* _model;               // non-owning reference
@@ -154,7 +183,13 @@ class Processor {
     vecDoublePt _stateVariableChanges;
     vector<Brick*> _iterableBricks;  // non-owning views into HydroUnits/SubBasin
     axd _changeRatesNoSolver;
-    axd _ratesBeforeSweep;  // scratch buffer for the constraint fixpoint iteration
+    axd _ratesBeforeSweep;                            // scratch buffer for the constraint fixpoint iteration
+    vector<std::unique_ptr<ProcessKernel>> _kernels;  // owning
+    vector<bool> _computedByKernel;                   // per solvable process, in processing order
+    vecInt _processSections;                          // profiled section per solvable process (USE_PROFILING)
+    vecInt _kernelSections;                           // profiled section per process kernel (USE_PROFILING)
+    vecInt _directBrickSections;                      // profiled section per direct brick (USE_PROFILING)
+    SolverDiagnostics _diagnostics;                   // counters of the solver work
 
   private:
     /**
@@ -165,6 +200,12 @@ class Processor {
      */
     void ValidateFluxTopology() const;
 
+    /**
+     * Group the solvable processes by structure variant and process type, and create a kernel
+     * for each group whose process type provides one.
+     */
+    void BuildProcessKernels();
+
     /**
      * Store the state variable changes.
      *
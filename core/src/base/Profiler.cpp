@@ -0,0 +1,76 @@
+#include "Profiler.h"
+
+#include <mutex>
+
+namespace {
+
+thread_local Profiler* currentProfiler = nullptr;
+
+// Sections registered by all the models of the process (category and name).
+struct SectionRegistry {
+    std::mutex mutex;
+    vector<std::pair<string, string>> sections;
+};
+
+SectionRegistry& GetSectionRegistry() {
+    static SectionRegistry registry;
+    return registry;
+}
+
+}  // namespace
+
+int Profiler::RegisterSection(const string& category, const string& name) {
+    SectionRegistry& registry = GetSectionRegistry();
+    std::lock_guard lock(registry.mutex);
+    auto section = std::make_pair(category, name);
+    auto it = std::ranges::find(registry.sections, section);
+    if (it != registry.sections.end()) {
+        return static_cast<int>(std::distance(registry.sections.begin(), it));
+    }
+    registry.sections.push_back(section);
+
+    return static_cast<int>(registry.sections.size()) - 1;
+}
+
+void Profiler::Add(int sectionId, double time) {
+    assert(sectionId >= 0);
+    if (sectionId >= static_cast<int>(_times.size())) {
+        _times.resize(sectionId + 1, 0);
+        _calls.resize(sectionId + 1, 0);
+    }
+    _times[sectionId] += time;
+    _calls[sectionId]++;
+}
+
+void Profiler::Reset() {
+    _times.clear();
+    _calls.clear();
+}
+
+vector<ProfilingRecord> Profiler::GetReport() const {
+    SectionRegistry& registry = GetSectionRegistry();
+    std::lock_guard lock(registry.mutex);
+    vector<ProfilingRecord> report;
+    for (int i = 0; i < static_cast<int>(_calls.size()); ++i) {
+        if (_calls[i] > 0) {
+            const auto& [category, name] = registry.sections[i];
+            report.push_back({category, name, _calls[i], _times[i]});
+        }
+    }
+    std::ranges::sort(report, std::ranges::greater(), &ProfilingRecord::time);
+
+    return report;
+}
+
+Profiler* Profiler::GetCurrent() {
+    return currentProfiler;
+}
+
+Profiler::Scope::Scope(Profiler* profiler)
+    : _previous(currentProfiler) {
+    currentProfiler = profiler;
+}
+
+Profiler::Scope::~Scope() {
+    currentProfiler = _previous;
+}
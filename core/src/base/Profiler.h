@@ -0,0 +1,142 @@
+#ifndef HYDROBRICKS_PROFILER_H
+#define HYDROBRICKS_PROFILER_H
+
+#include <chrono>
+
+#include "Includes.h"
+
+/**
+ * Cumulative time and call count of a profiled section of the model run.
+ */
+struct ProfilingRecord {
+    string category;  // e.g. "process", "brick", "solver" or "model"
+    string name;      // e.g. the process or brick type, or the solver stage
+    long long calls;
+    double time;  // [s]
+};
+
+/**
+ * Collects the time spent in the instrumented sections of the model run (processes and bricks
+ * by type, solver stages, logger, forcing and actions).
+ *
+ * The instrumentation is opt-in at compile time (USE_PROFILING) and at run time: the sections are
+ * only timed while a profiler is in use by the current thread, through a Scope. The sections are
+ * registered once (e.g. when the model is built) and identified by an index afterwards, so that
+ * timing a section costs two clock reads. Nested sections are timed inclusively.
+ *
+ * A profiler is not thread-safe: it is used by the thread running the model.
+ */
+class Profiler {
+  public:
+    Profiler() = default;
+
+    virtual ~Profiler() = default;
+
+    /**
+     * Register a section to profile (shared by all profilers). Registering a section twice
+     * returns the same index.
+     *
+     * @param category The category of the section.
+     * @param name The name of the section.
+     * @return The index of the section.
+     */
+    static int RegisterSection(const string& category, const string& name);
+
+    /**
+     * Add the time spent in a section.
+     *
+     * @param sectionId The index of the section.
+     * @param time The time spent in the section [s].
+     */
+    void Add(int sectionId, double time);
+
+    /**
+     * Clear the collected times.
+     */
+    void Reset();
+
+    /**
+     * Get the cumulative time and call count of the sections that were called.
+     *
+     * @return The records, by decreasing time.
+     */
+    [[nodiscard]] vector<ProfilingRecord> GetReport() const;
+
+    /**
+     * Get the profiler used by the current thread.
+     *
+     * @return The current profiler, or nullptr if the run is not profiled.
+     */
+    static Profiler* GetCurrent();
+
+    /**
+     * Use a profiler for the sections run by the current thread while the scope is alive.
+     */
+    class Scope {
+      public:
+        explicit Scope(Profiler* profiler);
+
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+      private:
+        Profiler* _previous;  // non-owning reference
+    };
+
+  protected:
+    vecDouble _times;
+    vector<long long> _calls;
+};
+
+/**
+ * Times a profiled section from its construction to its destruction, if a profiler is in use.
+ */
+class ProfiledSection {
+  public:
+    explicit ProfiledSection(int sectionId)
+        : _profiler(Profiler::GetCurrent()),
+          _sectionId(sectionId) {
+        if (_profiler != nullptr) {
+            _start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ProfiledSection() {
+        if (_profiler != nullptr) {
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - _start;
+            _profiler->Add(_sectionId, elapsed.count());
+        }
+    }
+
+    ProfiledSection(const ProfiledSection&) = delete;
+    ProfiledSection& operator=(const ProfiledSection&) = delete;
+
+  private:
+    Profiler* _profiler;  // non-owning reference
+    int _sectionId;
+    std::chrono::steady_clock::time_point _start;
+};
+
+#define HB_PROFILE_CONCAT_IMPL(a, b) a##b
+#define HB_PROFILE_CONCAT(a, b) HB_PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef USE_PROFILING
+/**
+ * Time the rest of the enclosing block as a registered section (index).
+ */
+#define HB_PROFILE_SECTION(sectionId) ProfiledSection HB_PROFILE_CONCAT(profiledSection, __LINE__)(sectionId)
+
+/**
+ * Time the rest of the enclosing block as a section registered on first use.
+ */
+#define HB_PROFILE(category, name)                                                                             \
+    static const int HB_PROFILE_CONCAT(profiledSectionId, __LINE__) = Profiler::RegisterSection(category, name); \
+    ProfiledSection HB_PROFILE_CONCAT(profiledSection, __LINE__)(HB_PROFILE_CONCAT(profiledSectionId, __LINE__))
+#else
+#define HB_PROFILE_SECTION(sectionId)
+#define HB_PROFILE(category, name)
+#endif
+
+#endif  // HYDROBRICKS_PROFILER_H
@@ -4,12 +4,15 @@
 #include <fstream>
 
 #include "FileNetcdf.h"
+#include "Tracer.h"
 
-bool ResultWriter::WriteNetCDF(const string& path, const axd& time, const vecInt& hydroUnitIds,
-                               const vecInt& hydroUnitStructureIds, const axd& hydroUnitAreas,
-                               const vecStr& subBasinLabels, const vecAxd& subBasinValues,
+bool ResultWriter::WriteNetCDF(const string& path, const axd& time, const axd& hydroUnitTime,
+                               const vecInt& hydroUnitIds, const vecInt& hydroUnitStructureIds,
+                               const axd& hydroUnitAreas, const vecStr& subBasinLabels, const vecAxd& subBasinValues,
                                const vecStr& hydroUnitLabels, const vecAxxd& hydroUnitValues,
                                const vecStr& hydroUnitFractionLabels, const vecAxxd& hydroUnitFractions) {
+    HB_TRACE("io", "write_netcdf");
+
     if (!std::filesystem::is_directory(path)) {
         LogError("The directory {} could not be found.", path);
         return false;
@@ -28,6 +31,12 @@ bool ResultWriter::WriteNetCDF(const string& path, const axd& time, const vecInt
 
         // Create dimensions
         int dimIdTime = file.DefDim("time", (int)time.size());
+        // The hydro unit values get their own time dimension when aggregated over longer periods.
+        bool aggregatedHydroUnits = hydroUnitTime.size() != time.size();
+        int dimIdHydroUnitTime = dimIdTime;
+        if (aggregatedHydroUnits) {
+            dimIdHydroUnitTime = file.DefDim("hydro_units_time", (int)hydroUnitTime.size());
+        }
         int dimIdUnit = file.DefDim("hydro_units", (int)hydroUnitIds.size());
         int dimIdItemsAgg = file.DefDim("aggregated_values", (int)subBasinLabels.size());
         int dimIdItemsDist = file.DefDim("distributed_values", (int)hydroUnitLabels.size());
@@ -43,6 +52,13 @@ bool ResultWriter::WriteNetCDF(const string& path, const axd& time, const vecInt
         file.PutAttText("long_name", "time", varId);
         file.PutAttText("units", "days since 1858-11-17 00:00:00.0", varId);
 
+        if (aggregatedHydroUnits) {
+            varId = file.DefVarDouble("hydro_units_time", {dimIdHydroUnitTime});
+            file.PutVar(varId, hydroUnitTime);
+            file.PutAttText("long_name", "start of the recording periods of the hydrological units values", varId);
+            file.PutAttText("units", "days since 1858-11-17 00:00:00.0", varId);
+        }
+
         varId = file.DefVarInt("hydro_units_ids", {dimIdUnit});
         file.PutVar(varId, hydroUnitIds);
         file.PutAttText("long_name", "hydrological units ids", varId);
@@ -60,13 +76,13 @@ bool ResultWriter::WriteNetCDF(const string& path, const axd& time, const vecInt
         file.PutAttText("long_name", "aggregated values over the sub basin", varId);
         file.PutAttText("units", "mm", varId);
 
-        varId = file.DefVarDouble("hydro_units_values", {dimIdItemsDist, dimIdUnit, dimIdTime}, 3, true);
+        varId = file.DefVarDouble("hydro_units_values", {dimIdItemsDist, dimIdUnit, dimIdHydroUnitTime}, 3, true);
         file.PutVar(varId, hydroUnitValues);
         file.PutAttText("long_name", "values for each hydrological units", varId);
         file.PutAttText("units", "mm", varId);
 
         if (recordFractions) {
-            varId = file.DefVarDouble("land_cover_fractions", {dimIdFractions, dimIdUnit, dimIdTime}, 3, true);
+            varId = file.DefVarDouble("land_cover_fractions", {dimIdFractions, dimIdUnit, dimIdHydroUnitTime}, 3, true);
             file.PutVar(varId, hydroUnitFractions);
             file.PutAttText("long_name", "land cover fractions for each hydrological units", varId);
             file.PutAttText("units", "percent", varId);
@@ -21,6 +21,8 @@ class ResultWriter {
      *
      * @param path Directory path where the output file will be created.
      * @param time Time series vector.
+     * @param hydroUnitTime Time series vector of the hydro unit values and fractions (start dates of
+     * their recording periods).
      * @param hydroUnitIds Vector of hydro unit IDs.
      * @param hydroUnitStructureIds Vector of the model-structure variant ID used by each hydro unit.
      * @param hydroUnitAreas Vector of hydro unit areas.
@@ -32,7 +34,7 @@ class ResultWriter {
      * @param hydroUnitFractions Vector of 2D fraction arrays (optional).
      * @return true if successful, false otherwise.
      */
-    bool WriteNetCDF(const string& path, const axd& time, const vecInt& hydroUnitIds,
+    bool WriteNetCDF(const string& path, const axd& time, const axd& hydroUnitTime, const vecInt& hydroUnitIds,
                      const vecInt& hydroUnitStructureIds, const axd& hydroUnitAreas, const vecStr& subBasinLabels,
                      const vecAxd& subBasinValues, const vecStr& hydroUnitLabels, const vecAxxd& hydroUnitValues,
                      const vecStr& hydroUnitFractionLabels = vecStr(), const vecAxxd& hydroUnitFractions = vecAxxd());
@@ -6,12 +6,14 @@
 
 #include "BrickTypes.h"
 #include "ContentTypes.h"
+#include "ForcingPET.h"
 #include "Parameter.h"
 #include "Process.h"
 
 SettingsModel::SettingsModel()
     : _logAll(false),
       _recordFractions(false),
+      _buildThreads(0),
       _selectedStructure(nullptr),
       _selectedBrick(nullptr),
       _selectedProcess(nullptr),
@@ -28,6 +30,21 @@ void SettingsModel::SetSolver(const string& solverName) {
     _solver.name = solverName;
 }
 
+void SettingsModel::SetProcessKernels(bool enable) {
+    _solver.processKernels = enable;
+}
+
+void SettingsModel::SetParameterTrajectories(bool enable) {
+    _timer.parameterTrajectories = enable;
+}
+
+void SettingsModel::SetPETMethod(const string& method) {
+    if (!method.empty()) {
+        ForcingPET::GetMethodFromName(method);  // Throws if the method is not available
+    }
+    _petMethod = method;
+}
+
 void SettingsModel::SetTimer(const string& start, const string& end, int timeStep, const string& timeStepUnit) {
     _timer.start = start;
     _timer.end = end;
@@ -42,11 +59,52 @@ void SettingsModel::SetSpinupDays(int days) {
     _timer.spinupDays = days;
 }
 
+void SettingsModel::SetHydroUnitLogPeriod(const string& period) {
+    if (period == "step") {
+        _logger.hydroUnitPeriod = LogPeriod::Step;
+    } else if (period == "day") {
+        _logger.hydroUnitPeriod = LogPeriod::Day;
+    } else if (period == "month") {
+        _logger.hydroUnitPeriod = LogPeriod::Month;
+    } else if (period == "year") {
+        _logger.hydroUnitPeriod = LogPeriod::Year;
+    } else {
+        throw InputError(std::format("The logging period '{}' is not recognized.", period));
+    }
+}
+
+void SettingsModel::SetLogAggregation(const string& label, const string& aggregation) {
+    LogAggregation value;
+    if (aggregation == "sum") {
+        value = LogAggregation::Sum;
+    } else if (aggregation == "mean") {
+        value = LogAggregation::Mean;
+    } else if (aggregation == "last") {
+        value = LogAggregation::Last;
+    } else if (aggregation == "min") {
+        value = LogAggregation::Min;
+    } else if (aggregation == "max") {
+        value = LogAggregation::Max;
+    } else {
+        throw InputError(std::format("The logging aggregation '{}' is not recognized.", aggregation));
+    }
+
+    for (size_t i = 0; i < _logger.aggregatedLabels.size(); ++i) {
+        if (_logger.aggregatedLabels[i] == label) {
+            _logger.aggregations[i] = value;
+            return;
+        }
+    }
+    _logger.aggregatedLabels.push_back(label);
+    _logger.aggregations.push_back(value);
+}
+
 void SettingsModel::AddHydroUnitBrick(const string& name, const string& type) {
     assert(_selectedStructure);
 
     BrickSettings brick;
     brick.name = name;
+    brick.symbol = Symbol(name);
     brick.type = type;
 
     _selectedStructure->hydroUnitBricks.push_back(brick);
@@ -67,6 +125,7 @@ void SettingsModel::AddSubBasinBrick(const string& name, const string& type) {
 
     BrickSettings brick;
     brick.name = name;
+    brick.symbol = Symbol(name);
     brick.type = type;
 
     _selectedStructure->subBasinBricks.push_back(brick);
@@ -104,6 +163,7 @@ void SettingsModel::AddSurfaceComponentBrick(const string& name, const string& t
 void SettingsModel::SetSurfaceComponentParent(const string& name) {
     assert(_selectedBrick);
     _selectedBrick->parent = name;
+    _selectedBrick->parentSymbol = Symbol(name);
 }
 
 void SettingsModel::AddBrickParameter(const string& name, float value, const string& type) {
@@ -272,6 +332,7 @@ void SettingsModel::AddProcessOutput(const string& target, ContentType fluxType)
 
     OutputSettings outputSettings;
     outputSettings.target = target;
+    outputSettings.targetSymbol = Symbol(target);
     outputSettings.fluxType = fluxType;
     _selectedProcess->outputs.push_back(outputSettings);
 }
@@ -298,6 +359,7 @@ void SettingsModel::OutputProcessToSameBrick() {
 
     OutputSettings outputSettings;
     outputSettings.target = _selectedBrick->name;
+    outputSettings.targetSymbol = _selectedBrick->symbol;
     outputSettings.isInstantaneous = true;
     _selectedProcess->outputs.push_back(outputSettings);
 }
@@ -307,6 +369,7 @@ void SettingsModel::AddHydroUnitSplitter(const string& name, const string& type)
 
     SplitterSettings splitter;
     splitter.name = name;
+    splitter.symbol = Symbol(name);
     splitter.type = type;
 
     _selectedStructure->hydroUnitSplitters.push_back(splitter);
@@ -318,6 +381,7 @@ void SettingsModel::AddSubBasinSplitter(const string& name, const string& type)
 
     SplitterSettings splitter;
     splitter.name = name;
+    splitter.symbol = Symbol(name);
     splitter.type = type;
 
     _selectedStructure->subBasinSplitters.push_back(splitter);
@@ -380,6 +444,7 @@ void SettingsModel::AddSplitterOutput(const string& target, const ContentType fl
 
     OutputSettings outputSettings;
     outputSettings.target = target;
+    outputSettings.targetSymbol = Symbol(target);
     outputSettings.fluxType = fluxType;
     _selectedSplitter->outputs.push_back(outputSettings);
 }
@@ -390,6 +455,7 @@ void SettingsModel::ChangeSplitterOutputTarget(const string& currentTarget, cons
     for (auto& output : _selectedSplitter->outputs) {
         if (output.target == currentTarget) {
             output.target = newTarget;
+            output.targetSymbol = Symbol(newTarget);
             return;
         }
     }
@@ -404,6 +470,7 @@ bool SettingsModel::ChangeSplitterOutputTargetIfFound(const string& currentTarge
     for (auto& output : _selectedSplitter->outputs) {
         if (output.target == currentTarget) {
             output.target = newTarget;
+            output.targetSymbol = Symbol(newTarget);
             return true;
         }
     }
@@ -666,6 +733,16 @@ bool SettingsModel::SelectStructure(int id) {
     return false;
 }
 
+const ModelStructure* SettingsModel::GetStructure(int id) const {
+    for (const auto& modelStructure : _modelStructures) {
+        if (modelStructure.id == id) {
+            return &modelStructure;
+        }
+    }
+
+    return nullptr;
+}
+
 void SettingsModel::SelectHydroUnitBrick(int index) {
     assert(_selectedStructure);
 
@@ -682,8 +759,12 @@ void SettingsModel::SelectSubBasinBrick(int index) {
 
 bool SettingsModel::SelectHydroUnitBrickIfFound(const string& name) {
     assert(_selectedStructure);
+    Symbol symbol = Symbol::Find(name);
+    if (!symbol.IsDefined()) {
+        return false;
+    }
     for (auto& brick : _selectedStructure->hydroUnitBricks) {
-        if (brick.name == name) {
+        if (brick.symbol == symbol) {
             _selectedBrick = &brick;
             _selectedProcess = nullptr;
             return true;
@@ -695,8 +776,12 @@ bool SettingsModel::SelectHydroUnitBrickIfFound(const string& name) {
 
 bool SettingsModel::SelectSubBasinBrickIfFound(const string& name) {
     assert(_selectedStructure);
+    Symbol symbol = Symbol::Find(name);
+    if (!symbol.IsDefined()) {
+        return false;
+    }
     for (auto& brick : _selectedStructure->subBasinBricks) {
-        if (brick.name == name) {
+        if (brick.symbol == symbol) {
             _selectedBrick = &brick;
             _selectedProcess = nullptr;
             return true;
@@ -771,8 +856,12 @@ void SettingsModel::SelectSubBasinSplitter(int index) {
 
 bool SettingsModel::SelectHydroUnitSplitterIfFound(const string& name) {
     assert(_selectedStructure);
+    Symbol symbol = Symbol::Find(name);
+    if (!symbol.IsDefined()) {
+        return false;
+    }
     for (auto& splitter : _selectedStructure->hydroUnitSplitters) {
-        if (splitter.name == name) {
+        if (splitter.symbol == symbol) {
             _selectedSplitter = &splitter;
             return true;
         }
@@ -783,8 +872,12 @@ bool SettingsModel::SelectHydroUnitSplitterIfFound(const string& name) {
 
 bool SettingsModel::SelectSubBasinSplitterIfFound(const string& name) {
     assert(_selectedStructure);
+    Symbol symbol = Symbol::Find(name);
+    if (!symbol.IsDefined()) {
+        return false;
+    }
     for (auto& splitter : _selectedStructure->subBasinSplitters) {
-        if (splitter.name == name) {
+        if (splitter.symbol == symbol) {
             _selectedSplitter = &splitter;
             return true;
         }
@@ -965,6 +1058,85 @@ bool SettingsModel::SetParameterValue(const string& component, const string& nam
     return foundAny;
 }
 
+bool SettingsModel::SetParameterModifier(const string& component, const string& name,
+                                         const ParameterModifier& modifier) {
+    auto setModifier = [&](vector<Parameter>& parameters) {
+        for (auto& parameter : parameters) {
+            if (parameter.GetName() == name) {
+                parameter.SetModifier(modifier);
+                return true;
+            }
+        }
+        return false;
+    };
+    auto setInBricks = [&](vector<BrickSettings>& bricks) {
+        bool found = false;
+        for (auto& brick : bricks) {
+            if (brick.name != component) continue;
+            if (setModifier(brick.parameters)) {
+                found = true;
+                continue;
+            }
+            for (auto& process : brick.processes) {
+                found = setModifier(process.parameters) || found;
+            }
+        }
+        return found;
+    };
+    auto setInSplitters = [&](vector<SplitterSettings>& splitters) {
+        bool found = false;
+        for (auto& splitter : splitters) {
+            if (splitter.name == component) {
+                found = setModifier(splitter.parameters) || found;
+            }
+        }
+        return found;
+    };
+
+    bool foundAny = false;
+    for (auto& modelStructure : _modelStructures) {
+        foundAny = setInBricks(modelStructure.hydroUnitBricks) || foundAny;
+        foundAny = setInBricks(modelStructure.subBasinBricks) || foundAny;
+        foundAny = setInSplitters(modelStructure.hydroUnitSplitters) || foundAny;
+        foundAny = setInSplitters(modelStructure.subBasinSplitters) || foundAny;
+    }
+
+    if (!foundAny) {
+        LogError("Cannot find the parameter '{}' of the component '{}'.", name, component);
+    }
+
+    return foundAny;
+}
+
+vector<Parameter*> SettingsModel::GetParametersWithModifier() {
+    vector<Parameter*> parameters;
+    auto collect = [&parameters](vector<Parameter>& candidates) {
+        for (auto& parameter : candidates) {
+            if (parameter.HasModifier()) {
+                parameters.push_back(&parameter);
+            }
+        }
+    };
+
+    for (auto& modelStructure : _modelStructures) {
+        for (auto* bricks : {&modelStructure.hydroUnitBricks, &modelStructure.subBasinBricks}) {
+            for (auto& brick : *bricks) {
+                collect(brick.parameters);
+                for (auto& process : brick.processes) {
+                    collect(process.parameters);
+                }
+            }
+        }
+        for (auto* splitters : {&modelStructure.hydroUnitSplitters, &modelStructure.subBasinSplitters}) {
+            for (auto& splitter : *splitters) {
+                collect(splitter.parameters);
+            }
+        }
+    }
+
+    return parameters;
+}
+
 bool SettingsModel::SetParameterValueInSelectedStructure(const string& component, const string& name, float value) {
     // Get target object
     if (SelectHydroUnitBrickIfFound(component) || SelectSubBasinBrickIfFound(component)) {
@@ -7,9 +7,11 @@
 
 #include "Includes.h"
 #include "Parameter.h"
+#include "Symbol.h"
 
 struct SolverSettings {
     string name;
+    bool processKernels = true;  // evaluate the rates of grouped processes with their kernels
 };
 
 struct TimerSettings {
@@ -18,10 +20,18 @@ struct TimerSettings {
     int timeStep = 1;
     string timeStepUnit;
     int spinupDays = 0;
+    bool parameterTrajectories = true;  // precompute the values of the modified parameters for each time step
+};
+
+struct LoggerSettings {
+    LogPeriod hydroUnitPeriod = LogPeriod::Step;
+    vecStr aggregatedLabels;
+    vector<LogAggregation> aggregations;
 };
 
 struct OutputSettings {
     string target;
+    Symbol targetSymbol;  // interned target name
     ContentType fluxType = ContentType::Water;
     bool isInstantaneous = false;
     bool isStatic = false;
@@ -38,6 +48,7 @@ struct ProcessSettings {
 
 struct SplitterSettings {
     string name;
+    Symbol symbol;  // interned name
     string type;
     vecStr logItems;
     vector<Parameter> parameters;
@@ -47,8 +58,10 @@ struct SplitterSettings {
 
 struct BrickSettings {
     string name;
+    Symbol symbol;  // interned name
     string type;
     string parent;
+    Symbol parentSymbol;  // interned parent name
     vecStr logItems;
     vector<Parameter> parameters;
     vector<VariableType> forcing;
@@ -80,6 +93,22 @@ class SettingsModel {
      */
     void SetSolver(const string& solverName);
 
+    /**
+     * Enable or disable the process kernels, which evaluate the rates of the processes of the
+     * same type and structure variant in one array operation (enabled by default).
+     *
+     * @param enable True to use the process kernels, false to evaluate each process separately.
+     */
+    void SetProcessKernels(bool enable);
+
+    /**
+     * Enable or disable the precomputation of the values of the parameters with modifiers
+     * (yearly, monthly or dated values) for each time step at initialization (enabled by default).
+     *
+     * @param enable True to precompute the parameter values, false to compute them during the run.
+     */
+    void SetParameterTrajectories(bool enable);
+
     /**
      * Set the timer settings.
      *
@@ -435,6 +464,14 @@ class SettingsModel {
      */
     bool SelectStructure(int id);
 
+    /**
+     * Get a structure by its ID without changing the selection.
+     *
+     * @param id ID of the structure.
+     * @return the structure, or nullptr if not found.
+     */
+    const ModelStructure* GetStructure(int id) const;
+
     /**
      * Select a hydro unit brick by its index.
      *
@@ -562,6 +599,24 @@ class SettingsModel {
      */
     bool SetParameterValue(const string& component, const string& name, float value);
 
+    /**
+     * Set a modifier changing the value of a parameter over time (yearly, monthly or at given
+     * dates). It applies to the parameter in every structure variant containing the component.
+     *
+     * @param component name of the brick or splitter.
+     * @param name name of the parameter.
+     * @param modifier the modifier of the parameter.
+     * @return true if the parameter is found, false otherwise.
+     */
+    bool SetParameterModifier(const string& component, const string& name, const ParameterModifier& modifier);
+
+    /**
+     * Get the parameters having a modifier, in every structure variant.
+     *
+     * @return pointers to the parameters changing over time.
+     */
+    vector<Parameter*> GetParametersWithModifier();
+
     /**
      * Get the number of structures in the model.
      *
@@ -631,6 +686,41 @@ class SettingsModel {
         return static_cast<int>(_selectedStructure->subBasinSplitters.size());
     }
 
+    /**
+     * Set the method used to compute the PET natively from the temperature and radiation forcings
+     * (Hamon, Oudin, Hargreaves or Priestley-Taylor). If not set, the PET is read from its time series.
+     *
+     * @param method name of the PET method.
+     */
+    void SetPETMethod(const string& method);
+
+    /**
+     * Get the method used to compute the PET natively.
+     *
+     * @return name of the PET method (empty if the PET is read from its time series).
+     */
+    const string& GetPETMethod() const {
+        return _petMethod;
+    }
+
+    /**
+     * Set the number of threads used to build the components of the hydro units.
+     *
+     * @param threadsNb number of threads (0: use the hardware concurrency, 1: build serially).
+     */
+    void SetBuildThreads(int threadsNb) {
+        _buildThreads = threadsNb;
+    }
+
+    /**
+     * Get the number of threads used to build the components of the hydro units.
+     *
+     * @return number of threads (0: use the hardware concurrency).
+     */
+    int GetBuildThreads() const {
+        return _buildThreads;
+    }
+
     /**
      * Get the solver settings.
      *
@@ -834,6 +924,34 @@ class SettingsModel {
         return _recordFractions;
     }
 
+    /**
+     * Set the recording period of the hydro unit values. The values of each period are aggregated
+     * in a single record, while the sub-basin values (e.g. the outlet) stay at the time step
+     * resolution.
+     *
+     * @param period recording period: "step" (default), "day", "month" or "year".
+     */
+    void SetHydroUnitLogPeriod(const string& period);
+
+    /**
+     * Set the aggregation of a logged hydro unit value over its recording period. By default, the
+     * contents (labels ending with "_content") keep the last value of the period and the other
+     * values are summed, which keeps the water balance totals of the logger valid.
+     *
+     * @param label the logged label (e.g. "glacier:ice_content").
+     * @param aggregation aggregation: "sum", "mean", "last", "min" or "max".
+     */
+    void SetLogAggregation(const string& label, const string& aggregation);
+
+    /**
+     * Get the logger settings.
+     *
+     * @return logger settings.
+     */
+    const LoggerSettings& GetLoggerSettings() const {
+        return _logger;
+    }
+
     /**
      * Check if the settings model is valid.
      * Verifies that critical settings are configured (solver, timer, structures).
@@ -863,6 +981,9 @@ class SettingsModel {
     vector<ModelStructure> _modelStructures;
     SolverSettings _solver;
     TimerSettings _timer;
+    LoggerSettings _logger;
+    string _petMethod;
+    int _buildThreads;
     ModelStructure* _selectedStructure;   // non-owning reference
     BrickSettings* _selectedBrick;        // non-owning reference
     ProcessSettings* _selectedProcess;    // non-owning reference
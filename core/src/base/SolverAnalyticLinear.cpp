@@ -13,6 +13,7 @@ void SolverAnalyticLinear::ComputeBrickRates(Brick* brick, double content, doubl
                                              int iRateStart) {
     // Partition the processes: linear responses (rate = k * S) are integrated
     // exactly; the other rates are frozen at their start-of-step value.
+    _processor->GetDiagnostics().rateEvaluations++;
     int iRate = iRateStart;
     double totalLinearCoefficient = 0;  // sum of the linear coefficients k [1/d]
     double totalFrozenRate = 0;         // sum of the frozen rates [mm/d]
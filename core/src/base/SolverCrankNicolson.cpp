@@ -32,7 +32,9 @@ void SolverCrankNicolson::ComputeBrickRates(Brick* brick, double content, double
 
     double endContent = hi;
     if (hi > lo) {
+        SolverDiagnostics& diagnostics = _processor->GetDiagnostics();
         for (int iter = 0; iter < 100; ++iter) {
+            diagnostics.bisectionIterations++;
             endContent = (lo + hi) / 2;
             double endTotal = TotalRateAt(brick, contentDelta, endContent - content);
             double g = endContent - content - h * (inflow - (startTotal + endTotal) / 2);
@@ -0,0 +1,20 @@
+#include "SolverDiagnostics.h"
+
+namespace {
+
+thread_local SolverDiagnostics* currentDiagnostics = nullptr;
+
+}  // namespace
+
+SolverDiagnostics* SolverDiagnostics::GetCurrent() {
+    return currentDiagnostics;
+}
+
+SolverDiagnostics::Scope::Scope(SolverDiagnostics* diagnostics)
+    : _previous(currentDiagnostics) {
+    currentDiagnostics = diagnostics;
+}
+
+SolverDiagnostics::Scope::~Scope() {
+    currentDiagnostics = _previous;
+}
@@ -0,0 +1,48 @@
+#ifndef HYDROBRICKS_SOLVER_DIAGNOSTICS_H
+#define HYDROBRICKS_SOLVER_DIAGNOSTICS_H
+
+#include "Includes.h"
+
+/**
+ * Counters of the work done by the solver over a run, to compare the cost of the solvers on a
+ * catchment.
+ */
+struct SolverDiagnostics {
+    long long rateEvaluations = 0;      // evaluations of the rates of a brick
+    long long constraintSweeps = 0;     // sweeps of the storage constraints (Processor::EnforceConstraints)
+    long long sweepLimitHits = 0;       // constraint enforcements stopped by the sweeps limit
+    long long bisectionIterations = 0;  // bisection iterations of the implicit solvers
+    long long clampedFluxes = 0;        // change rates clamped by the storage constraints
+
+    /**
+     * Reset the counters.
+     */
+    void Reset() {
+        *this = SolverDiagnostics();
+    }
+
+    /**
+     * Get the counters of the time step processed by the current thread.
+     *
+     * @return The current counters, or nullptr if no time step is processed.
+     */
+    static SolverDiagnostics* GetCurrent();
+
+    /**
+     * Count the work of the current thread in the given counters while the scope is alive.
+     */
+    class Scope {
+      public:
+        explicit Scope(SolverDiagnostics* diagnostics);
+
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+      private:
+        SolverDiagnostics* _previous;  // non-owning reference
+    };
+};
+
+#endif  // HYDROBRICKS_SOLVER_DIAGNOSTICS_H
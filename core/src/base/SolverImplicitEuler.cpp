@@ -28,7 +28,9 @@ void SolverImplicitEuler::ComputeBrickRates(Brick* brick, double content, double
 
     double endContent = hi;
     if (hi > lo) {
+        SolverDiagnostics& diagnostics = _processor->GetDiagnostics();
         for (int iter = 0; iter < 100; ++iter) {
+            diagnostics.bisectionIterations++;
             endContent = (lo + hi) / 2;
             double g = endContent - content - h * (inflow - TotalRateAt(brick, contentDelta, endContent - content));
             if (g > 0) {
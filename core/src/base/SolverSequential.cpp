@@ -20,6 +20,7 @@ void SolverSequential::InitializeContainers() {
 }
 
 double SolverSequential::TotalRateAt(Brick* brick, double* contentDelta, double offset) {
+    _processor->GetDiagnostics().rateEvaluations++;
     *contentDelta = offset;
     double total = 0;
     for (int i = 0; i < brick->GetProcessCount(); ++i) {
@@ -32,6 +33,7 @@ double SolverSequential::TotalRateAt(Brick* brick, double* contentDelta, double
 }
 
 void SolverSequential::StoreRatesAtCurrentContent(Brick* brick, vecDouble& rates) {
+    _processor->GetDiagnostics().rateEvaluations++;
     rates.clear();
     for (int i = 0; i < brick->GetProcessCount(); ++i) {
         const vecDouble& processRates = brick->GetProcess(i)->GetChangeRates();
@@ -54,7 +54,7 @@ class SolverSequential : public Solver {
      * @param offset Content offset from the start-of-step content [mm].
      * @return the total outflow rate [mm/d].
      */
-    static double TotalRateAt(Brick* brick, double* contentDelta, double offset);
+    double TotalRateAt(Brick* brick, double* contentDelta, double offset);
 
     /**
      * Store the per-connection rates of the brick's processes, evaluated at the
@@ -63,7 +63,7 @@ class SolverSequential : public Solver {
      * @param brick The brick to evaluate.
      * @param rates The vector receiving the rates.
      */
-    static void StoreRatesAtCurrentContent(Brick* brick, vecDouble& rates);
+    void StoreRatesAtCurrentContent(Brick* brick, vecDouble& rates);
 };
 
 #endif  // HYDROBRICKS_SOLVER_SEQUENTIAL_H
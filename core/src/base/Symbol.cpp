@@ -0,0 +1,79 @@
+#include "Symbol.h"
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace {
+
+struct StringHash {
+    using is_transparent = void;
+
+    size_t operator()(std::string_view value) const {
+        return std::hash<std::string_view>{}(value);
+    }
+};
+
+// The names are stored in a deque so that the references returned by GetName remain valid
+// when new names are interned.
+struct SymbolTable {
+    std::shared_mutex mutex;
+    std::deque<string> names;
+    std::unordered_map<string, int, StringHash, std::equal_to<>> ids;
+};
+
+SymbolTable& GetTable() {
+    static SymbolTable table;
+    return table;
+}
+
+const string emptyName;
+
+}  // namespace
+
+Symbol::Symbol(std::string_view name) {
+    SymbolTable& table = GetTable();
+    {
+        std::shared_lock lock(table.mutex);
+        auto it = table.ids.find(name);
+        if (it != table.ids.end()) {
+            _id = it->second;
+            return;
+        }
+    }
+
+    std::unique_lock lock(table.mutex);
+    auto [it, inserted] = table.ids.try_emplace(string(name), static_cast<int>(table.names.size()));
+    if (inserted) {
+        table.names.emplace_back(name);
+    }
+    _id = it->second;
+}
+
+Symbol Symbol::Find(std::string_view name) {
+    SymbolTable& table = GetTable();
+    std::shared_lock lock(table.mutex);
+    Symbol symbol;
+    auto it = table.ids.find(name);
+    if (it != table.ids.end()) {
+        symbol._id = it->second;
+    }
+
+    return symbol;
+}
+
+int Symbol::GetCount() {
+    SymbolTable& table = GetTable();
+    std::shared_lock lock(table.mutex);
+    return static_cast<int>(table.names.size());
+}
+
+const string& Symbol::GetName() const {
+    if (_id < 0) {
+        return emptyName;
+    }
+    SymbolTable& table = GetTable();
+    std::shared_lock lock(table.mutex);
+    return table.names[_id];
+}
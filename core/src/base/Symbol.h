@@ -0,0 +1,71 @@
+#ifndef HYDROBRICKS_SYMBOL_H
+#define HYDROBRICKS_SYMBOL_H
+
+#include "Includes.h"
+
+/**
+ * Interned name of a model component (brick, land cover, splitter, etc.). The names are
+ * registered once, when the settings are defined, in a global table that maps them to dense
+ * integer identifiers. The identifiers can then be used to index arrays instead of hashing and
+ * comparing strings when building and running the model.
+ *
+ * The table only grows and is safe to use from several threads.
+ */
+class Symbol {
+  public:
+    Symbol() = default;
+
+    /**
+     * Intern a name (register it if it is not yet in the table).
+     *
+     * @param name The name to intern.
+     */
+    explicit Symbol(std::string_view name);
+
+    /**
+     * Find a name in the table without registering it.
+     *
+     * @param name The name to find.
+     * @return The symbol of the name, or an undefined symbol if the name was never interned.
+     */
+    static Symbol Find(std::string_view name);
+
+    /**
+     * Get the number of interned names.
+     *
+     * @return The number of names in the table.
+     */
+    static int GetCount();
+
+    /**
+     * Get the identifier of the symbol.
+     *
+     * @return The identifier, or -1 if the symbol is undefined.
+     */
+    [[nodiscard]] int GetId() const {
+        return _id;
+    }
+
+    /**
+     * Check if the symbol refers to an interned name.
+     *
+     * @return True if the symbol is defined, false otherwise.
+     */
+    [[nodiscard]] bool IsDefined() const {
+        return _id >= 0;
+    }
+
+    /**
+     * Get the interned name.
+     *
+     * @return The name of the symbol (empty if undefined).
+     */
+    [[nodiscard]] const string& GetName() const;
+
+    bool operator==(const Symbol& other) const = default;
+
+  protected:
+    int _id = -1;
+};
+
+#endif  // HYDROBRICKS_SYMBOL_H
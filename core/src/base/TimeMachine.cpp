@@ -1,5 +1,7 @@
 #include "TimeMachine.h"
 
+#include "Profiler.h"
+
 TimeMachine::TimeMachine()
     : _date(0),
       _start(0),
@@ -7,6 +9,7 @@ TimeMachine::TimeMachine()
       _timeStep(0),
       _timeStepUnit(TimeUnit::Day),
       _timeStepInDays(0),
+      _step(0),
       _parametersUpdater(nullptr),
       _actionsManager(nullptr) {}
 
@@ -16,7 +19,9 @@ void TimeMachine::Initialize(double start, double end, int timeStep, TimeUnit ti
     _end = end;
     _timeStep = timeStep;
     _timeStepUnit = timeStepUnit;
+    _step = 0;
     UpdateTimeStepInDays();
+    BuildCalendar();
 }
 
 void TimeMachine::Initialize(const TimerSettings& settings) {
@@ -35,11 +40,14 @@ void TimeMachine::Initialize(const TimerSettings& settings) {
         throw InputError("Time step unit unrecognized or not implemented.");
     }
 
+    _step = 0;
     UpdateTimeStepInDays();
+    BuildCalendar();
 }
 
 void TimeMachine::Reset() {
     _date = _start;
+    _step = 0;
 }
 
 bool TimeMachine::IsOver() const {
@@ -49,12 +57,32 @@ bool TimeMachine::IsOver() const {
 void TimeMachine::IncrementTime() {
     assert(_timeStepInDays > 0);
     _date += _timeStepInDays;
+    _step++;
+
+    if (_step >= static_cast<int>(_calendar.size())) {
+        // Past the modelling period: the calendar has to be computed.
+        if (_parametersUpdater) {
+            HB_PROFILE("model", "parameters_update");
+            _parametersUpdater->DateUpdate(_date);
+        }
+        if (_actionsManager) {
+            HB_PROFILE("model", "actions");
+            _actionsManager->DateUpdate(_date);
+        }
+        return;
+    }
 
     if (_parametersUpdater) {
-        _parametersUpdater->DateUpdate(_date);
+        HB_PROFILE("model", "parameters_update");
+        if (_parametersUpdater->HasTrajectories()) {
+            _parametersUpdater->StepUpdate(_step);
+        } else {
+            _parametersUpdater->DateUpdate(_date, _calendar[_step]);
+        }
     }
     if (_actionsManager) {
-        _actionsManager->DateUpdate(_date);
+        HB_PROFILE("model", "actions");
+        _actionsManager->StepUpdate(*this);
     }
 }
 
@@ -84,17 +112,54 @@ void TimeMachine::UpdateTimeStepInDays() {
     }
 }
 
-int TimeMachine::GetCurrentDayOfYear() const {
-    if (_date <= 0) return 1;
-    Time ts = GetTimeStructFromMJD(_date);
+void TimeMachine::BuildCalendar() {
+    _calendar.clear();
+    _stepDates.clear();
+    if (_start <= 0 || _end < _start || _timeStepInDays <= 0) {
+        return;
+    }
+
+    // The dates are accumulated as in IncrementTime to get exactly the same values. The step
+    // following the end date is included, as the updaters are triggered when reaching it.
+    int stepsNb = GetTimeStepCount() + 1;
+    _calendar.reserve(stepsNb);
+    _stepDates.reserve(stepsNb);
+    double date = _start;
+    for (int i = 0; i < stepsNb; ++i) {
+        _stepDates.push_back(date);
+        _calendar.push_back(ComputeCalendar(date, i > 0 ? &_calendar.back() : nullptr));
+        date += _timeStepInDays;
+    }
+}
+
+CalendarStep TimeMachine::ComputeCalendar(double date, const CalendarStep* previous) {
+    Time ts = GetTimeStructFromMJD(date);
     static const int cumMonthDays[12] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
-    int monthIndex = ts.month - 1;  // 0-based
-    if (monthIndex < 0 || monthIndex > 11) return 1;
+    int monthIndex = std::clamp(ts.month - 1, 0, 11);  // 0-based
     bool leap = (ts.year % 4 == 0 && (ts.year % 100 != 0 || ts.year % 400 == 0));
     int doy = cumMonthDays[monthIndex] + ts.day;
     if (leap && monthIndex > 1) doy += 1;
 
-    return doy;
+    CalendarStep calendar{};
+    calendar.year = static_cast<std::int16_t>(ts.year);
+    calendar.dayOfYear = static_cast<std::int16_t>(doy);
+    calendar.month = static_cast<std::int8_t>(ts.month);
+    calendar.day = static_cast<std::int8_t>(ts.day);
+    calendar.hour = static_cast<std::int8_t>(ts.hour);
+    calendar.min = static_cast<std::int8_t>(ts.min);
+    calendar.newYear = previous == nullptr || previous->year != calendar.year;
+    calendar.newMonth = calendar.newYear || previous->month != calendar.month;
+
+    return calendar;
+}
+
+int TimeMachine::GetCurrentDayOfYear() const {
+    if (_step < static_cast<int>(_calendar.size())) {
+        return _calendar[_step].dayOfYear;
+    }
+    if (_date <= 0) return 1;
+
+    return ComputeCalendar(_date).dayOfYear;
 }
 
 bool TimeMachine::IsValid() const {
@@ -62,6 +62,57 @@ class TimeMachine {
         return _date;
     }
 
+    /**
+     * Get the index of the current time step.
+     *
+     * @return index of the current time step (0 at the start date)
+     */
+    [[nodiscard]] int GetCurrentStep() const noexcept {
+        return _step;
+    }
+
+    /**
+     * Get the calendar of the current time step.
+     *
+     * @return calendar of the current time step
+     */
+    [[nodiscard]] const CalendarStep& GetCalendar() const {
+        return GetCalendar(_step);
+    }
+
+    /**
+     * Get the calendar of a time step. The calendar is computed once by Initialize for all the
+     * time steps, including the one following the end date.
+     *
+     * @param step index of the time step
+     * @return calendar of the time step
+     */
+    [[nodiscard]] const CalendarStep& GetCalendar(int step) const {
+        assert(step >= 0 && step < static_cast<int>(_calendar.size()));
+        return _calendar[step];
+    }
+
+    /**
+     * Get the number of time steps covered by the calendar (the time steps of the modelling
+     * period and the one following the end date).
+     *
+     * @return number of time steps in the calendar
+     */
+    [[nodiscard]] int GetCalendarStepCount() const {
+        return static_cast<int>(_calendar.size());
+    }
+
+    /**
+     * Get the date of a time step, as reached by incrementing the timer.
+     *
+     * @param step index of the time step
+     * @return date of the time step as a MJD
+     */
+    [[nodiscard]] double GetStepDate(int step) const {
+        assert(step >= 0 && step < static_cast<int>(_stepDates.size()));
+        return _stepDates[step];
+    }
+
     /**
      * Get the start date as a MJD.
      *
@@ -114,6 +165,15 @@ class TimeMachine {
      */
     [[nodiscard]] int GetCurrentDayOfYear() const;
 
+    /**
+     * Compute the calendar of a date.
+     *
+     * @param date date as a MJD
+     * @param previous calendar of the previous time step (to set the year/month change flags), or nullptr
+     * @return calendar of the date
+     */
+    static CalendarStep ComputeCalendar(double date, const CalendarStep* previous = nullptr);
+
     /**
      * Check if the time machine is valid.
      * Verifies that start and end dates are properly configured.
@@ -137,6 +197,9 @@ class TimeMachine {
     int _timeStep;
     TimeUnit _timeStepUnit;
     double _timeStepInDays;
+    int _step;
+    vector<CalendarStep> _calendar;         // per time step, from the start date
+    vecDouble _stepDates;                   // per time step, from the start date
     ParametersUpdater* _parametersUpdater;  // non-owning reference
     ActionsManager* _actionsManager;        // non-owning reference
 
@@ -144,6 +207,11 @@ class TimeMachine {
      * Update the time step in days.
      */
     void UpdateTimeStepInDays();
+
+    /**
+     * Compute the calendar of all the time steps.
+     */
+    void BuildCalendar();
 };
 
 #endif  // HYDROBRICKS_TIME_MACHINE_H
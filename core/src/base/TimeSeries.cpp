@@ -3,11 +3,14 @@
 #include "FileNetcdf.h"
 #include "TimeSeriesDistributed.h"
 #include "TimeSeriesUniform.h"
+#include "Tracer.h"
 
 TimeSeries::TimeSeries(VariableType type)
     : _type(type) {}
 
 bool TimeSeries::Parse(const string& path, vector<std::unique_ptr<TimeSeries>>& vecTimeSeries) {
+    HB_TRACE("io", "parse_time_series");
+
     try {
         FileNetcdf file;
 
@@ -0,0 +1,163 @@
+#include "Tracer.h"
+
+#include <atomic>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+
+struct TraceEvent {
+    string category;
+    string name;
+    int threadId;
+    double start;     // [us] since the start of the tracing
+    double duration;  // [us]
+};
+
+struct TraceState {
+    std::mutex mutex;
+    std::atomic<bool> active{false};
+    std::atomic<int> stepsPerSpan{100};
+    string path;
+    std::chrono::steady_clock::time_point origin;
+    vector<TraceEvent> events;
+    std::map<std::thread::id, int> threadIds;  // thread ids, numbered in order of appearance
+};
+
+TraceState& GetTraceState() {
+    static TraceState state;
+    return state;
+}
+
+int GetProcessId() {
+#ifdef _WIN32
+    return _getpid();
+#else
+    return static_cast<int>(getpid());
+#endif
+}
+
+string EscapeJson(const string& text) {
+    string escaped;
+    escaped.reserve(text.size());
+    for (char c : text) {
+        switch (c) {
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            case '\r':
+                escaped += "\\r";
+                break;
+            case '\t':
+                escaped += "\\t";
+                break;
+            default:
+                // The other control characters are not allowed in JSON strings.
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    escaped += std::format("\\u{:04x}", static_cast<unsigned char>(c));
+                } else {
+                    escaped += c;
+                }
+        }
+    }
+    return escaped;
+}
+
+}  // namespace
+
+void Tracer::Start(const string& path, int stepsPerSpan) {
+#ifndef USE_PROFILING
+    LogWarning("The tracing instrumentation is not compiled in (USE_PROFILING): the trace will be empty.");
+#endif
+    std::filesystem::path tracePath(path);
+    tracePath.replace_filename(
+        std::format("{}.{}{}", tracePath.stem().string(), GetProcessId(), tracePath.extension().string()));
+
+    TraceState& state = GetTraceState();
+    std::lock_guard lock(state.mutex);
+    state.path = tracePath.string();
+    state.stepsPerSpan = std::max(stepsPerSpan, 1);
+    state.origin = std::chrono::steady_clock::now();
+    state.events.clear();
+    state.threadIds.clear();
+    state.active = true;
+}
+
+bool Tracer::Stop() {
+    TraceState& state = GetTraceState();
+    std::lock_guard lock(state.mutex);
+    if (!state.active) {
+        LogError("The tracing was not started.");
+        return false;
+    }
+    state.active = false;
+
+    std::ofstream file(state.path);
+    if (!file) {
+        LogError("The trace file {} could not be created.", state.path);
+        return false;
+    }
+
+    // Chrome trace event format: complete events ("X") in microseconds, one track per thread.
+    const int pid = GetProcessId();
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (const auto& [thread, threadId] : state.threadIds) {
+        file << (first ? "" : ",") << "\n"
+             << std::format(R"({{"name":"thread_name","ph":"M","pid":{},"tid":{},"args":{{"name":"thread {}"}}}})",
+                            pid, threadId, threadId);
+        first = false;
+    }
+    for (const TraceEvent& event : state.events) {
+        file << (first ? "" : ",") << "\n"
+             << std::format(R"({{"name":"{}","cat":"{}","ph":"X","ts":{:.3f},"dur":{:.3f},"pid":{},"tid":{}}})",
+                            EscapeJson(event.name), EscapeJson(event.category), event.start, event.duration, pid,
+                            event.threadId);
+        first = false;
+    }
+    file << "\n]}\n";
+    state.events.clear();
+
+    return static_cast<bool>(file);
+}
+
+bool Tracer::IsActive() {
+    return GetTraceState().active;
+}
+
+string Tracer::GetPath() {
+    TraceState& state = GetTraceState();
+    std::lock_guard lock(state.mutex);
+    return state.path;
+}
+
+int Tracer::GetStepsPerSpan() {
+    return GetTraceState().stepsPerSpan;
+}
+
+void Tracer::AddSpan(const string& category, const string& name, std::chrono::steady_clock::time_point start,
+                     std::chrono::steady_clock::time_point end) {
+    TraceState& state = GetTraceState();
+    std::lock_guard lock(state.mutex);
+    if (!state.active) {
+        return;
+    }
+    auto threadId = state.threadIds.try_emplace(std::this_thread::get_id(), static_cast<int>(state.threadIds.size()));
+    using Microseconds = std::chrono::duration<double, std::micro>;
+    state.events.push_back({category, name, threadId.first->second, Microseconds(start - state.origin).count(),
+                            Microseconds(end - start).count()});
+}
@@ -0,0 +1,150 @@
+#ifndef HYDROBRICKS_TRACER_H
+#define HYDROBRICKS_TRACER_H
+
+#include <chrono>
+#include <optional>
+
+#include "Includes.h"
+#include "Profiler.h"
+
+/**
+ * Records the spans of the main phases of the model runs (initialization, model building, forcing
+ * parsing, spin-up, main loop, actions and outputs writing) and writes them as a Chrome trace JSON
+ * file, which can be opened in Perfetto (ui.perfetto.dev) or about:tracing.
+ *
+ * The tracing is opt-in at compile time (USE_PROFILING) and at run time (between Start and Stop).
+ * It is shared by all the models of the process and thread-safe: the spans of each thread are
+ * shown on their own track, so that the serial sections of a parallel calibration or of a
+ * multi-basin run can be spotted. Each process writes its own file, named after its process id.
+ */
+class Tracer {
+  public:
+    /**
+     * Start recording the trace spans. The model phases are only instrumented in the builds with
+     * USE_PROFILING; otherwise a warning is logged and the trace will be empty.
+     *
+     * @param path The path of the trace file written by Stop. The process id is added before the
+     * extension (e.g. trace.json becomes trace.1234.json), so that the workers of a multi-process
+     * run do not overwrite each other's trace.
+     * @param stepsPerSpan The number of time steps of the main loop grouped in a span.
+     */
+    static void Start(const string& path, int stepsPerSpan = 100);
+
+    /**
+     * Stop recording the trace spans and write them to the trace file.
+     *
+     * @return true if the trace file was written.
+     */
+    static bool Stop();
+
+    /**
+     * Check if the trace spans are being recorded.
+     *
+     * @return true if the tracing is active.
+     */
+    static bool IsActive();
+
+    /**
+     * Get the path of the trace file of this process (set by Start).
+     *
+     * @return the path of the trace file, including the process id.
+     */
+    static string GetPath();
+
+    /**
+     * Get the number of time steps of the main loop grouped in a span.
+     *
+     * @return the number of time steps per span.
+     */
+    static int GetStepsPerSpan();
+
+    /**
+     * Add a completed span to the trace (ignored if the tracing is not active).
+     *
+     * @param category The category of the span.
+     * @param name The name of the span.
+     * @param start The start of the span.
+     * @param end The end of the span.
+     */
+    static void AddSpan(const string& category, const string& name, std::chrono::steady_clock::time_point start,
+                        std::chrono::steady_clock::time_point end);
+};
+
+/**
+ * Traces a span from its construction to its destruction, if the tracing is active.
+ */
+class TraceSpan {
+  public:
+    TraceSpan(string category, string name)
+        : _active(Tracer::IsActive()) {
+        if (_active) {
+            _category = std::move(category);
+            _name = std::move(name);
+            _start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~TraceSpan() {
+        if (_active) {
+            Tracer::AddSpan(_category, _name, _start, std::chrono::steady_clock::now());
+        }
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+  private:
+    bool _active;
+    string _category;
+    string _name;
+    std::chrono::steady_clock::time_point _start;
+};
+
+/**
+ * Traces the time steps of a loop by groups of Tracer::GetStepsPerSpan() steps (a span per time
+ * step would be too many).
+ */
+class TraceStepsSpan {
+  public:
+    explicit TraceStepsSpan(string name)
+        : _name(std::move(name)),
+          _stepsPerSpan(Tracer::GetStepsPerSpan()) {}
+
+    /**
+     * Start a new span if the time step starts a group.
+     *
+     * @param step The index of the time step.
+     */
+    void Step(int step) {
+        if (step % _stepsPerSpan == 0) {
+            _span.reset();
+            if (Tracer::IsActive()) {
+                _span.emplace("model", std::format("{} (steps {}-{})", _name, step, step + _stepsPerSpan - 1));
+            }
+        }
+    }
+
+  private:
+    string _name;
+    int _stepsPerSpan;
+    std::optional<TraceSpan> _span;
+};
+
+#ifdef USE_PROFILING
+/**
+ * Trace the rest of the enclosing block as a span.
+ */
+#define HB_TRACE(category, name) TraceSpan HB_PROFILE_CONCAT(traceSpan, __LINE__)(category, name)
+
+/**
+ * Trace the time steps of a loop by groups: declare before the loop, then step in the loop.
+ */
+#define HB_TRACE_STEPS(name) TraceStepsSpan traceStepsSpan(name)
+#define HB_TRACE_STEP(step) traceStepsSpan.Step(step)
+#else
+#define HB_TRACE(category, name)
+#define HB_TRACE_STEPS(name)
+#define HB_TRACE_STEP(step)
+#endif
+
+#endif  // HYDROBRICKS_TRACER_H
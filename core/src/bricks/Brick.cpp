@@ -23,7 +23,11 @@ std::unique_ptr<Brick> Brick::Factory(const BrickSettings& brickSettings) {
         LogError("Brick type '{}' not recognized. {}", brickSettings.type, GetBrickTypeSuggestions());
         return nullptr;
     }
-    return Factory(type);
+    std::unique_ptr<Brick> brick = Factory(type);
+    if (brick) {
+        brick->_type = BrickTypeToString(type);
+    }
+    return brick;
 }
 
 std::unique_ptr<Brick> Brick::Factory(BrickType type) {
@@ -5,6 +5,7 @@
 
 #include "Flux.h"
 #include "Includes.h"
+#include "ModelArena.h"
 #include "Process.h"
 #include "SettingsModel.h"
 #include "WaterContainer.h"
@@ -19,7 +20,7 @@ enum class BrickCategory {
     Unknown            ///< Unknown or unspecified brick type
 };
 
-class Brick {
+class Brick : public ArenaAllocated {
   public:
     explicit Brick();
 
@@ -272,6 +273,15 @@ class Brick {
         _name = string(name);
     }
 
+    /**
+     * Get the canonical type of the brick (e.g. "storage"), as created by the factory.
+     *
+     * @return type of the brick (empty if not created from settings).
+     */
+    [[nodiscard]] std::string_view GetType() const noexcept {
+        return _type;
+    }
+
     /**
      * Get the hydro unit associated with the brick.
      *
@@ -333,6 +343,7 @@ class Brick {
 
   protected:
     string _name;
+    std::string_view _type;  // static brick type name
     bool _needsSolver;
     BrickCategory _category;
     std::unique_ptr<WaterContainer> _water;            // owning
@@ -18,6 +18,23 @@ BrickType BrickTypeFromString(const string& typeStr) {
     return BrickType::Unknown;
 }
 
+std::string_view BrickTypeToString(BrickType type) {
+    switch (type) {
+        case BrickType::Storage:
+            return "storage";
+        case BrickType::GenericLandCover:
+            return "generic_land_cover";
+        case BrickType::Glacier:
+            return "glacier";
+        case BrickType::Snowpack:
+            return "snowpack";
+        case BrickType::InterceptionStorage:
+            return "interception_storage";
+        default:
+            return {};
+    }
+}
+
 vector<string> GetValidBrickTypes() {
     static const vector<string> validTypes = {"storage",  "generic_land_cover",  "ground", "generic", "open", "glacier",
                                               "snowpack", "interception_storage"};
@@ -13,6 +13,14 @@
  */
 BrickType BrickTypeFromString(const string& typeStr);
 
+/**
+ * Get the canonical name of a brick type (synonyms are not returned).
+ *
+ * @param type the brick type.
+ * @return the name of the brick type (static storage), or an empty view if unknown.
+ */
+std::string_view BrickTypeToString(BrickType type);
+
 /**
  * Get a list of all valid brick type strings (including synonyms).
  *
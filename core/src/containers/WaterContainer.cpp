@@ -2,6 +2,7 @@
 
 #include "Brick.h"
 #include "FluxToBrickInstantaneous.h"
+#include "SolverDiagnostics.h"
 
 WaterContainer::WaterContainer(Brick* brick)
     : _content(0),
@@ -60,6 +61,12 @@ void WaterContainer::ApplyConstraints(double timeStep) {
     // amount in one step must therefore divide that amount by the timestep when reporting their
     // rate (e.g. ProcessOutflowSnowHolding). Here we clamp those rates so the content stays within
     // bounds (no negative content, and below the maximum capacity) over the timestep.
+    SolverDiagnostics* diagnostics = SolverDiagnostics::GetCurrent();
+    auto countClampedFlux = [diagnostics] {
+        if (diagnostics) {
+            diagnostics->clampedFluxes++;
+        }
+    };
 
     // Get outgoing change rates
     vecDoublePt outgoingRates;
@@ -80,6 +87,7 @@ void WaterContainer::ApplyConstraints(double timeStep) {
             assert(*changeRate < 10000);
             if (*changeRate < 0) {
                 *changeRate = 0;
+                countClampedFlux();
             } else if (*changeRate > 10000) {
                 throw RuntimeError(
                     std::format("Change rate {} in process {} is too high.", *changeRate, process->GetName()));
@@ -112,6 +120,7 @@ void WaterContainer::ApplyConstraints(double timeStep) {
         assert(*changeRate < 1000);
         if (*changeRate < 0) {
             *changeRate = 0;
+            countClampedFlux();
         }
         assert(GreaterThanOrEqual(*changeRate, 0, EPSILON_D));
         incomingRates.push_back(changeRate);
@@ -134,6 +143,7 @@ void WaterContainer::ApplyConstraints(double timeStep) {
             if (NearlyZero(*rate, EPSILON_D)) {
                 continue;
             }
+            countClampedFlux();
             if (NearlyEqual(diff, change, PRECISION)) {
                 *rate = 0;
                 continue;
@@ -150,6 +160,7 @@ void WaterContainer::ApplyConstraints(double timeStep) {
             if (HasOverflow()) {
                 if (_overflow->GetOutputFlux(0)->GetChangeRatePointer() != nullptr) {
                     *(_overflow->GetOutputFlux(0)->GetChangeRatePointer()) = diff;
+                    countClampedFlux();
                     return;
                 }
                 throw ShouldNotHappen(
@@ -169,6 +180,7 @@ void WaterContainer::ApplyConstraints(double timeStep) {
                     continue;
                 }
                 *rate -= diff * std::abs((*rate) / inputs);
+                countClampedFlux();
             }
         }
     }
@@ -2,11 +2,12 @@
 #define HYDROBRICKS_WATER_CONTAINER_H
 
 #include "Includes.h"
+#include "ModelArena.h"
 #include "Process.h"
 
 class Brick;
 
-class WaterContainer {
+class WaterContainer : public ArenaAllocated {
   public:
     WaterContainer(Brick* brick);
 
@@ -3,10 +3,11 @@
 
 #include "../base/ContentTypes.h"
 #include "Includes.h"
+#include "ModelArena.h"
 
 class Modifier;
 
-class Flux {
+class Flux : public ArenaAllocated {
   public:
     explicit Flux();
 
@@ -6,11 +6,12 @@
 #include "Flux.h"
 #include "Forcing.h"
 #include "Includes.h"
+#include "ModelArena.h"
 #include "SettingsModel.h"
 
 class HydroUnit;
 
-class Splitter {
+class Splitter : public ArenaAllocated {
   public:
     explicit Splitter();
 
@@ -0,0 +1,347 @@
+#include "CatchmentConnectivity.h"
+
+#include <array>
+#include <map>
+#include <unordered_map>
+
+
+namespace {
+
+constexpr int noUnit = -1;
+constexpr double minConnectivity = 0.01;
+
+// Neighbour offsets (row, col), counterclockwise from the east: E, NE, N, NW, W, SW, S, SE.
+constexpr int neighbourRows[8] = {0, -1, -1, -1, 0, 1, 1, 1};
+constexpr int neighbourCols[8] = {1, 1, 0, -1, -1, -1, 0, 1};
+
+struct Receiver {
+    int cell;
+    double fraction;
+};
+
+/**
+ * Get the neighbour index (counterclockwise from the east) of a D8 code (pysheds/ArcGIS convention).
+ */
+int GetD8Neighbour(int code) {
+    switch (code) {
+        case 1:
+            return 0;
+        case 128:
+            return 1;
+        case 64:
+            return 2;
+        case 32:
+            return 3;
+        case 16:
+            return 4;
+        case 8:
+            return 5;
+        case 4:
+            return 6;
+        case 2:
+            return 7;
+        default:
+            throw InputError(std::format("Unknown D8 flow direction code: {}", code));
+    }
+}
+
+/**
+ * Get the (up to two) receiving cells of a cell and the fraction of flow they receive.
+ */
+int GetReceivers(int r, int c, double direction, FlowRouting routing, int rows, int cols, Receiver receivers[2]) {
+    // D8 codes are strictly positive, while a D-inf angle of 0 points to the east.
+    if (std::isnan(direction) || direction < 0 || (routing == FlowRouting::D8 && direction == 0)) {
+        return 0;
+    }
+
+    int neighbours[2];
+    double fractions[2];
+    int count;
+    if (routing == FlowRouting::D8) {
+        neighbours[0] = GetD8Neighbour(static_cast<int>(direction));
+        fractions[0] = 1;
+        count = 1;
+    } else {
+        double facet = std::fmod(direction, 2 * constants::pi) / (constants::pi / 4);
+        auto first = static_cast<int>(std::floor(facet));
+        double proportion = facet - first;
+        neighbours[0] = first % 8;
+        fractions[0] = 1 - proportion;
+        neighbours[1] = (first + 1) % 8;
+        fractions[1] = proportion;
+        count = proportion > 0 ? 2 : 1;
+    }
+
+    int receiversNb = 0;
+    for (int k = 0; k < count; ++k) {
+        int rn = r + neighbourRows[neighbours[k]];
+        int cn = c + neighbourCols[neighbours[k]];
+        if (rn < 0 || rn >= rows || cn < 0 || cn >= cols) {
+            continue;
+        }
+        receivers[receiversNb++] = {rn * cols + cn, fractions[k]};
+    }
+
+    return receiversNb;
+}
+
+/**
+ * Get the unit index of every cell (row by row), noUnit for the cells outside of the catchment.
+ */
+vector<int> GetCellUnits(const axxi& unitMap, const vecInt& unitIds) {
+    std::unordered_map<int, int> unitIndices;
+    for (int i = 0; i < static_cast<int>(unitIds.size()); ++i) {
+        unitIndices[unitIds[i]] = i;
+    }
+
+    auto cols = static_cast<int>(unitMap.cols());
+    vector<int> cellUnits(unitMap.size(), noUnit);
+    for (int r = 0; r < unitMap.rows(); ++r) {
+        for (int c = 0; c < cols; ++c) {
+            int id = unitMap(r, c);
+            if (id == 0) {
+                continue;
+            }
+            auto it = unitIndices.find(id);
+            if (it == unitIndices.end()) {
+                throw InputError(std::format("The hydro unit {} of the map is not in the list of hydro units.", id));
+            }
+            cellUnits[r * cols + c] = it->second;
+        }
+    }
+
+    return cellUnits;
+}
+
+/**
+ * Count, for every unit, the cells of the other units sharing a border with it (4-connectivity).
+ */
+vector<std::map<int, double>> CountNeighbourCells(const vector<int>& cellUnits, int rows, int cols, int unitsNb) {
+    vector<std::map<int, double>> neighbours(unitsNb);
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            int unit = cellUnits[r * cols + c];
+            if (unit == noUnit) {
+                continue;
+            }
+            int adjacentUnits[4];
+            int adjacentNb = 0;
+            for (int k = 0; k < 8; k += 2) {
+                int rn = r + neighbourRows[k];
+                int cn = c + neighbourCols[k];
+                if (rn < 0 || rn >= rows || cn < 0 || cn >= cols) {
+                    continue;
+                }
+                int other = cellUnits[rn * cols + cn];
+                if (other == noUnit || other == unit ||
+                    std::find(adjacentUnits, adjacentUnits + adjacentNb, other) != adjacentUnits + adjacentNb) {
+                    continue;
+                }
+                adjacentUnits[adjacentNb++] = other;
+                neighbours[other][unit] += 1;
+            }
+        }
+    }
+
+    return neighbours;
+}
+
+void Normalize(std::map<int, double>& connections) {
+    double total = 0;
+    for (const auto& [receiver, value] : connections) {
+        total += value;
+    }
+    for (auto& [receiver, value] : connections) {
+        value /= total;
+    }
+}
+
+/**
+ * Round the fractions to the given precision while keeping their sum (largest remainder method).
+ */
+void RoundFractions(std::map<int, double>& connections, int precision) {
+    double scale = std::pow(10.0, precision);
+    double total = 0;
+    long long flooredTotal = 0;
+    vector<std::pair<int, double>> remainders;
+    std::map<int, long long> floored;
+    for (const auto& [receiver, value] : connections) {
+        total += value;
+        auto units = static_cast<long long>(value * scale);
+        floored[receiver] = units;
+        flooredTotal += units;
+        remainders.emplace_back(receiver, value * scale - static_cast<double>(units));
+    }
+
+    std::stable_sort(remainders.begin(), remainders.end(),
+                     [](const auto& a, const auto& b) { return a.second > b.second; });
+    long long diff = std::llround(total * scale) - flooredTotal;
+    for (long long i = 0; i < diff && i < static_cast<long long>(remainders.size()); ++i) {
+        floored[remainders[i].first] += 1;
+    }
+
+    for (auto& [receiver, value] : connections) {
+        value = static_cast<double>(floored[receiver]) / scale;
+    }
+}
+
+int GetMainReceiver(const std::map<int, double>& connections) {
+    auto main = std::max_element(connections.begin(), connections.end(),
+                                 [](const auto& a, const auto& b) { return a.second < b.second; });
+
+    return main->first;
+}
+
+}  // namespace
+
+FlowRouting GetFlowRoutingFromName(const string& name) {
+    if (StringsMatch(name, "d8")) {
+        return FlowRouting::D8;
+    }
+    if (StringsMatch(name, "dinf")) {
+        return FlowRouting::DInf;
+    }
+
+    throw InputError(std::format("Unknown flow routing: {}", name));
+}
+
+SparseMatrixd ComputeUnitFlowContributions(const axxi& unitMap, const axxd& flowDir, const vecInt& unitIds,
+                                           FlowRouting routing) {
+    if (unitMap.rows() != flowDir.rows() || unitMap.cols() != flowDir.cols()) {
+        throw InputError("The hydro unit map and the flow directions must have the same shape.");
+    }
+
+    auto rows = static_cast<int>(unitMap.rows());
+    auto cols = static_cast<int>(unitMap.cols());
+    auto unitsNb = static_cast<int>(unitIds.size());
+    int cellsNb = rows * cols;
+
+    vector<int> cellUnits = GetCellUnits(unitMap, unitIds);
+
+    // Receivers of every cell and number of donors within the same unit.
+    vector<std::array<Receiver, 2>> receivers(cellsNb);
+    vector<unsigned char> receiversNb(cellsNb, 0);
+    vector<int> donorsNb(cellsNb, 0);
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            int cell = r * cols + c;
+            if (cellUnits[cell] == noUnit) {
+                continue;
+            }
+            receiversNb[cell] = GetReceivers(r, c, flowDir(r, c), routing, rows, cols, receivers[cell].data());
+            for (int k = 0; k < receiversNb[cell]; ++k) {
+                if (cellUnits[receivers[cell][k].cell] == cellUnits[cell]) {
+                    donorsNb[receivers[cell][k].cell]++;
+                }
+            }
+        }
+    }
+
+    // Topological traversal from the cells without donors, accumulating the flow within the units.
+    vector<double> accumulation(cellsNb, 1.0);
+    vector<int> queue;
+    queue.reserve(cellsNb);
+    for (int cell = 0; cell < cellsNb; ++cell) {
+        if (cellUnits[cell] != noUnit && donorsNb[cell] == 0) {
+            queue.push_back(cell);
+        }
+    }
+
+    vector<Eigen::Triplet<double>> transfers;
+    for (size_t i = 0; i < queue.size(); ++i) {
+        int cell = queue[i];
+        int unit = cellUnits[cell];
+        for (int k = 0; k < receiversNb[cell]; ++k) {
+            const Receiver& receiver = receivers[cell][k];
+            int receiverUnit = cellUnits[receiver.cell];
+            double flow = accumulation[cell] * receiver.fraction;
+            if (receiverUnit == unit) {
+                accumulation[receiver.cell] += flow;
+                if (--donorsNb[receiver.cell] == 0) {
+                    queue.push_back(receiver.cell);
+                }
+            } else {
+                transfers.emplace_back(unit, receiverUnit == noUnit ? unitsNb : receiverUnit, flow);
+            }
+        }
+    }
+
+    SparseMatrixd contributions(unitsNb, unitsNb + 1);
+    contributions.setFromTriplets(transfers.begin(), transfers.end());
+
+    return contributions;
+}
+
+SparseMatrixd ComputeUnitConnectivity(const axxi& unitMap, const axxd& flowDir, const vecInt& unitIds,
+                                      const string& routing, const string& mode, bool forceConnectivity,
+                                      int precision) {
+    bool singleMode;
+    if (StringsMatch(mode, "multiple")) {
+        singleMode = false;
+    } else if (StringsMatch(mode, "single")) {
+        singleMode = true;
+    } else {
+        throw InputError(std::format("Unknown connectivity mode: {}", mode));
+    }
+
+    SparseMatrixd contributions =
+        ComputeUnitFlowContributions(unitMap, flowDir, unitIds, GetFlowRoutingFromName(routing));
+
+    auto unitsNb = static_cast<int>(unitIds.size());
+    int outside = unitsNb;
+    vector<std::map<int, double>> neighbours;
+
+    vector<Eigen::Triplet<double>> fractions;
+    for (int unit = 0; unit < unitsNb; ++unit) {
+        std::map<int, double> connections;
+        for (SparseMatrixd::InnerIterator it(contributions, unit); it; ++it) {
+            connections[static_cast<int>(it.col())] = it.value();
+        }
+
+        if (forceConnectivity) {
+            connections.erase(outside);
+            if (connections.empty()) {
+                if (neighbours.empty()) {
+                    neighbours = CountNeighbourCells(GetCellUnits(unitMap, unitIds), static_cast<int>(unitMap.rows()),
+                                                     static_cast<int>(unitMap.cols()), unitsNb);
+                }
+                connections = neighbours[unit];
+            }
+        }
+
+        if (connections.empty()) {
+            continue;
+        }
+
+        // A unit draining mostly out of the catchment is not connected.
+        int mainReceiver = GetMainReceiver(connections);
+        if (mainReceiver == outside) {
+            continue;
+        }
+
+        if (singleMode) {
+            fractions.emplace_back(unit, mainReceiver, 1.0);
+            continue;
+        }
+
+        connections.erase(outside);
+        Normalize(connections);
+        std::erase_if(connections, [](const auto& item) { return item.second < minConnectivity; });
+        if (connections.empty()) {
+            continue;
+        }
+        Normalize(connections);
+        RoundFractions(connections, precision);
+
+        for (const auto& [receiver, fraction] : connections) {
+            if (fraction > 0) {
+                fractions.emplace_back(unit, receiver, fraction);
+            }
+        }
+    }
+
+    SparseMatrixd connectivity(unitsNb, unitsNb);
+    connectivity.setFromTriplets(fractions.begin(), fractions.end());
+
+    return connectivity;
+}
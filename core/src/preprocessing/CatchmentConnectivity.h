@@ -0,0 +1,67 @@
+#ifndef HYDROBRICKS_CATCHMENT_CONNECTIVITY_H
+#define HYDROBRICKS_CATCHMENT_CONNECTIVITY_H
+
+#include <Eigen/Sparse>
+
+#include "Includes.h"
+
+using SparseMatrixd = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+
+enum class FlowRouting {
+    D8,
+    DInf
+};
+
+/**
+ * Get the flow routing scheme from its name ('d8' or 'dinf').
+ *
+ * @param name The routing name.
+ * @return The corresponding flow routing.
+ * @throws InputError if the routing is unknown.
+ */
+FlowRouting GetFlowRoutingFromName(const string& name);
+
+/**
+ * Compute the flow transferred between hydro units from the flow directions.
+ *
+ * The flow accumulation is computed within each hydro unit (the flow paths are cut at the unit
+ * boundaries) in a single topological traversal of the grid. Every cell draining into another unit
+ * adds its accumulated flow (in number of cells) to the corresponding giver-receiver entry. Cells
+ * draining out of the grid are ignored and cells draining to cells without unit (id 0) are counted
+ * in the last column (outside of the catchment). Cells on a flow cycle are not accounted for.
+ *
+ * @param unitMap The hydro unit id of each cell (0: outside of the catchment).
+ * @param flowDir The flow directions: D8 codes (1: E, 2: SE, 4: S, ..., 128: NE) or D-inf angles
+ * [rad, counterclockwise from the east]. Negative or NaN values denote cells without direction.
+ * @param unitIds The ids of the hydro units (defines the matrix indices).
+ * @param routing The flow routing scheme of the flow directions.
+ * @return The transferred flow [giver x (receiver + outside)].
+ * @throws InputError if the rasters have different shapes or contain unknown ids or codes.
+ */
+SparseMatrixd ComputeUnitFlowContributions(const axxi& unitMap, const axxd& flowDir, const vecInt& unitIds,
+                                           FlowRouting routing = FlowRouting::D8);
+
+/**
+ * Compute the lateral connectivity between hydro units (fraction of the flow of each unit going to
+ * the other units).
+ *
+ * A unit draining mostly out of the catchment gets no connection, unless forceConnectivity is set.
+ * In that case, the flow leaving the catchment is discarded and the units without any downstream
+ * unit are connected to their neighbours, proportionally to the length of the common border.
+ * In the 'multiple' mode, the connections below 1% are removed and the fractions are rounded to the
+ * given precision while summing to 1. In the 'single' mode, only the main connection is kept.
+ *
+ * @param unitMap The hydro unit id of each cell (0: outside of the catchment).
+ * @param flowDir The flow directions (see ComputeUnitFlowContributions).
+ * @param unitIds The ids of the hydro units (defines the matrix indices).
+ * @param routing The flow routing scheme name ('d8' or 'dinf').
+ * @param mode The connectivity mode ('multiple' or 'single').
+ * @param forceConnectivity Option to force every unit to be connected to another unit.
+ * @param precision The number of decimals of the fractions.
+ * @return The connectivity fractions [giver x receiver].
+ */
+SparseMatrixd ComputeUnitConnectivity(const axxi& unitMap, const axxd& flowDir, const vecInt& unitIds,
+                                      const string& routing = "d8", const string& mode = "multiple",
+                                      bool forceConnectivity = false, int precision = 3);
+
+#endif  // HYDROBRICKS_CATCHMENT_CONNECTIVITY_H
@@ -0,0 +1,279 @@
+#include "GlacierDeltaH.h"
+
+#include "ActionGlacierEvolutionDeltaH.h"
+
+namespace {
+
+constexpr double iceWE = constants::iceDensity / constants::waterDensity;
+
+struct DeltaHCoefficients {
+    double a;
+    double b;
+    double c;
+    double gamma;
+};
+
+/**
+ * Delta-h parametrization depending on the glacier size (Huss et al., 2010, Fig. 2a).
+ */
+DeltaHCoefficients GetDeltaHCoefficients(double glacierAreaKm2) {
+    if (glacierAreaKm2 > 20) {  // Large valley glacier
+        return {-0.02, 0.12, 0.00, 6};
+    }
+    if (glacierAreaKm2 >= 5) {  // Medium valley glacier
+        return {-0.05, 0.19, 0.01, 4};
+    }
+    if (glacierAreaKm2 > 0) {  // Small glacier
+        return {-0.30, 0.60, 0.09, 2};
+    }
+
+    throw InputError(std::format("No glacier area available to set the delta-h parametrization ({} km2).",
+                                 glacierAreaKm2));
+}
+
+/**
+ * Linear interpolation with constant extrapolation (as numpy.interp), xp being sorted in increasing order.
+ */
+double Interpolate(double x, const axd& xp, const axd& fp) {
+    auto size = static_cast<int>(xp.size());
+    if (x <= xp[0]) {
+        return fp[0];
+    }
+    if (x >= xp[size - 1]) {
+        return fp[size - 1];
+    }
+    int i = static_cast<int>(std::upper_bound(xp.data(), xp.data() + size, x) - xp.data());
+    double w = (x - xp[i - 1]) / (xp[i] - xp[i - 1]);
+
+    return fp[i - 1] + w * (fp[i] - fp[i - 1]);
+}
+
+}  // namespace
+
+GlacierDeltaH::GlacierDeltaH(const axd& elevations, const axd& areas, const axd& thicknesses,
+                             const axi& hydroUnitIds, double catchmentArea)
+    : _catchmentArea(catchmentArea) {
+    auto size = static_cast<int>(elevations.size());
+    if (areas.size() != size || thicknesses.size() != size || hydroUnitIds.size() != size) {
+        throw InputError("The glacier profile columns (elevation, area, thickness, hydro unit) differ in length.");
+    }
+    if (catchmentArea <= 0) {
+        throw InputError("The catchment area must be positive.");
+    }
+
+    // Remove the parts with no glacier area (otherwise the min and max elevations are wrong).
+    vector<int> kept;
+    for (int i = 0; i < size; ++i) {
+        if (areas[i] != 0) {
+            kept.push_back(i);
+        }
+    }
+    if (kept.empty()) {
+        throw InputError("The glacier profile contains no glacier area.");
+    }
+
+    auto partsNb = static_cast<int>(kept.size());
+    _elevationParts.resize(partsNb);
+    _unitIdParts.resize(partsNb);
+    _initialWEParts.resize(partsNb);
+    _initialAreasParts.resize(partsNb);
+    for (int p = 0; p < partsNb; ++p) {
+        _elevationParts[p] = elevations[kept[p]];
+        _unitIdParts[p] = hydroUnitIds[kept[p]];
+        _initialWEParts[p] = thicknesses[kept[p]] * iceWE * 1000;
+        _initialAreasParts[p] = areas[kept[p]] / catchmentArea;
+    }
+
+    // Elevation bands: the parts can subdivide an elevation band (e.g. between hydro units).
+    vector<double> bands(_elevationParts.begin(), _elevationParts.end());
+    std::ranges::sort(bands);
+    bands.erase(std::unique(bands.begin(), bands.end()), bands.end());
+    _elevationBands = Eigen::Map<axd>(bands.data(), static_cast<Eigen::Index>(bands.size()));
+    _bandIndices.resize(partsNb);
+    for (int p = 0; p < partsNb; ++p) {
+        _bandIndices[p] = static_cast<int>(std::ranges::lower_bound(bands, _elevationParts[p]) - bands.begin());
+    }
+
+    vector<int> unitIds(_unitIdParts.begin(), _unitIdParts.end());
+    std::ranges::sort(unitIds);
+    unitIds.erase(std::unique(unitIds.begin(), unitIds.end()), unitIds.end());
+    _unitIds = Eigen::Map<axi>(unitIds.data(), static_cast<Eigen::Index>(unitIds.size()));
+}
+
+void GlacierDeltaH::SetObservedDeltaH(const axd& normalizedElevations, const axd& normalizedDeltaH) {
+    if (normalizedElevations.size() != normalizedDeltaH.size() || normalizedElevations.size() == 0) {
+        throw InputError("The observed delta-h values and normalized elevations differ in length or are empty.");
+    }
+
+    // Sort the observations by increasing normalized elevation for the interpolation.
+    vector<int> order(normalizedElevations.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::ranges::sort(order, [&](int i, int j) { return normalizedElevations[i] < normalizedElevations[j]; });
+    _observedElevations = normalizedElevations(order);
+    _observedDeltaH = normalizedDeltaH(order);
+}
+
+void GlacierDeltaH::Compute(int incrementsNb, bool updateWidth, const string& updateWidthReference) {
+    if (incrementsNb < 1) {
+        throw InputError("The number of increments must be at least 1.");
+    }
+    if (updateWidthReference != "initial" && updateWidthReference != "previous") {
+        throw InputError(
+            std::format("The width update reference should be 'initial' or 'previous' ('{}' given).",
+                        updateWidthReference));
+    }
+
+    auto partsNb = static_cast<int>(_elevationParts.size());
+    auto bandsNb = static_cast<int>(_elevationBands.size());
+
+    _weParts = axxd::Zero(incrementsNb + 1, partsNb);
+    _areasParts = axxd::Zero(incrementsNb + 1, partsNb);
+    _weParts.row(0) = _initialWEParts.transpose();
+    _areasParts.row(0) = _initialAreasParts.transpose();
+
+    // Initial state per elevation band (area-weighted water equivalent of the parts).
+    _weBands = axxd::Zero(incrementsNb + 1, bandsNb);
+    _areasBands = axxd::Zero(incrementsNb + 1, bandsNb);
+    for (int p = 0; p < partsNb; ++p) {
+        _areasBands(0, _bandIndices[p]) += _initialAreasParts[p];
+    }
+    for (int p = 0; p < partsNb; ++p) {
+        int b = _bandIndices[p];
+        _weBands(0, b) += _initialWEParts[p] * _initialAreasParts[p] / _areasBands(0, b);
+    }
+
+    // Step 1 (Seibert et al., 2018): initial glacier mass (Eq. 2) and parametrization.
+    double initialTotalWE = (_initialAreasParts * _initialWEParts).sum();
+    axd normDeltaWE = ComputeNormalizedDeltaH();
+
+    // Steps 2 to 4, the last increment being kept without glacier.
+    double excessMeltWE = 0;
+    for (int i = 1; i < incrementsNb; ++i) {
+        // Scaling factor (Eq. 5), including the excess melt of the previous increment.
+        double weChange = initialTotalWE / incrementsNb + excessMeltWE;
+        double scalingFactor = weChange / (_areasBands.row(i - 1).transpose() * normDeltaWE).sum();
+
+        // Glacier thickness update (Eq. 6). The melt exceeding the remaining ice is carried over.
+        axd newWE = _weBands.row(i - 1).transpose() - scalingFactor * normDeltaWE;
+        _weBands.row(i) = newWE.max(0.0).transpose();
+        excessMeltWE = -(newWE.min(0.0) * _areasBands.row(i - 1).transpose()).sum();
+
+        if (updateWidth) {
+            ScaleWidth(i, updateWidthReference);
+        } else {
+            _areasBands.row(i) = _areasBands.row(i - 1);
+            _areasBands.row(i) = (_weBands.row(i) == 0).select(0.0, _areasBands.row(i));
+        }
+    }
+
+    if (!updateWidth) {
+        ScaleWidthFinal();
+    }
+
+    ComputeParts();
+    UpdateLookupTables();
+}
+
+axd GlacierDeltaH::ComputeNormalizedDeltaH() const {
+    double maxElevation = _elevationParts.maxCoeff();
+    double minElevation = _elevationParts.minCoeff();
+
+    // Normalized elevations (Eq. 3): 0 at the top, 1 at the tongue. A single band is handled as a tongue.
+    axd normElevations = axd::Ones(_elevationBands.size());
+    if (maxElevation > minElevation) {
+        normElevations = (maxElevation - _elevationBands) / (maxElevation - minElevation);
+    }
+
+    // Delta-h (Eq. 4), either observed or parametrized.
+    axd normDeltaWE(normElevations.size());
+    if (_observedElevations.size() > 0) {
+        for (int b = 0; b < normElevations.size(); ++b) {
+            normDeltaWE[b] = Interpolate(normElevations[b], _observedElevations, _observedDeltaH);
+        }
+        return normDeltaWE;
+    }
+
+    double glacierAreaKm2 = _initialAreasParts.sum() * _catchmentArea / (1000 * 1000);
+    DeltaHCoefficients coeffs = GetDeltaHCoefficients(glacierAreaKm2);
+    normDeltaWE = (normElevations + coeffs.a).pow(coeffs.gamma) + coeffs.b * (normElevations + coeffs.a) + coeffs.c;
+
+    return normDeltaWE;
+}
+
+void GlacierDeltaH::ScaleWidth(int increment, const string& updateWidthReference) {
+    int ref = updateWidthReference == "previous" ? increment - 1 : 0;
+    for (int b = 0; b < _weBands.cols(); ++b) {
+        if (_weBands(ref, b) > 0) {
+            _areasBands(increment, b) = _areasBands(ref, b) * std::sqrt(_weBands(increment, b) / _weBands(ref, b));
+        }
+    }
+
+    for (int b = 0; b < _weBands.cols(); ++b) {
+        if (_weBands(increment, b) > 0) {
+            // Conservation of the water equivalent.
+            _weBands(increment, b) *= _areasBands(increment - 1, b) / _areasBands(increment, b);
+        } else {
+            _areasBands(increment, b) = 0;
+        }
+    }
+}
+
+void GlacierDeltaH::ScaleWidthFinal() {
+    for (int i = 1; i < _weBands.rows(); ++i) {
+        for (int b = 0; b < _weBands.cols(); ++b) {
+            if (_weBands(0, b) > 0) {
+                _areasBands(i, b) = _areasBands(0, b) * std::sqrt(_weBands(i, b) / _weBands(0, b));
+            }
+            if (_weBands(i, b) > 0) {
+                _weBands(i, b) *= _areasBands(0, b) / _areasBands(i, b);
+            }
+        }
+    }
+}
+
+void GlacierDeltaH::ComputeParts() {
+    for (int i = 1; i < _weBands.rows(); ++i) {
+        for (int p = 0; p < _weParts.cols(); ++p) {
+            int b = _bandIndices[p];
+
+            // Water equivalent of the parts decreasing proportionally to the band water equivalent.
+            if (_weBands(i, b) == 0) {
+                _weParts(i, p) = 0;
+                _areasParts(i, p) = 0;
+                continue;
+            }
+            _weParts(i, p) = _weParts(0, p) * _weBands(i, b) / _weBands(0, b);
+
+            // Areas of the parts scaled proportionally to the band area.
+            if (_weParts(i, p) > 0) {
+                _areasParts(i, p) = _areasParts(0, p) * _areasBands(i, b) / _areasBands(0, b);
+            } else {
+                _areasParts(i, p) = 0;
+            }
+        }
+    }
+}
+
+void GlacierDeltaH::UpdateLookupTables() {
+    auto unitsNb = static_cast<int>(_unitIds.size());
+    _tableArea = axxd::Zero(_weParts.rows(), unitsNb);
+    _tableVolume = axxd::Zero(_weParts.rows(), unitsNb);
+
+    // Step 5 (Seibert et al., 2018): sum the (width-scaled) areas and volumes of the parts per hydro unit.
+    for (int p = 0; p < _weParts.cols(); ++p) {
+        auto u = static_cast<int>(std::lower_bound(_unitIds.begin(), _unitIds.end(), _unitIdParts[p]) -
+                                  _unitIds.begin());
+        axd areas = _areasParts.col(p) * _catchmentArea;
+        _tableArea.col(u) += areas;
+        _tableVolume.col(u) += _weParts.col(p) * areas / (iceWE * 1000);
+    }
+}
+
+void GlacierDeltaH::AddLookupTablesTo(ActionGlacierEvolutionDeltaH& action, int month,
+                                      const string& landCoverName) const {
+    if (_tableArea.size() == 0) {
+        throw ModelConfigError("The delta-h lookup tables were not computed.");
+    }
+
+    action.AddLookupTables(month, landCoverName, _unitIds, _tableArea, _tableVolume);
+}
@@ -0,0 +1,169 @@
+#ifndef HYDROBRICKS_GLACIER_DELTA_H_H
+#define HYDROBRICKS_GLACIER_DELTA_H_H
+
+#include "Includes.h"
+
+class ActionGlacierEvolutionDeltaH;
+
+/**
+ * Generator of the glacier evolution lookup tables with the delta-h method (Huss et al., 2010)
+ * following the lookup table approach of Seibert et al. (2018).
+ *
+ * The glacier profile is given by parts: elevation bands (usually 10 m high), possibly split between
+ * several hydro units. The mass balance is computed per elevation band, for a given number of melt
+ * increments, and then redistributed to the parts and synthesized per hydro unit.
+ */
+class GlacierDeltaH {
+  public:
+    /**
+     * Set up the glacier profile. The parts without glacier area are discarded.
+     *
+     * @param elevations The elevation of each part [m].
+     * @param areas The glacier area of each part [m2].
+     * @param thicknesses The glacier thickness of each part [m].
+     * @param hydroUnitIds The hydro unit ID of each part.
+     * @param catchmentArea The catchment area [m2].
+     * @throws InputError if the profile is inconsistent or contains no glacier.
+     */
+    GlacierDeltaH(const axd& elevations, const axd& areas, const axd& thicknesses, const axi& hydroUnitIds,
+                  double catchmentArea);
+
+    /**
+     * Use observed normalized ice thickness changes instead of the Huss et al. (2010) parametrization.
+     *
+     * @param normalizedElevations The normalized elevations of the observations (0: top, 1: tongue).
+     * @param normalizedDeltaH The normalized ice thickness changes.
+     */
+    void SetObservedDeltaH(const axd& normalizedElevations, const axd& normalizedDeltaH);
+
+    /**
+     * Compute the lookup tables.
+     *
+     * @param incrementsNb The number of melt increments.
+     * @param updateWidth Option to update the glacier width at each increment (Eq. 7 Seibert et al., 2018).
+     * @param updateWidthReference The reference of the width update: 'initial' or 'previous'.
+     */
+    void Compute(int incrementsNb = 200, bool updateWidth = true, const string& updateWidthReference = "initial");
+
+    /**
+     * Add the lookup tables to a glacier evolution action.
+     *
+     * @param action The action to feed.
+     * @param month The month of the year (1-12) at which the action is applied.
+     * @param landCoverName The name of the glacier land cover.
+     */
+    void AddLookupTablesTo(ActionGlacierEvolutionDeltaH& action, int month, const string& landCoverName) const;
+
+    /**
+     * Get the hydro unit IDs (columns of the lookup tables), sorted.
+     *
+     * @return The hydro unit IDs.
+     */
+    const axi& GetHydroUnitIds() const {
+        return _unitIds;
+    }
+
+    /**
+     * Get the glacier area lookup table.
+     *
+     * @return The glacier area [m2] (rows: increments, columns: hydro units).
+     */
+    const axxd& GetLookupTableArea() const {
+        return _tableArea;
+    }
+
+    /**
+     * Get the glacier volume lookup table.
+     *
+     * @return The glacier volume [m3] (rows: increments, columns: hydro units).
+     */
+    const axxd& GetLookupTableVolume() const {
+        return _tableVolume;
+    }
+
+    /**
+     * Get the glacier water equivalent of the parts.
+     *
+     * @return The glacier water equivalent [mm] (rows: increments, columns: parts).
+     */
+    const axxd& GetWaterEquivalentParts() const {
+        return _weParts;
+    }
+
+    /**
+     * Get the glacier area of the parts.
+     *
+     * @return The glacier area as a fraction of the catchment area (rows: increments, columns: parts).
+     */
+    const axxd& GetAreaFractionParts() const {
+        return _areasParts;
+    }
+
+    /**
+     * Get the elevation of the parts (after discarding the parts without glacier).
+     *
+     * @return The elevation of the parts [m].
+     */
+    const axd& GetElevationParts() const {
+        return _elevationParts;
+    }
+
+    /**
+     * Get the hydro unit ID of the parts (after discarding the parts without glacier).
+     *
+     * @return The hydro unit ID of the parts.
+     */
+    const axi& GetHydroUnitIdParts() const {
+        return _unitIdParts;
+    }
+
+  protected:
+    double _catchmentArea;
+    axd _elevationParts;
+    axi _unitIdParts;
+    axd _initialWEParts;     // [mm]
+    axd _initialAreasParts;  // fraction of the catchment area
+    axd _elevationBands;     // unique elevations, sorted
+    axi _bandIndices;        // band index of each part
+    axd _observedElevations;
+    axd _observedDeltaH;
+    axi _unitIds;
+    axxd _weBands;
+    axxd _areasBands;
+    axxd _weParts;
+    axxd _areasParts;
+    axxd _tableArea;
+    axxd _tableVolume;
+
+    /**
+     * Compute the normalized ice thickness change of every elevation band (Eq. 4).
+     *
+     * @return The normalized ice thickness change per band.
+     */
+    axd ComputeNormalizedDeltaH() const;
+
+    /**
+     * Apply the width scaling of an increment (Eq. 7) and the conservation of the water equivalent.
+     *
+     * @param increment The increment.
+     * @param updateWidthReference The reference of the width update: 'initial' or 'previous'.
+     */
+    void ScaleWidth(int increment, const string& updateWidthReference);
+
+    /**
+     * Apply the width scaling to all increments once the thicknesses are known (no width update).
+     */
+    void ScaleWidthFinal();
+
+    /**
+     * Redistribute the band areas and water equivalents to the parts of the bands.
+     */
+    void ComputeParts();
+
+    /**
+     * Sum the parts per hydro unit into the lookup tables.
+     */
+    void UpdateLookupTables();
+};
+
+#endif  // HYDROBRICKS_GLACIER_DELTA_H_H
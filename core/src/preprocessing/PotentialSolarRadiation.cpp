@@ -0,0 +1,243 @@
+#include "PotentialSolarRadiation.h"
+
+#include "Parallel.h"
+
+namespace {
+
+constexpr int daysNb = 366;
+constexpr double toRad = constants::pi / 180.0;
+constexpr double toDeg = 180.0 / constants::pi;
+
+constexpr double solarConstant = 1368;            // [W/m²]
+constexpr double earthSunSemiMajorAxis = 149.6;   // mean Sun-Earth distance [10^6 km]
+constexpr double earthSunEccentricity = 0.017;
+constexpr double seaAtmPressure = 101325;         // [Pa]
+constexpr double seaSurfaceTemperature = 288;     // [K]
+constexpr double temperatureLapseRate = -0.0065;  // [K/m]
+constexpr double gravity = 9.80665;               // [m/s²]
+constexpr double gasConstant = 8.31432;           // [J/(mol·K)]
+constexpr double airMolarMass = 0.0289644;        // [kg/mol]
+
+struct SunPosition {
+    double zenith;   // [degrees]
+    double azimuth;  // relative to the south [degrees]
+};
+
+double GetSolarDeclination(int dayOfYear) {
+    return 23.45 * std::cos(360.0 * (dayOfYear - 172) / 365.0 * toRad) * toRad;
+}
+
+/**
+ * Get the sun positions above the horizon for a day (same hour angles as the Python implementation).
+ */
+vector<SunPosition> GetSunPositions(int dayOfYear, double latitude, int stepsPerHour) {
+    double declination = GetSolarDeclination(dayOfYear);
+    double hourAngleLimit = std::acos(std::clamp(-std::tan(declination) * std::tan(latitude), -1.0, 1.0));
+    double timeInterval = 15.0 / stepsPerHour * toRad;
+    auto stepsNb = static_cast<int>(std::ceil((2 * hourAngleLimit + timeInterval) / timeInterval));
+
+    vector<SunPosition> positions;
+    positions.reserve(stepsNb);
+    for (int i = 0; i < stepsNb; ++i) {
+        double hourAngle = -hourAngleLimit + i * timeInterval;
+        double cosZenith = std::sin(latitude) * std::sin(declination) +
+                           std::cos(latitude) * std::cos(declination) * std::cos(hourAngle);
+        double zenith = std::acos(std::clamp(cosZenith, -1.0, 1.0)) * toDeg;
+        if (zenith >= 90) {
+            continue;
+        }
+
+        double azimuth = std::atan(std::sin(hourAngle) / (std::sin(latitude) * std::cos(hourAngle) -
+                                                          std::cos(latitude) * std::tan(declination))) *
+                         toDeg;
+        if (azimuth < 0 && hourAngle > 0) {
+            azimuth += 180;
+        } else if (azimuth > 0 && hourAngle < 0) {
+            azimuth -= 180;
+        }
+        positions.push_back({zenith, azimuth});
+    }
+
+    return positions;
+}
+
+int GetAzimuthSector(double azimuth, int sectorsNb) {
+    auto sector = static_cast<int>(std::lround((azimuth + 180.0) / 360.0 * sectorsNb));
+
+    return (sector % sectorsNb + sectorsNb) % sectorsNb;
+}
+
+double GetSectorAzimuth(int sector, int sectorsNb) {
+    return -180.0 + 360.0 * sector / sectorsNb;
+}
+
+}  // namespace
+
+axxd ComputeHorizonTangents(const axxd& dem, double pixelSize, double azimuth) {
+    auto rows = static_cast<int>(dem.rows());
+    auto cols = static_cast<int>(dem.cols());
+
+    // Direction towards the sun in grid coordinates (rows increase southwards), normalized to one pixel
+    // along the main axis.
+    double dRow = std::cos(azimuth * toRad);
+    double dCol = -std::sin(azimuth * toRad);
+    double norm = std::max(std::abs(dRow), std::abs(dCol));
+    dRow /= norm;
+    dCol /= norm;
+    double stepLength = std::sqrt(dRow * dRow + dCol * dCol) * pixelSize;
+
+    double maxElevation = -std::numeric_limits<double>::infinity();
+    for (double z : dem.reshaped()) {
+        if (!std::isnan(z)) {
+            maxElevation = std::max(maxElevation, z);
+        }
+    }
+
+    axxd horizon = axxd::Constant(rows, cols, -std::numeric_limits<double>::infinity());
+    for (int c = 0; c < cols; ++c) {
+        for (int r = 0; r < rows; ++r) {
+            double z0 = dem(r, c);
+            if (std::isnan(z0)) {
+                continue;
+            }
+            double best = -std::numeric_limits<double>::infinity();
+            for (int k = 1;; ++k) {
+                auto rk = static_cast<int>(std::lround(r + k * dRow));
+                auto ck = static_cast<int>(std::lround(c + k * dCol));
+                if (rk < 0 || rk >= rows || ck < 0 || ck >= cols) {
+                    break;
+                }
+                double distance = k * stepLength;
+                if ((maxElevation - z0) / distance <= best) {
+                    break;
+                }
+                double z = dem(rk, ck);
+                if (!std::isnan(z)) {
+                    best = std::max(best, (z - z0) / distance);
+                }
+            }
+            horizon(r, c) = best;
+        }
+    }
+
+    return horizon;
+}
+
+axxd ComputeDailyPotentialRadiation(const axxd& dem, const axxd& slope, const axxd& aspect, double pixelSize,
+                                    double latitude, double elevation, double atmosTransmissivity, int stepsPerHour,
+                                    bool withCastShadows, int azimuthSectorsNb, int threadsNb) {
+    if (slope.rows() != dem.rows() || slope.cols() != dem.cols() || aspect.rows() != dem.rows() ||
+        aspect.cols() != dem.cols()) {
+        throw InputError("The DEM, slope and aspect must have the same shape.");
+    }
+    if (pixelSize <= 0) {
+        throw InputError("The pixel size must be positive.");
+    }
+    if (stepsPerHour < 1) {
+        throw InputError("The number of steps per hour must be at least 1.");
+    }
+    if (azimuthSectorsNb < 1) {
+        throw InputError("The number of azimuth sectors must be at least 1.");
+    }
+
+    auto rows = static_cast<int>(dem.rows());
+    auto cols = static_cast<int>(dem.cols());
+    int cellsNb = rows * cols;
+    double latitudeRad = latitude * toRad;
+
+    // Terms of the angle of incidence that only depend on the terrain, stored row by row:
+    // cos(incidence) = cos(z) * a + sin(z) * (cos(azimuth) * b + sin(azimuth) * c).
+    vector<double> termA(cellsNb), termB(cellsNb), termC(cellsNb);
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            int i = r * cols + c;
+            double slopeRad = slope(r, c) * toRad;
+            double aspectRad = (aspect(r, c) - 180) * toRad;
+            termA[i] = std::cos(slopeRad);
+            termB[i] = std::sin(slopeRad) * std::cos(aspectRad);
+            termC[i] = std::sin(slopeRad) * std::sin(aspectRad);
+        }
+    }
+
+    vector<vector<SunPosition>> sunPositions(daysNb);
+    for (int d = 0; d < daysNb; ++d) {
+        sunPositions[d] = GetSunPositions(d + 1, latitudeRad, stepsPerHour);
+    }
+
+    // Horizon cache: computed once for each azimuth sector reached by the sun.
+    vector<axxd> horizons(azimuthSectorsNb);
+    if (withCastShadows) {
+        vector<int> usedSectors;
+        vector<bool> isUsed(azimuthSectorsNb, false);
+        for (const auto& positions : sunPositions) {
+            for (const auto& position : positions) {
+                int sector = GetAzimuthSector(position.azimuth, azimuthSectorsNb);
+                if (!isUsed[sector]) {
+                    isUsed[sector] = true;
+                    usedSectors.push_back(sector);
+                }
+            }
+        }
+        ParallelFor(
+            static_cast<int>(usedSectors.size()),
+            [&](int start, int end) {
+                for (int i = start; i < end; ++i) {
+                    int sector = usedSectors[i];
+                    horizons[sector] =
+                        ComputeHorizonTangents(dem, pixelSize, GetSectorAzimuth(sector, azimuthSectorsNb));
+                }
+            },
+            threadsNb);
+    }
+
+    // Atmospheric pressure at the mean elevation.
+    double localPressure = seaAtmPressure * std::pow(1 + temperatureLapseRate / seaSurfaceTemperature * elevation,
+                                                     -gravity * airMolarMass / (gasConstant * temperatureLapseRate));
+
+    axxdRowMajor radiation = axxdRowMajor::Zero(daysNb, cellsNb);
+    ParallelFor(
+        daysNb,
+        [&](int start, int end) {
+            for (int d = start; d < end; ++d) {
+                int dayOfYear = d + 1;
+                double theta = 360.0 / 365.5 * dayOfYear;
+                double sunDistance = earthSunSemiMajorAxis * (1 - earthSunEccentricity * earthSunEccentricity) /
+                                     (1 + earthSunEccentricity * std::cos(theta * toRad));
+                double distanceFactor = std::pow(earthSunSemiMajorAxis / sunDistance, 2);
+
+                for (const auto& position : sunPositions[d]) {
+                    double cosZenith = std::cos(position.zenith * toRad);
+                    double sinZenith = std::sin(position.zenith * toRad);
+                    double cosAzimuth = std::cos(position.azimuth * toRad);
+                    double sinAzimuth = std::sin(position.azimuth * toRad);
+                    double sunTangent = cosZenith / sinZenith;  // tangent of the solar elevation
+                    double clearSky = solarConstant * distanceFactor *
+                                      std::pow(atmosTransmissivity, localPressure / (seaAtmPressure * cosZenith));
+                    const axxd* horizon = nullptr;
+                    if (withCastShadows) {
+                        horizon = &horizons[GetAzimuthSector(position.azimuth, azimuthSectorsNb)];
+                    }
+
+                    for (int r = 0; r < rows; ++r) {
+                        for (int c = 0; c < cols; ++c) {
+                            int i = r * cols + c;
+                            if (horizon && (*horizon)(r, c) > sunTangent) {
+                                continue;
+                            }
+                            double cosIncidence =
+                                cosZenith * termA[i] + sinZenith * (cosAzimuth * termB[i] + sinAzimuth * termC[i]);
+                            if (std::isnan(cosIncidence) || cosIncidence <= 0) {
+                                continue;
+                            }
+                            radiation(d, i) += clearSky * std::min(cosIncidence, 1.0);
+                        }
+                    }
+                }
+
+                radiation.row(d) /= 24.0 * stepsPerHour;
+            }
+        },
+        threadsNb);
+
+    return radiation;
+}
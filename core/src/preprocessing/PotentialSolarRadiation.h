@@ -0,0 +1,48 @@
+#ifndef HYDROBRICKS_POTENTIAL_SOLAR_RADIATION_H
+#define HYDROBRICKS_POTENTIAL_SOLAR_RADIATION_H
+
+#include "Includes.h"
+
+/**
+ * Compute the tangent of the horizon angle of every DEM cell in a given direction.
+ *
+ * The ray starting at each cell is walked one pixel at a time towards the given azimuth and the
+ * steepest elevation angle encountered is kept. The walk stops early once no remaining cell can
+ * exceed the current horizon (based on the maximum DEM elevation). Missing (NaN) cells are skipped.
+ *
+ * @param dem The DEM [rows x cols] (north up).
+ * @param pixelSize The pixel size [m].
+ * @param azimuth The azimuth of the direction, relative to the south [degrees] (negative towards the east).
+ * @return The tangent of the horizon angle [rows x cols] (-inf when the horizon is below the cell).
+ */
+axxd ComputeHorizonTangents(const axxd& dem, double pixelSize, double azimuth);
+
+/**
+ * Compute the daily mean potential clear-sky direct solar radiation at the DEM surface [W/m²] using
+ * the Hock (1999) equation, for each day of the year (1-366).
+ *
+ * The radiation is corrected for the slope and aspect of the terrain (angle of incidence) and,
+ * optionally, for the cast shadows of the surrounding terrain. Instead of tilting the DEM for every
+ * sun position, the horizon angles are computed once per azimuth sector (and only for the sectors
+ * reached by the sun) and shared by all sun positions falling in that sector. The days are
+ * processed on worker threads. Cells with missing slope or aspect contribute no radiation.
+ *
+ * @param dem The DEM [rows x cols] (north up), including the surrounding topography.
+ * @param slope The slope of the DEM [degrees].
+ * @param aspect The aspect of the DEM [degrees, from the north].
+ * @param pixelSize The pixel size [m].
+ * @param latitude The mean latitude of the catchment [degrees].
+ * @param elevation The mean elevation of the catchment [m].
+ * @param atmosTransmissivity The mean clear-sky atmospheric transmissivity.
+ * @param stepsPerHour The number of sun positions per hour.
+ * @param withCastShadows Option to account for the cast shadows.
+ * @param azimuthSectorsNb The number of azimuth sectors for the horizon cache.
+ * @param threadsNb The number of threads to use (0: use the hardware concurrency).
+ * @return The daily potential radiation [366 x cells], the cells being ordered row by row.
+ */
+axxd ComputeDailyPotentialRadiation(const axxd& dem, const axxd& slope, const axxd& aspect, double pixelSize,
+                                    double latitude, double elevation, double atmosTransmissivity = 0.75,
+                                    int stepsPerHour = 4, bool withCastShadows = true, int azimuthSectorsNb = 72,
+                                    int threadsNb = 0);
+
+#endif  // HYDROBRICKS_POTENTIAL_SOLAR_RADIATION_H
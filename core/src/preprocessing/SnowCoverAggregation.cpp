@@ -0,0 +1,194 @@
+#include "SnowCoverAggregation.h"
+
+#include <mutex>
+#include <unordered_map>
+
+#include "FileNetcdf.h"
+#include "Parallel.h"
+
+namespace {
+
+constexpr int noUnit = -1;
+constexpr int minTimeBlockSize = 8;
+
+struct PixelFilter {
+    double nodata;
+    double validMin;
+    double validMax;
+    double valueScale;
+    double minValidRatio;
+
+    bool IsValid(double value) const {
+        if (!std::isfinite(value)) {
+            return false;
+        }
+        if (!std::isnan(nodata) && value == nodata) {
+            return false;
+        }
+        if (!std::isnan(validMin) && value < validMin) {
+            return false;
+        }
+        if (!std::isnan(validMax) && value > validMax) {
+            return false;
+        }
+
+        return true;
+    }
+};
+
+/**
+ * Get the unit index of every cell (row by row), noUnit for the cells that are not aggregated.
+ */
+vector<int> GetCellUnits(const axxi& unitMap, const vecInt& unitIds) {
+    std::unordered_map<int, int> unitIndices;
+    for (int i = 0; i < static_cast<int>(unitIds.size()); ++i) {
+        unitIndices[unitIds[i]] = i;
+    }
+
+    auto cols = static_cast<int>(unitMap.cols());
+    vector<int> cellUnits(unitMap.size(), noUnit);
+    for (int r = 0; r < unitMap.rows(); ++r) {
+        for (int c = 0; c < cols; ++c) {
+            auto it = unitIndices.find(unitMap(r, c));
+            if (it != unitIndices.end()) {
+                cellUnits[r * cols + c] = it->second;
+            }
+        }
+    }
+
+    return cellUnits;
+}
+
+/**
+ * Aggregate the grids of a block of time steps (one grid every rowStride values, cells row by row).
+ */
+void AggregateBlock(const double* grids, Eigen::Index rowStride, int timeStepsNb, int cellsNb,
+                    const vector<int>& cellUnits, const axd& pixelsNb, const PixelFilter& filter,
+                    SnowCoverAggregates& aggregates, int outputStart) {
+    auto unitsNb = static_cast<int>(pixelsNb.size());
+    axd sums(unitsNb);
+    axd counts(unitsNb);
+
+    for (int t = 0; t < timeStepsNb; ++t) {
+        const double* grid = grids + t * rowStride;
+        sums.setZero();
+        counts.setZero();
+        for (int cell = 0; cell < cellsNb; ++cell) {
+            int unit = cellUnits[cell];
+            if (unit == noUnit || !filter.IsValid(grid[cell])) {
+                continue;
+            }
+            sums[unit] += grid[cell];
+            counts[unit] += 1;
+        }
+
+        int row = outputStart + t;
+        for (int u = 0; u < unitsNb; ++u) {
+            double validFraction = pixelsNb[u] > 0 ? counts[u] / pixelsNb[u] : 0;
+            aggregates.validFraction(row, u) = validFraction;
+            if (counts[u] > 0 && validFraction >= filter.minValidRatio) {
+                aggregates.coverFraction(row, u) = sums[u] / counts[u] * filter.valueScale;
+            }
+        }
+    }
+}
+
+SnowCoverAggregates InitAggregates(int timeStepsNb, int unitsNb) {
+    SnowCoverAggregates aggregates;
+    aggregates.coverFraction = axxd::Constant(timeStepsNb, unitsNb, NAN_D);
+    aggregates.validFraction = axxd::Zero(timeStepsNb, unitsNb);
+
+    return aggregates;
+}
+
+axd CountUnitPixels(const vector<int>& cellUnits, int unitsNb) {
+    axd pixelsNb = axd::Zero(unitsNb);
+    for (int unit : cellUnits) {
+        if (unit != noUnit) {
+            pixelsNb[unit] += 1;
+        }
+    }
+
+    return pixelsNb;
+}
+
+}  // namespace
+
+SnowCoverAggregates AggregateSnowCover(const Eigen::Ref<const axxdRowMajor>& grids, const axxi& unitMap,
+                                       const vecInt& unitIds, double nodata, double validMin, double validMax,
+                                       double valueScale, double minValidRatio, int threadsNb) {
+    auto cellsNb = static_cast<int>(unitMap.size());
+    if (grids.cols() != cellsNb) {
+        throw InputError(std::format("The snow cover grids ({} cells) do not match the hydro unit map ({} cells).",
+                                     grids.cols(), cellsNb));
+    }
+
+    auto timeStepsNb = static_cast<int>(grids.rows());
+    auto unitsNb = static_cast<int>(unitIds.size());
+    vector<int> cellUnits = GetCellUnits(unitMap, unitIds);
+    axd pixelsNb = CountUnitPixels(cellUnits, unitsNb);
+    PixelFilter filter{nodata, validMin, validMax, valueScale, minValidRatio};
+
+    SnowCoverAggregates aggregates = InitAggregates(timeStepsNb, unitsNb);
+    ParallelFor(
+        timeStepsNb,
+        [&](int start, int end) {
+            AggregateBlock(grids.row(start).data(), grids.outerStride(), end - start, cellsNb, cellUnits, pixelsNb,
+                           filter, aggregates, start);
+        },
+        threadsNb, minTimeBlockSize);
+
+    return aggregates;
+}
+
+SnowCoverAggregates AggregateSnowCoverFiles(const vecStr& paths, const string& varName, const axxi& unitMap,
+                                            const vecInt& unitIds, double nodata, double validMin, double validMax,
+                                            double valueScale, double minValidRatio, int threadsNb) {
+    auto cellsNb = static_cast<int>(unitMap.size());
+    auto filesNb = static_cast<int>(paths.size());
+
+    // Number of time steps of every file (headers only) to place their outputs.
+    vector<int> offsets(filesNb + 1, 0);
+    for (int i = 0; i < filesNb; ++i) {
+        FileNetcdf file;
+        if (!file.OpenReadOnly(paths[i])) {
+            throw InputError(std::format("The snow cover file {} could not be opened.", paths[i]));
+        }
+        size_t size = file.GetVarSize(varName);
+        if (cellsNb == 0 || size % cellsNb != 0) {
+            throw InputError(
+                std::format("The variable {} of {} ({} values) does not match the hydro unit map ({} cells).",
+                            varName, paths[i], size, cellsNb));
+        }
+        offsets[i + 1] = offsets[i] + static_cast<int>(size / cellsNb);
+    }
+
+    auto unitsNb = static_cast<int>(unitIds.size());
+    vector<int> cellUnits = GetCellUnits(unitMap, unitIds);
+    axd pixelsNb = CountUnitPixels(cellUnits, unitsNb);
+    PixelFilter filter{nodata, validMin, validMax, valueScale, minValidRatio};
+
+    SnowCoverAggregates aggregates = InitAggregates(offsets[filesNb], unitsNb);
+    std::mutex readMutex;
+    ParallelFor(
+        filesNb,
+        [&](int start, int end) {
+            for (int i = start; i < end; ++i) {
+                int timeStepsNb = offsets[i + 1] - offsets[i];
+                vecDouble grids;
+                {
+                    std::lock_guard<std::mutex> lock(readMutex);
+                    FileNetcdf file;
+                    if (!file.OpenReadOnly(paths[i])) {
+                        throw InputError(std::format("The snow cover file {} could not be opened.", paths[i]));
+                    }
+                    grids = file.GetVarDouble1D(varName, static_cast<size_t>(timeStepsNb) * cellsNb);
+                }
+                AggregateBlock(grids.data(), cellsNb, timeStepsNb, cellsNb, cellUnits, pixelsNb, filter,
+                               aggregates, offsets[i]);
+            }
+        },
+        threadsNb);
+
+    return aggregates;
+}
@@ -0,0 +1,66 @@
+#ifndef HYDROBRICKS_SNOW_COVER_AGGREGATION_H
+#define HYDROBRICKS_SNOW_COVER_AGGREGATION_H
+
+#include "Includes.h"
+
+/**
+ * Snow cover aggregated per hydro unit.
+ */
+struct SnowCoverAggregates {
+    axxd coverFraction;  // mean of the valid pixels, scaled [time x units] (NaN: no valid observation)
+    axxd validFraction;  // fraction of the unit pixels that are valid [time x units]
+};
+
+/**
+ * Aggregate a stack of snow cover grids to the hydro units.
+ *
+ * A pixel is valid when it is finite, differs from the nodata value and lies within the valid range
+ * (the quality codes of the products, such as clouds, are usually flagged this way). For every time
+ * step and unit, the cover fraction is the mean of the valid pixels times the value scale. It is set
+ * to NaN when the unit has no valid pixel or when its valid-pixel fraction is below the minimum
+ * ratio. The time steps are split into blocks processed on worker threads.
+ *
+ * @param grids The snow cover grids [time x cells], the cells of a grid being ordered row by row.
+ * @param unitMap The hydro unit ID of every cell (same grid as the snow cover). The cells with an ID
+ * that is not in the list of hydro units are ignored.
+ * @param unitIds The IDs of the hydro units to aggregate to (columns of the outputs).
+ * @param nodata The value flagged as missing (NaN: none).
+ * @param validMin The minimum valid raw value (NaN: no lower bound).
+ * @param validMax The maximum valid raw value (NaN: no upper bound).
+ * @param valueScale The factor converting the raw values to a fraction.
+ * @param minValidRatio The minimum valid-pixel fraction for the cover fraction to be kept.
+ * @param threadsNb The number of threads to use (0: use the hardware concurrency).
+ * @return The cover fraction and valid-pixel fraction per time step and unit.
+ */
+SnowCoverAggregates AggregateSnowCover(const Eigen::Ref<const axxdRowMajor>& grids, const axxi& unitMap,
+                                       const vecInt& unitIds, double nodata = NAN_D, double validMin = NAN_D,
+                                       double validMax = NAN_D, double valueScale = 1, double minValidRatio = 0,
+                                       int threadsNb = 0);
+
+/**
+ * Read snow cover grids from netCDF/HDF5 files and aggregate them to the hydro units.
+ *
+ * Every file holds a variable on the grid of the unit map, either a single grid or a stack of grids
+ * (time as the first dimension). The time steps are concatenated in the order of the files. The
+ * files are read one at a time (the netCDF library is not thread-safe) while the aggregation of the
+ * previously read files runs on the other threads. See AggregateSnowCover for the filtering.
+ *
+ * @param paths The paths of the files, in chronological order.
+ * @param varName The name of the snow cover variable.
+ * @param unitMap The hydro unit ID of every cell.
+ * @param unitIds The IDs of the hydro units to aggregate to (columns of the outputs).
+ * @param nodata The value flagged as missing (NaN: none).
+ * @param validMin The minimum valid raw value (NaN: no lower bound).
+ * @param validMax The maximum valid raw value (NaN: no upper bound).
+ * @param valueScale The factor converting the raw values to a fraction.
+ * @param minValidRatio The minimum valid-pixel fraction for the cover fraction to be kept.
+ * @param threadsNb The number of threads to use (0: use the hardware concurrency).
+ * @return The cover fraction and valid-pixel fraction per time step and unit.
+ * @throws InputError if a file cannot be found or does not match the unit map.
+ */
+SnowCoverAggregates AggregateSnowCoverFiles(const vecStr& paths, const string& varName, const axxi& unitMap,
+                                            const vecInt& unitIds, double nodata = NAN_D, double validMin = NAN_D,
+                                            double validMax = NAN_D, double valueScale = 1, double minValidRatio = 0,
+                                            int threadsNb = 0);
+
+#endif  // HYDROBRICKS_SNOW_COVER_AGGREGATION_H
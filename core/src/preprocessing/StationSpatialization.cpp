@@ -0,0 +1,111 @@
+#include "StationSpatialization.h"
+
+#include "Parallel.h"
+
+namespace {
+
+constexpr int minTimeBlockSize = 256;
+
+double GetMonthlyValue(const axd& values, int monthIndex) {
+    return values.size() == 1 ? values[0] : values[monthIndex];
+}
+
+void CheckGradients(const axd& gradients, const string& name) {
+    if (gradients.size() != 1 && gradients.size() != 12) {
+        throw InputError(
+            std::format("The {} should have a length of 1 or 12. Here: {}", name, static_cast<int>(gradients.size())));
+    }
+}
+
+}  // namespace
+
+SpatializationMethod GetSpatializationMethodFromName(const string& name) {
+    if (name == "constant") {
+        return SpatializationMethod::Constant;
+    }
+    if (name == "additive_elevation_gradient") {
+        return SpatializationMethod::AdditiveElevationGradient;
+    }
+    if (name == "multiplicative_elevation_gradient") {
+        return SpatializationMethod::MultiplicativeElevationGradient;
+    }
+    if (name == "multiplicative_elevation_threshold_gradients") {
+        return SpatializationMethod::MultiplicativeElevationThresholdGradients;
+    }
+
+    throw InputError(std::format("Unknown spatialization method: {}", name));
+}
+
+axxd SpatializeStationData(const axd& data, const axi& months, const axd& elevations, const string& method,
+                           double refElevation, const axd& gradients, const axd& gradients2, double elevationThreshold,
+                           bool clipNegative, int threadsNb) {
+    SpatializationMethod spatializationMethod = GetSpatializationMethodFromName(method);
+
+    if (months.size() != data.size()) {
+        throw InputError(std::format("The months ({}) and the data ({}) have different lengths.",
+                                     static_cast<int>(months.size()), static_cast<int>(data.size())));
+    }
+    if (spatializationMethod != SpatializationMethod::Constant) {
+        CheckGradients(gradients, "gradient");
+    }
+    if (spatializationMethod == SpatializationMethod::MultiplicativeElevationThresholdGradients) {
+        CheckGradients(gradients2, "gradient_2");
+    }
+    if (months.size() > 0 && (months.minCoeff() < 1 || months.maxCoeff() > 12)) {
+        throw InputError("The months must be in the range 1-12.");
+    }
+
+    auto timeSize = static_cast<int>(data.size());
+    auto unitsNb = static_cast<int>(elevations.size());
+
+    // Precompute the affine transformation (value = data * factor + offset) per month and unit.
+    axxdRowMajor factors = axxdRowMajor::Ones(12, unitsNb);
+    axxdRowMajor offsets = axxdRowMajor::Zero(12, unitsNb);
+    axd deltaElevation = (elevations - refElevation) / 100;
+
+    for (int m = 0; m < 12; ++m) {
+        switch (spatializationMethod) {
+            case SpatializationMethod::Constant:
+                break;
+            case SpatializationMethod::AdditiveElevationGradient:
+                offsets.row(m) = GetMonthlyValue(gradients, m) * deltaElevation.transpose();
+                break;
+            case SpatializationMethod::MultiplicativeElevationGradient:
+                factors.row(m) = 1 + GetMonthlyValue(gradients, m) * deltaElevation.transpose();
+                break;
+            case SpatializationMethod::MultiplicativeElevationThresholdGradients: {
+                double gradient1 = GetMonthlyValue(gradients, m);
+                double gradient2 = GetMonthlyValue(gradients2, m);
+                for (int u = 0; u < unitsNb; ++u) {
+                    double elevation = elevations[u];
+                    if (elevation < elevationThreshold) {
+                        factors(m, u) = 1 + gradient1 * (elevation - refElevation) / 100;
+                    } else if (refElevation > elevationThreshold) {
+                        factors(m, u) = 1 + gradient2 * (elevation - refElevation) / 100;
+                    } else {
+                        factors(m, u) = (1 + gradient1 * (elevationThreshold - refElevation) / 100) *
+                                        (1 + gradient2 * (elevation - elevationThreshold) / 100);
+                    }
+                }
+                break;
+            }
+        }
+    }
+
+    // Apply the transformation on blocks of time steps, all units at once.
+    axxdRowMajor values(timeSize, unitsNb);
+    ParallelFor(
+        timeSize,
+        [&](int start, int end) {
+            for (int t = start; t < end; ++t) {
+                int m = months[t] - 1;
+                values.row(t) = data[t] * factors.row(m) + offsets.row(m);
+                if (clipNegative) {
+                    values.row(t) = (values.row(t) < 0).select(0.0, values.row(t));
+                }
+            }
+        },
+        threadsNb, minTimeBlockSize);
+
+    return values;
+}
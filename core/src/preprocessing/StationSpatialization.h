@@ -0,0 +1,47 @@
+#ifndef HYDROBRICKS_STATION_SPATIALIZATION_H
+#define HYDROBRICKS_STATION_SPATIALIZATION_H
+
+#include "Includes.h"
+
+enum class SpatializationMethod {
+    Constant,
+    AdditiveElevationGradient,
+    MultiplicativeElevationGradient,
+    MultiplicativeElevationThresholdGradients
+};
+
+/**
+ * Get the spatialization method from its name (as used in the Python forcing operations).
+ *
+ * @param name The method name (e.g. 'additive_elevation_gradient').
+ * @return The corresponding spatialization method.
+ * @throws InputError if the method is unknown.
+ */
+SpatializationMethod GetSpatializationMethodFromName(const string& name);
+
+/**
+ * Spatialize a station time series to the hydro units using elevation gradients.
+ *
+ * The gradients are given per 100 m of elevation difference, either as a single value or as 12
+ * monthly values. Every method reduces to a per-month and per-unit affine transformation
+ * (value = data * factor + offset), which is precomputed once and then applied to all time steps.
+ * The time steps are split into blocks processed on worker threads and each time step is computed
+ * across all units at once.
+ *
+ * @param data The station time series.
+ * @param months The month (1-12) of each time step.
+ * @param elevations The elevation of each hydro unit [m].
+ * @param method The spatialization method name.
+ * @param refElevation The station (reference) elevation [m].
+ * @param gradients The elevation gradient(s) (1 or 12 values, per 100 m).
+ * @param gradients2 The second elevation gradient(s) used above the threshold (1 or 12 values, per 100 m).
+ * @param elevationThreshold The elevation threshold [m] for the threshold method.
+ * @param clipNegative Option to set negative outputs to 0.
+ * @param threadsNb The number of threads to use (0: use the hardware concurrency).
+ * @return The spatialized values [time x units].
+ */
+axxd SpatializeStationData(const axd& data, const axi& months, const axd& elevations, const string& method,
+                           double refElevation = 0, const axd& gradients = axd(), const axd& gradients2 = axd(),
+                           double elevationThreshold = 0, bool clipNegative = false, int threadsNb = 0);
+
+#endif  // HYDROBRICKS_STATION_SPATIALIZATION_H
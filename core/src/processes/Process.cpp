@@ -425,7 +425,9 @@ std::unique_ptr<Process> Process::Factory(const ProcessSettings& processSettings
     const auto& registry = GetProcessRegistry();
     auto it = registry.find(ResolveAlias(processSettings.type));
     if (it != registry.end()) {
-        return it->second.create(brick);
+        std::unique_ptr<Process> process = it->second.create(brick);
+        process->_type = it->first;
+        return process;
     }
     throw ModelConfigError(
         std::format("Process type '{}' not recognized (Factory). {}", processSettings.type, GetValidProcessTypes()));
@@ -6,6 +6,8 @@
 #include "Flux.h"
 #include "Forcing.h"
 #include "Includes.h"
+#include "ModelArena.h"
+#include "ProcessKernel.h"
 #include "SettingsModel.h"
 
 class Brick;
@@ -13,7 +15,7 @@ class HydroUnit;
 class TimeMachine;
 class WaterContainer;
 
-class Process {
+class Process : public ArenaAllocated {
   public:
     explicit Process(WaterContainer* container);
 
@@ -224,6 +226,15 @@ class Process {
         _name = name;
     }
 
+    /**
+     * Get the type of the process (e.g. "outflow:linear"), as created by the factory.
+     *
+     * @return type of the process (empty if not created by the factory).
+     */
+    [[nodiscard]] std::string_view GetType() const noexcept {
+        return _type;
+    }
+
     /**
      * Set the time machine (non-owning reference).
      * Required by processes that depend on the current simulation date.
@@ -302,6 +313,17 @@ class Process {
         throw ShouldNotHappen("Process::GetLinearResponseRate - Should not be called (virtual)");
     }
 
+    /**
+     * Create a kernel evaluating the change rates of a group of processes of this type in one
+     * array operation (see ProcessKernel).
+     *
+     * @return The kernel, or nullptr if the process type has none (its rates are then evaluated
+     * process by process).
+     */
+    [[nodiscard]] virtual std::unique_ptr<ProcessKernel> CreateKernel() const {
+        return nullptr;
+    }
+
     /**
      * Check if the process has any output fluxes.
      *
@@ -322,6 +344,7 @@ class Process {
 
   protected:
     string _name;
+    std::string_view _type;                       // key of the static process registry
     WaterContainer* _container;                   // non-owning reference
     TimeMachine* _timeMachine{nullptr};           // non-owning reference
     std::vector<std::unique_ptr<Flux>> _outputs;  // owning
@@ -62,3 +62,41 @@ const vecDouble& ProcessETHBV::GetRates() {
 
     return StoreRates({pet * ratio});
 }
+
+class ProcessETHBV::Kernel : public ProcessKernel {
+  public:
+    void Add(Process* process, int rateIndex) override {
+        ProcessKernel::Add(process, rateIndex);
+        auto etProcess = static_cast<ProcessETHBV*>(process);
+        assert(etProcess->_container->HasMaximumCapacity());
+        _pets.push_back(etProcess->_pet);
+        _lps.push_back(etProcess->_lp);
+        _etCorrectionFactors.push_back(etProcess->_etCorrectionFactor);
+    }
+
+  protected:
+    vector<const Forcing*> _pets;               // non-owning references
+    vector<const float*> _lps;                  // non-owning references
+    vector<const float*> _etCorrectionFactors;  // non-owning references
+    axd _petValues;
+    axd _thresholds;
+    axd _factors;
+
+    void ComputeRates() override {
+        _petValues.resize(GetSize());
+        _thresholds.resize(GetSize());
+        for (int i = 0; i < GetSize(); ++i) {
+            _petValues[i] = _pets[i]->GetValue();
+            _thresholds[i] = _containers[i]->GetMaximumCapacity();
+        }
+        Gather(_lps, _factors);
+        _thresholds *= _factors;
+        Gather(_etCorrectionFactors, _factors);
+        _petValues *= _factors;
+        _rates = (_thresholds > 0).select(_petValues * (_contents / _thresholds).min(1.0), _petValues);
+    }
+};
+
+std::unique_ptr<ProcessKernel> ProcessETHBV::CreateKernel() const {
+    return std::make_unique<Kernel>();
+}
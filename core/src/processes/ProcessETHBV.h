@@ -44,6 +44,11 @@ class ProcessETHBV : public ProcessET {
      */
     void AttachForcing(Forcing* forcing) override;
 
+    /**
+     * @copydoc Process::CreateKernel()
+     */
+    [[nodiscard]] std::unique_ptr<ProcessKernel> CreateKernel() const override;
+
   protected:
     Forcing* _pet;                     // non-owning reference
     const float* _lp;                  // soil moisture fraction above which ET reaches the potential rate [-]
@@ -53,6 +58,9 @@ class ProcessETHBV : public ProcessET {
      * @copydoc Process::GetRates()
      */
     const vecDouble& GetRates() override;
+
+  private:
+    class Kernel;
 };
 
 #endif  // HYDROBRICKS_PROCESS_ET_HBV_H
@@ -36,3 +36,36 @@ const vecDouble& ProcessETSocont::GetRates() {
     assert(_container->HasMaximumCapacity());
     return StoreRates({_pet->GetValue() * pow(_container->GetTargetFillingRatio(), _exponent)});
 }
+
+class ProcessETSocont::Kernel : public ProcessKernel {
+  public:
+    void Add(Process* process, int rateIndex) override {
+        ProcessKernel::Add(process, rateIndex);
+        auto etProcess = static_cast<ProcessETSocont*>(process);
+        assert(etProcess->_container->HasMaximumCapacity());
+        _pets.push_back(etProcess->_pet);
+        _exponents.push_back(&etProcess->_exponent);
+    }
+
+  protected:
+    vector<const Forcing*> _pets;     // non-owning references
+    vector<const float*> _exponents;  // non-owning references
+    axd _petValues;
+    axd _capacities;
+    axd _exponentValues;
+
+    void ComputeRates() override {
+        _petValues.resize(GetSize());
+        _capacities.resize(GetSize());
+        for (int i = 0; i < GetSize(); ++i) {
+            _petValues[i] = _pets[i]->GetValue();
+            _capacities[i] = _containers[i]->GetMaximumCapacity();
+        }
+        Gather(_exponents, _exponentValues);
+        _rates = _petValues * (_contents / _capacities).min(1.0).max(0.0).pow(_exponentValues);
+    }
+};
+
+std::unique_ptr<ProcessKernel> ProcessETSocont::CreateKernel() const {
+    return std::make_unique<Kernel>();
+}
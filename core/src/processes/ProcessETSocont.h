@@ -37,6 +37,11 @@ class ProcessETSocont : public ProcessET {
      */
     void AttachForcing(Forcing* forcing) override;
 
+    /**
+     * @copydoc Process::CreateKernel()
+     */
+    [[nodiscard]] std::unique_ptr<ProcessKernel> CreateKernel() const override;
+
   protected:
     Forcing* _pet;  // non-owning reference
     float _exponent;
@@ -45,6 +50,9 @@ class ProcessETSocont : public ProcessET {
      * @copydoc Process::GetRates()
      */
     const vecDouble& GetRates() override;
+
+  private:
+    class Kernel;
 };
 
 #endif  // HYDROBRICKS_PROCESS_ET_SOCONT_H
@@ -0,0 +1,26 @@
+#include "ProcessKernel.h"
+
+#include "Process.h"
+#include "WaterContainer.h"
+
+void ProcessKernel::Add(Process* process, int rateIndex) {
+    assert(process);
+    assert(process->GetConnectionCount() == 1);
+    _rateIndices.push_back(rateIndex);
+    _containers.push_back(process->GetWaterContainer());
+}
+
+void ProcessKernel::EvaluateRates(axd& rates) {
+    _contents.resize(GetSize());
+    for (int i = 0; i < GetSize(); ++i) {
+        _contents[i] = _containers[i]->GetContentWithChanges();
+    }
+
+    ComputeRates();
+    assert(_rates.size() == GetSize());
+
+    for (int i = 0; i < GetSize(); ++i) {
+        assert(rates.size() > _rateIndices[i]);
+        rates(_rateIndices[i]) = _contents[i] <= PRECISION ? 0.0 : _rates[i];
+    }
+}
@@ -0,0 +1,73 @@
+#ifndef HYDROBRICKS_PROCESS_KERNEL_H
+#define HYDROBRICKS_PROCESS_KERNEL_H
+
+#include "Includes.h"
+
+class Process;
+class WaterContainer;
+
+/**
+ * Evaluation of the change rates of a group of processes of the same type (and structure
+ * variant) in one array operation. The processes keep their own states and parameters; the
+ * kernel gathers them, computes the rates of the whole group and scatters them into the rates
+ * vector of the solver. Only processes with a single connection can be grouped.
+ */
+class ProcessKernel {
+  public:
+    ProcessKernel() = default;
+
+    virtual ~ProcessKernel() = default;
+
+    /**
+     * Add a process to the group.
+     *
+     * @param process The process to add (of the type the kernel was created for).
+     * @param rateIndex The index of the process rate in the rates vector of the solver.
+     */
+    virtual void Add(Process* process, int rateIndex);
+
+    /**
+     * Get the number of processes in the group.
+     *
+     * @return The number of processes.
+     */
+    [[nodiscard]] int GetSize() const {
+        return static_cast<int>(_rateIndices.size());
+    }
+
+    /**
+     * Compute the change rates (per day) of all processes of the group at the current state
+     * and store them in the rates vector. As with Process::GetChangeRates, the rates of empty
+     * containers are set to zero.
+     *
+     * @param rates The rates vector of the solver.
+     */
+    void EvaluateRates(axd& rates);
+
+  protected:
+    vecInt _rateIndices;
+    vector<WaterContainer*> _containers;  // non-owning references
+    axd _contents;                        // content (with changes) of the containers [mm]
+    axd _rates;                           // rates of the group [mm/d]
+
+    /**
+     * Compute the rates of the group from the gathered contents into _rates.
+     */
+    virtual void ComputeRates() = 0;
+
+    /**
+     * Gather the values pointed to into an array.
+     *
+     * @param pointers The pointers to the values.
+     * @param values The array to fill.
+     */
+    template <typename T>
+    static void Gather(const vector<T*>& pointers, axd& values) {
+        values.resize(static_cast<Eigen::Index>(pointers.size()));
+        for (size_t i = 0; i < pointers.size(); ++i) {
+            values[static_cast<Eigen::Index>(i)] = static_cast<double>(*pointers[i]);
+        }
+    }
+};
+
+#endif  // HYDROBRICKS_PROCESS_KERNEL_H
@@ -19,3 +19,24 @@ void ProcessOutflowLinear::SetParameters(const ProcessSettings& processSettings)
 const vecDouble& ProcessOutflowLinear::GetRates() {
     return StoreRates({(*_responseFactor) * _container->GetContentWithChanges()});
 }
+
+class ProcessOutflowLinear::Kernel : public ProcessKernel {
+  public:
+    void Add(Process* process, int rateIndex) override {
+        ProcessKernel::Add(process, rateIndex);
+        _responseFactors.push_back(static_cast<ProcessOutflowLinear*>(process)->_responseFactor);
+    }
+
+  protected:
+    vector<const float*> _responseFactors;  // non-owning references
+    axd _factors;
+
+    void ComputeRates() override {
+        Gather(_responseFactors, _factors);
+        _rates = _factors * _contents;
+    }
+};
+
+std::unique_ptr<ProcessKernel> ProcessOutflowLinear::CreateKernel() const {
+    return std::make_unique<Kernel>();
+}
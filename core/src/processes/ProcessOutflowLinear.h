@@ -45,6 +45,11 @@ class ProcessOutflowLinear : public ProcessOutflow {
         return *_responseFactor;
     }
 
+    /**
+     * @copydoc Process::CreateKernel()
+     */
+    [[nodiscard]] std::unique_ptr<ProcessKernel> CreateKernel() const override;
+
   protected:
     const float* _responseFactor;  // [1/d]
 
@@ -52,6 +57,9 @@ class ProcessOutflowLinear : public ProcessOutflow {
      * @copydoc Process::GetRates()
      */
     const vecDouble& GetRates() override;
+
+  private:
+    class Kernel;
 };
 
 #endif  // HYDROBRICKS_PROCESS_OUTFLOW_LINEAR_H
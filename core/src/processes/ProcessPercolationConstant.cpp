@@ -23,3 +23,22 @@ void ProcessPercolationConstant::SetParameters(const ProcessSettings& processSet
 const vecDouble& ProcessPercolationConstant::GetRates() {
     return StoreRates({*_rate});
 }
+
+class ProcessPercolationConstant::Kernel : public ProcessKernel {
+  public:
+    void Add(Process* process, int rateIndex) override {
+        ProcessKernel::Add(process, rateIndex);
+        _percolationRates.push_back(static_cast<ProcessPercolationConstant*>(process)->_rate);
+    }
+
+  protected:
+    vector<const float*> _percolationRates;  // non-owning references
+
+    void ComputeRates() override {
+        Gather(_percolationRates, _rates);
+    }
+};
+
+std::unique_ptr<ProcessKernel> ProcessPercolationConstant::CreateKernel() const {
+    return std::make_unique<Kernel>();
+}
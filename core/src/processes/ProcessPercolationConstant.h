@@ -31,6 +31,11 @@ class ProcessPercolationConstant : public ProcessOutflow {
      */
     void SetParameters(const ProcessSettings& processSettings) override;
 
+    /**
+     * @copydoc Process::CreateKernel()
+     */
+    [[nodiscard]] std::unique_ptr<ProcessKernel> CreateKernel() const override;
+
   protected:
     const float* _rate;  // [mm/d]
 
@@ -38,6 +43,9 @@ class ProcessPercolationConstant : public ProcessOutflow {
      * @copydoc Process::GetRates()
      */
     const vecDouble& GetRates() override;
+
+  private:
+    class Kernel;
 };
 
 #endif  // HYDROBRICKS_PROCESS_PERCOLATION_CONSTANT_H
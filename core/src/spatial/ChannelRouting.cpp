@@ -0,0 +1,141 @@
+#include "ChannelRouting.h"
+
+namespace {
+
+void CheckNonNegative(const string& name, double value) {
+    if (value < 0 || std::isnan(value)) {
+        throw ModelConfigError(std::format("The routing parameter '{}' must be positive ({} given).", name, value));
+    }
+}
+
+}  // namespace
+
+std::unique_ptr<ChannelRouting> ChannelRouting::Factory(const string& type) {
+    if (StringsMatch(type, "lag_and_route")) {
+        return std::make_unique<RoutingLagAndRoute>();
+    }
+    if (StringsMatch(type, "linear_reservoir_cascade")) {
+        return std::make_unique<RoutingLinearReservoirCascade>();
+    }
+    if (StringsMatch(type, "muskingum_cunge")) {
+        return std::make_unique<RoutingMuskingumCunge>();
+    }
+
+    throw ModelConfigError(std::format("Unknown channel routing: {}", type));
+}
+
+void ChannelRouting::RouteLinearReservoir(axd& series, double storageConstant, double timeStepInDays) {
+    if (storageConstant <= 0) {
+        return;
+    }
+
+    double decay = std::exp(-timeStepInDays / storageConstant);
+    double storage = 0;
+    for (double& value : series) {
+        double newStorage = storage * decay + value / timeStepInDays * storageConstant * (1 - decay);
+        value += storage - newStorage;
+        storage = newStorage;
+    }
+}
+
+void RoutingLagAndRoute::SetParameter(const string& name, double value) {
+    CheckNonNegative(name, value);
+    if (name == "lag") {
+        _lag = value;
+    } else if (name == "storage_constant") {
+        _storageConstant = value;
+    } else {
+        throw ModelConfigError(std::format("Unknown parameter '{}' for the lag-and-route routing.", name));
+    }
+}
+
+axd RoutingLagAndRoute::Route(const axd& inflow, double timeStepInDays) const {
+    double lagSteps = _lag / timeStepInDays;
+    auto shift = static_cast<int>(std::floor(lagSteps));
+    double fraction = lagSteps - shift;
+
+    // Ring buffer of the last inflows (shift + 2 values needed for the interpolation).
+    int bufferSize = shift + 2;
+    vecDouble buffer(bufferSize, 0.0);
+    axd outflow(inflow.size());
+    for (int t = 0; t < inflow.size(); ++t) {
+        buffer[t % bufferSize] = inflow[t];
+        double lagged = buffer[(t - shift + bufferSize) % bufferSize];
+        double laggedMore = t - shift - 1 >= 0 ? buffer[(t - shift - 1 + bufferSize) % bufferSize] : 0;
+        outflow[t] = t - shift >= 0 ? (1 - fraction) * lagged + fraction * laggedMore : 0;
+    }
+
+    RouteLinearReservoir(outflow, _storageConstant, timeStepInDays);
+
+    return outflow;
+}
+
+void RoutingLinearReservoirCascade::SetParameter(const string& name, double value) {
+    CheckNonNegative(name, value);
+    if (name == "reservoirs_nb") {
+        if (value < 1 || value != std::floor(value)) {
+            throw ModelConfigError(std::format("The number of reservoirs must be a positive integer ({}).", value));
+        }
+        _reservoirsNb = static_cast<int>(value);
+    } else if (name == "storage_constant") {
+        _storageConstant = value;
+    } else {
+        throw ModelConfigError(std::format("Unknown parameter '{}' for the linear reservoir cascade.", name));
+    }
+}
+
+axd RoutingLinearReservoirCascade::Route(const axd& inflow, double timeStepInDays) const {
+    axd outflow = inflow;
+    for (int i = 0; i < _reservoirsNb; ++i) {
+        RouteLinearReservoir(outflow, _storageConstant, timeStepInDays);
+    }
+
+    return outflow;
+}
+
+void RoutingMuskingumCunge::SetParameter(const string& name, double value) {
+    CheckNonNegative(name, value);
+    if (name == "length") {
+        _length = value;
+    } else if (name == "celerity") {
+        if (value == 0) {
+            throw ModelConfigError("The celerity of the Muskingum-Cunge routing must be strictly positive.");
+        }
+        _celerity = value;
+    } else if (name == "diffusivity") {
+        _diffusivity = value;
+    } else {
+        throw ModelConfigError(std::format("Unknown parameter '{}' for the Muskingum-Cunge routing.", name));
+    }
+}
+
+axd RoutingMuskingumCunge::Route(const axd& inflow, double timeStepInDays) const {
+    if (_length == 0) {
+        return inflow;
+    }
+
+    // Sub-reaches with a travel time not exceeding the time step.
+    double travelTime = _length / _celerity / constants::dayInSec;
+    int subReachesNb = std::max(1, static_cast<int>(std::ceil(travelTime / timeStepInDays)));
+    double k = travelTime / subReachesNb;
+    double x = std::clamp(0.5 - _diffusivity / (_celerity * _length / subReachesNb), 0.0, 0.5);
+
+    double denominator = 2 * k * (1 - x) + timeStepInDays;
+    double c0 = (timeStepInDays - 2 * k * x) / denominator;
+    double c1 = (timeStepInDays + 2 * k * x) / denominator;
+    double c2 = (2 * k * (1 - x) - timeStepInDays) / denominator;
+
+    axd outflow = inflow;
+    for (int r = 0; r < subReachesNb; ++r) {
+        double previousIn = 0;
+        double previousOut = 0;
+        for (double& value : outflow) {
+            double out = c0 * value + c1 * previousIn + c2 * previousOut;
+            previousIn = value;
+            previousOut = out;
+            value = out;
+        }
+    }
+
+    return outflow;
+}
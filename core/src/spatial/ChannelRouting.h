@@ -0,0 +1,117 @@
+#ifndef HYDROBRICKS_CHANNEL_ROUTING_H
+#define HYDROBRICKS_CHANNEL_ROUTING_H
+
+#include <memory>
+
+#include "Includes.h"
+
+/**
+ * Routing of the discharge along the channel reach of a connector between two sub-basins.
+ *
+ * The routing kernels are linear: they transform a discharge series (amounts per time step, in any
+ * unit) into the series leaving the reach. The reach starts empty at the beginning of the series.
+ */
+class ChannelRouting {
+  public:
+    ChannelRouting() = default;
+
+    virtual ~ChannelRouting() = default;
+
+    /**
+     * Create a routing kernel from its name.
+     *
+     * @param type The routing name: 'lag_and_route', 'linear_reservoir_cascade' or 'muskingum_cunge'.
+     * @return The routing kernel.
+     * @throws ModelConfigError if the routing is unknown.
+     */
+    static std::unique_ptr<ChannelRouting> Factory(const string& type);
+
+    /**
+     * Set a parameter of the reach.
+     *
+     * @param name The parameter name.
+     * @param value The parameter value.
+     * @throws ModelConfigError if the parameter does not exist or its value is invalid.
+     */
+    virtual void SetParameter(const string& name, double value) = 0;
+
+    /**
+     * Route a discharge series through the reach.
+     *
+     * @param inflow The discharge entering the reach (amount per time step).
+     * @param timeStepInDays The time step [d].
+     * @return The discharge leaving the reach (amount per time step).
+     */
+    [[nodiscard]] virtual axd Route(const axd& inflow, double timeStepInDays) const = 0;
+
+  protected:
+    /**
+     * Route a series through a linear reservoir (exact solution for a constant inflow within a time
+     * step), in place.
+     *
+     * @param series The series to route.
+     * @param storageConstant The storage constant of the reservoir [d].
+     * @param timeStepInDays The time step [d].
+     */
+    static void RouteLinearReservoir(axd& series, double storageConstant, double timeStepInDays);
+};
+
+/**
+ * Lag-and-route: pure translation of the discharge by a lag time (linearly interpolated between
+ * time steps), followed by a linear reservoir attenuation.
+ *
+ * Parameters: 'lag' [d] and 'storage_constant' [d] (0: no attenuation).
+ */
+class RoutingLagAndRoute : public ChannelRouting {
+  public:
+    RoutingLagAndRoute() = default;
+
+    void SetParameter(const string& name, double value) override;
+
+    [[nodiscard]] axd Route(const axd& inflow, double timeStepInDays) const override;
+
+  protected:
+    double _lag = 0;              // [d]
+    double _storageConstant = 0;  // [d]
+};
+
+/**
+ * Cascade of identical linear reservoirs (Nash cascade).
+ *
+ * Parameters: 'reservoirs_nb' [-] and 'storage_constant' [d] (of each reservoir).
+ */
+class RoutingLinearReservoirCascade : public ChannelRouting {
+  public:
+    RoutingLinearReservoirCascade() = default;
+
+    void SetParameter(const string& name, double value) override;
+
+    [[nodiscard]] axd Route(const axd& inflow, double timeStepInDays) const override;
+
+  protected:
+    int _reservoirsNb = 1;
+    double _storageConstant = 1;  // [d]
+};
+
+/**
+ * Muskingum-Cunge routing with constant parameters. The Muskingum coefficients are derived from the
+ * reach length, the wave celerity and the hydraulic diffusivity. The reach is split into sub-reaches
+ * so that their travel time does not exceed the time step.
+ *
+ * Parameters: 'length' [m], 'celerity' [m/s] and 'diffusivity' [m2/s].
+ */
+class RoutingMuskingumCunge : public ChannelRouting {
+  public:
+    RoutingMuskingumCunge() = default;
+
+    void SetParameter(const string& name, double value) override;
+
+    [[nodiscard]] axd Route(const axd& inflow, double timeStepInDays) const override;
+
+  protected:
+    double _length = 0;       // [m]
+    double _celerity = 1;     // [m/s]
+    double _diffusivity = 0;  // [m2/s]
+};
+
+#endif  // HYDROBRICKS_CHANNEL_ROUTING_H
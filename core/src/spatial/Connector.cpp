@@ -14,3 +14,22 @@ void Connector::Connect(SubBasin* in, SubBasin* out) {
     _in->AddOutputConnector(this);
     _out->AddInputConnector(this);
 }
+
+void Connector::SetUpstreamDischarge(const axd& discharge) {
+    _upstreamDischarge = discharge;
+}
+
+axd Connector::GetInflow(double timeStepInDays) const {
+    assert(_in);
+    assert(_out);
+    if (_out->GetArea() <= 0) {
+        throw ModelConfigError("The downstream sub-basin of a connector has no area.");
+    }
+
+    axd inflow = _upstreamDischarge * _in->GetArea() / _out->GetArea();
+    if (_routing) {
+        return _routing->Route(inflow, timeStepInDays);
+    }
+
+    return inflow;
+}
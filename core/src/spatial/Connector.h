@@ -1,10 +1,18 @@
 #ifndef HYDROBRICKS_CONNECTOR_H
 #define HYDROBRICKS_CONNECTOR_H
 
+#include <memory>
+
+#include "ChannelRouting.h"
 #include "Includes.h"
 
 class SubBasin;
 
+/**
+ * Connection of a sub-basin outlet to a downstream sub-basin. The discharge of the upstream
+ * sub-basin is transferred to the downstream one, converted to its area, and optionally routed
+ * along the channel reach joining them.
+ */
 class Connector {
   public:
     Connector();
@@ -19,9 +27,62 @@ class Connector {
      */
     void Connect(SubBasin* in, SubBasin* out);
 
+    /**
+     * Set the outlet discharge of the upstream sub-basin.
+     *
+     * @param discharge The discharge time series [mm] (relative to the upstream sub-basin area).
+     */
+    void SetUpstreamDischarge(const axd& discharge);
+
+    /**
+     * Set the routing along the channel reach of the connector.
+     *
+     * @param routing The routing kernel (ownership transferred, nullptr: no routing).
+     */
+    void SetRouting(std::unique_ptr<ChannelRouting> routing) {
+        _routing = std::move(routing);
+    }
+
+    /**
+     * Get the routing along the channel reach of the connector.
+     *
+     * @return The routing kernel (nullptr: no routing).
+     */
+    [[nodiscard]] ChannelRouting* GetRouting() const {
+        return _routing.get();
+    }
+
+    /**
+     * Get the discharge entering the downstream sub-basin (after routing).
+     *
+     * @param timeStepInDays The time step of the series [d].
+     * @return The discharge time series [mm] (relative to the downstream sub-basin area).
+     */
+    [[nodiscard]] axd GetInflow(double timeStepInDays) const;
+
+    /**
+     * Get the upstream (input) sub-basin.
+     *
+     * @return The upstream sub-basin.
+     */
+    [[nodiscard]] SubBasin* GetUpstreamSubBasin() const {
+        return _in;
+    }
+
+    /**
+     * Get the downstream (output) sub-basin.
+     *
+     * @return The downstream sub-basin.
+     */
+    [[nodiscard]] SubBasin* GetDownstreamSubBasin() const {
+        return _out;
+    }
+
   protected:
-    SubBasin* _in;   // non-owning reference
-    SubBasin* _out;  // non-owning reference
+    SubBasin* _in;                             // non-owning reference
+    SubBasin* _out;                            // non-owning reference
+    axd _upstreamDischarge;                    // mm, relative to the upstream sub-basin area
+    std::unique_ptr<ChannelRouting> _routing;  // owning (nullptr: no routing)
 };
 
 #endif  // HYDROBRICKS_CONNECTOR_H
@@ -74,12 +74,21 @@ bool HasRole(const vector<ContentSlot>& slots, CoverRole role) {
 HydroUnit::HydroUnit(double area, Types type)
     : _type(type),
       _id(UNDEFINED),
-      _area(area) {}
+      _area(area),
+      _nameIndex(std::make_shared<HydroUnitNameIndex>()) {}
 
 HydroUnit::~HydroUnit() {
     // Unique_ptr members clean up owned objects automatically.
 }
 
+void HydroUnit::SetNameIndex(std::shared_ptr<HydroUnitNameIndex> nameIndex) {
+    assert(nameIndex);
+    if (!_bricks.empty() || !_splitters.empty()) {
+        throw ShouldNotHappen("The name index of a hydro unit must be set before adding its components.");
+    }
+    _nameIndex = std::move(nameIndex);
+}
+
 void HydroUnit::ReserveBricks(size_t count) {
     _bricks.reserve(_bricks.size() + count);
 }
@@ -133,6 +142,16 @@ void HydroUnit::AddProperty(std::unique_ptr<HydroUnitProperty> property) {
     _properties.push_back(std::move(property));
 }
 
+bool HydroUnit::HasProperty(std::string_view name) const {
+    for (const auto& property : _properties) {
+        if (property->GetName() == name) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 double HydroUnit::GetPropertyDouble(std::string_view name, std::string_view unit) const {
     for (const auto& property : _properties) {
         if (property->GetName() == name) {
@@ -160,11 +179,15 @@ string HydroUnit::GetPropertyString(std::string_view name) const {
 void HydroUnit::AddBrick(std::unique_ptr<Brick> brick) {
     assert(brick);
     Brick* rawBrick = brick.get();
-    _brickMap[rawBrick->GetName()] = rawBrick;
+    int index = static_cast<int>(_bricks.size());
+    if (index == _nameIndex->GetBrickCount()) {
+        _nameIndex->AddBrick(rawBrick->GetName(), rawBrick->IsLandCover());
+    } else if (_nameIndex->GetBrickName(index) != rawBrick->GetName()) {
+        throw ModelConfigError(std::format("The brick '{}' does not match the shared name index of the hydro unit.",
+                                           rawBrick->GetName()));
+    }
     if (rawBrick->IsLandCover()) {
-        auto* landCover = dynamic_cast<LandCover*>(rawBrick);
-        _landCoverBricks.push_back(landCover);
-        _landCoverMap[landCover->GetName()] = landCover;
+        _landCoverBricks.push_back(dynamic_cast<LandCover*>(rawBrick));
     }
     rawBrick->SetHydroUnit(this);
     _bricks.push_back(std::move(brick));
@@ -172,8 +195,13 @@ void HydroUnit::AddBrick(std::unique_ptr<Brick> brick) {
 
 void HydroUnit::AddSplitter(std::unique_ptr<Splitter> splitter) {
     assert(splitter);
-    Splitter* rawSplitter = splitter.get();
-    _splitterMap[rawSplitter->GetName()] = rawSplitter;
+    int index = static_cast<int>(_splitters.size());
+    if (index == _nameIndex->GetSplitterCount()) {
+        _nameIndex->AddSplitter(splitter->GetName());
+    } else if (_nameIndex->GetSplitterName(index) != splitter->GetName()) {
+        throw ModelConfigError(std::format("The splitter '{}' does not match the shared name index of the hydro unit.",
+                                           splitter->GetName()));
+    }
     _splitters.push_back(std::move(splitter));
 }
 
@@ -226,35 +254,53 @@ Brick* HydroUnit::GetBrick(size_t index) const {
 }
 
 bool HydroUnit::HasBrick(std::string_view name) const {
-    return _brickMap.find(string(name)) != _brickMap.end();
+    return TryGetBrick(name) != nullptr;
 }
 
 Brick* HydroUnit::GetBrick(std::string_view name) const {
-    auto it = _brickMap.find(string(name));
-    if (it != _brickMap.end()) {
-        return it->second;
+    Brick* brick = TryGetBrick(name);
+    if (brick != nullptr) {
+        return brick;
     }
 
     throw ModelConfigError(std::format("No brick with the name '{}' was found.", name));
 }
 
 Brick* HydroUnit::TryGetBrick(std::string_view name) const {
-    auto it = _brickMap.find(string(name));
-    return it != _brickMap.end() ? it->second : nullptr;
+    return TryGetBrick(Symbol::Find(name));
+}
+
+Brick* HydroUnit::GetBrick(Symbol symbol) const {
+    Brick* brick = TryGetBrick(symbol);
+    if (brick != nullptr) {
+        return brick;
+    }
+
+    throw ModelConfigError(std::format("No brick with the name '{}' was found.", symbol.GetName()));
+}
+
+Brick* HydroUnit::TryGetBrick(Symbol symbol) const {
+    // The shared name index can describe more components than this unit holds.
+    int index = _nameIndex->GetBrickIndex(symbol);
+    return index >= 0 && index < static_cast<int>(_bricks.size()) ? _bricks[index].get() : nullptr;
 }
 
 LandCover* HydroUnit::GetLandCover(std::string_view name) const {
-    auto it = _landCoverMap.find(string(name));
-    if (it != _landCoverMap.end()) {
-        return it->second;
+    LandCover* landCover = TryGetLandCover(name);
+    if (landCover != nullptr) {
+        return landCover;
     }
 
     throw ModelConfigError(std::format("No land cover with the name '{}' was found.", name));
 }
 
 LandCover* HydroUnit::TryGetLandCover(std::string_view name) const {
-    auto it = _landCoverMap.find(string(name));
-    return it != _landCoverMap.end() ? it->second : nullptr;
+    return TryGetLandCover(Symbol::Find(name));
+}
+
+LandCover* HydroUnit::TryGetLandCover(Symbol symbol) const {
+    int index = _nameIndex->GetLandCoverIndex(symbol);
+    return index >= 0 && index < static_cast<int>(_landCoverBricks.size()) ? _landCoverBricks[index] : nullptr;
 }
 
 Splitter* HydroUnit::GetSplitter(size_t index) const {
@@ -265,21 +311,34 @@ Splitter* HydroUnit::GetSplitter(size_t index) const {
 }
 
 bool HydroUnit::HasSplitter(std::string_view name) const {
-    return _splitterMap.find(string(name)) != _splitterMap.end();
+    return TryGetSplitter(name) != nullptr;
 }
 
 Splitter* HydroUnit::GetSplitter(std::string_view name) const {
-    auto it = _splitterMap.find(string(name));
-    if (it != _splitterMap.end()) {
-        return it->second;
+    Splitter* splitter = TryGetSplitter(name);
+    if (splitter != nullptr) {
+        return splitter;
     }
 
     throw ModelConfigError(std::format("No splitter with the name '{}' was found.", name));
 }
 
 Splitter* HydroUnit::TryGetSplitter(std::string_view name) const {
-    auto it = _splitterMap.find(string(name));
-    return it != _splitterMap.end() ? it->second : nullptr;
+    return TryGetSplitter(Symbol::Find(name));
+}
+
+Splitter* HydroUnit::GetSplitter(Symbol symbol) const {
+    Splitter* splitter = TryGetSplitter(symbol);
+    if (splitter != nullptr) {
+        return splitter;
+    }
+
+    throw ModelConfigError(std::format("No splitter with the name '{}' was found.", symbol.GetName()));
+}
+
+Splitter* HydroUnit::TryGetSplitter(Symbol symbol) const {
+    int index = _nameIndex->GetSplitterIndex(symbol);
+    return index >= 0 && index < static_cast<int>(_splitters.size()) ? _splitters[index].get() : nullptr;
 }
 
 bool HydroUnit::IsValid(bool checkProcesses) const {
@@ -330,54 +389,66 @@ void HydroUnit::Validate() const {
 }
 
 bool HydroUnit::ChangeLandCoverAreaFraction(std::string_view name, double fraction) {
-    if ((fraction < 0) || (fraction > 1)) {
-        LogError("The given fraction ({}) for '{}' is not in the allowed range [0 .. 1]", fraction, name);
-        return false;
-    }
-    auto it = _landCoverMap.find(string(name));
-    if (it == _landCoverMap.end()) {
+    LandCover* changed = TryGetLandCover(name);
+    if (changed == nullptr) {
         LogError("Land cover '{}' was not found.", name);
         return false;
     }
-    LandCover* changed = it->second;
 
-    // Conserve the stored water by transferring the content sitting on the land that
-    // changes hands between the changed cover and the generic (soil) cover that
-    // absorbs the area difference. Only relevant when there is a distinct generic
-    // cover to exchange with.
+    return ChangeLandCoverAreaFraction(changed, fraction);
+}
+
+bool HydroUnit::ChangeLandCoverAreaFraction(LandCover* changed, double fraction) {
+    return ChangeLandCoverAreaFractions(std::span(&changed, 1), std::span(&fraction, 1));
+}
+
+bool HydroUnit::ChangeLandCoverAreaFractions(std::span<LandCover* const> changed, std::span<const double> fractions) {
+    assert(changed.size() == fractions.size());
     LandCover* generic = GetGenericLandCover();
-    if (generic != nullptr && generic != changed && _landCoverBricks.size() > 1) {
-        double oldFraction = changed->GetAreaFraction();
-        double delta = fraction - oldFraction;
-        double genericOldFraction = generic->GetAreaFraction();
-        double genericNewFraction = genericOldFraction - delta;
-
-        // The generic cover must be able to absorb the change (it cannot go negative).
-        if (LessThan(genericNewFraction, 0, EPSILON_D)) {
-            LogError(
-                "The generic soil (open) land cover (%.20g) is not large enough to compensate "
-                "the area change (%.20g) with error margin (%.20g).",
-                genericOldFraction, delta, EPSILON_D);
+
+    for (size_t i = 0; i < changed.size(); ++i) {
+        assert(changed[i] != nullptr);
+        double fraction = fractions[i];
+        if ((fraction < 0) || (fraction > 1)) {
+            LogError("The given fraction ({}) for '{}' is not in the allowed range [0 .. 1]", fraction,
+                     changed[i]->GetName());
             return false;
         }
 
-        TransferLandCoverContent(changed, oldFraction, fraction, generic, genericOldFraction, genericNewFraction);
+        // Conserve the stored water by transferring the content sitting on the land that
+        // changes hands between the changed cover and the generic (soil) cover that
+        // absorbs the area difference. Only relevant when there is a distinct generic
+        // cover to exchange with.
+        if (generic != nullptr && generic != changed[i] && _landCoverBricks.size() > 1) {
+            double oldFraction = changed[i]->GetAreaFraction();
+            double delta = fraction - oldFraction;
+            double genericOldFraction = generic->GetAreaFraction();
+            double genericNewFraction = genericOldFraction - delta;
+
+            // The generic cover must be able to absorb the change (it cannot go negative).
+            if (LessThan(genericNewFraction, 0, EPSILON_D)) {
+                LogError(
+                    "The generic soil (open) land cover (%.20g) is not large enough to compensate "
+                    "the area change (%.20g) with error margin (%.20g).",
+                    genericOldFraction, delta, EPSILON_D);
+                return false;
+            }
+
+            TransferLandCoverContent(changed[i], oldFraction, fraction, generic, genericOldFraction,
+                                     genericNewFraction);
+            generic->SetAreaFraction(std::max(0.0, genericNewFraction));
+        }
+
+        changed[i]->SetAreaFraction(fraction);
     }
 
-    changed->SetAreaFraction(fraction);
+    // The total is fixed once for all the changes.
     return FixLandCoverFractionsTotal();
 }
 
 LandCover* HydroUnit::GetGenericLandCover() const {
-    // 'open' is the canonical name; 'ground'/'generic'/'generic_land_cover' are accepted
-    // aliases kept for backward compatibility.
-    for (const auto& name : {"open", "ground", "generic", "generic_land_cover"}) {
-        auto it = _landCoverMap.find(name);
-        if (it != _landCoverMap.end()) {
-            return it->second;
-        }
-    }
-    return nullptr;
+    int index = _nameIndex->GetGenericLandCoverIndex();
+    return index >= 0 && index < static_cast<int>(_landCoverBricks.size()) ? _landCoverBricks[index] : nullptr;
 }
 
 void HydroUnit::TransferLandCoverContent(LandCover* changed, double oldFraction, double newFraction, LandCover* generic,
@@ -9,6 +9,7 @@
 #include "Forcing.h"
 #include "HydroUnitLateralConnection.h"
 #include "HydroUnitProperty.h"
+#include "HydroUnitNameIndex.h"
 #include "Includes.h"
 #include "LandCover.h"
 #include "Splitter.h"
@@ -52,6 +53,14 @@ class HydroUnit {
      */
     void AddProperty(std::unique_ptr<HydroUnitProperty> property);
 
+    /**
+     * Check if the hydro unit has a property.
+     *
+     * @param name The name of the property.
+     * @return True if the property is defined, false otherwise.
+     */
+    [[nodiscard]] bool HasProperty(std::string_view name) const;
+
     /**
      * Get a numeric property of the hydro unit.
      *
@@ -195,6 +204,16 @@ class HydroUnit {
      */
     [[nodiscard]] bool HasBrick(std::string_view name) const;
 
+    /**
+     * Check if the hydro unit has a brick with a specific name from the symbol of the name.
+     *
+     * @param symbol The symbol of the name of the brick to check for.
+     * @return True if the hydro unit has the brick, false otherwise.
+     */
+    [[nodiscard]] bool HasBrick(Symbol symbol) const {
+        return TryGetBrick(symbol) != nullptr;
+    }
+
     /**
      * Get a brick by its name.
      *
@@ -211,6 +230,22 @@ class HydroUnit {
      */
     [[nodiscard]] Brick* TryGetBrick(std::string_view name) const;
 
+    /**
+     * Get a brick by the symbol of its name.
+     *
+     * @param symbol The symbol of the name of the brick to get.
+     * @return The brick with the specified name.
+     */
+    [[nodiscard]] Brick* GetBrick(Symbol symbol) const;
+
+    /**
+     * Try to get a brick by the symbol of its name without throwing.
+     *
+     * @param symbol The symbol of the name of the brick to get.
+     * @return The brick with the specified name, or nullptr if not found.
+     */
+    [[nodiscard]] Brick* TryGetBrick(Symbol symbol) const;
+
     /**
      * Get a vector of all snowpack bricks in the hydro unit.
      *
@@ -243,6 +278,14 @@ class HydroUnit {
      */
     [[nodiscard]] LandCover* TryGetLandCover(std::string_view name) const;
 
+    /**
+     * Try to get a land cover brick by the symbol of its name without throwing.
+     *
+     * @param symbol The symbol of the name of the land cover to get.
+     * @return The land cover with the specified name, or nullptr if not found.
+     */
+    [[nodiscard]] LandCover* TryGetLandCover(Symbol symbol) const;
+
     /**
      * Get a splitter by its index.
      *
@@ -259,6 +302,16 @@ class HydroUnit {
      */
     [[nodiscard]] bool HasSplitter(std::string_view name) const;
 
+    /**
+     * Check if the hydro unit has a splitter with a specific name from the symbol of the name.
+     *
+     * @param symbol The symbol of the name of the splitter to check for.
+     * @return True if the hydro unit has the splitter, false otherwise.
+     */
+    [[nodiscard]] bool HasSplitter(Symbol symbol) const {
+        return TryGetSplitter(symbol) != nullptr;
+    }
+
     /**
      * Get a splitter by its name.
      *
@@ -275,6 +328,22 @@ class HydroUnit {
      */
     [[nodiscard]] Splitter* TryGetSplitter(std::string_view name) const;
 
+    /**
+     * Get a splitter by the symbol of its name.
+     *
+     * @param symbol The symbol of the name of the splitter to get.
+     * @return The splitter with the specified name.
+     */
+    [[nodiscard]] Splitter* GetSplitter(Symbol symbol) const;
+
+    /**
+     * Try to get a splitter by the symbol of its name without throwing.
+     *
+     * @param symbol The symbol of the name of the splitter to get.
+     * @return The splitter with the specified name, or nullptr if not found.
+     */
+    [[nodiscard]] Splitter* TryGetSplitter(Symbol symbol) const;
+
     /**
      * Check if the hydro unit is properly configured.
      *
@@ -300,6 +369,27 @@ class HydroUnit {
      */
     bool ChangeLandCoverAreaFraction(std::string_view name, double fraction);
 
+    /**
+     * Change the area fraction of a land cover of the hydro unit, given by pointer.
+     * Ensure that the sum of all land cover fractions is equal to 1.
+     *
+     * @param changed The land cover to change (of this hydro unit).
+     * @param fraction The new area fraction of the land cover.
+     * @return True on success; false if the fraction is outside [0, 1].
+     */
+    bool ChangeLandCoverAreaFraction(LandCover* changed, double fraction);
+
+    /**
+     * Change the area fractions of several land covers of the hydro unit at once. The changes
+     * are applied in order, each exchanging area and content with the generic land cover, and
+     * the sum of the fractions is fixed once at the end.
+     *
+     * @param changed The land covers to change (of this hydro unit).
+     * @param fractions The new area fractions of the land covers.
+     * @return True on success; false if a fraction is outside [0, 1] or cannot be compensated.
+     */
+    bool ChangeLandCoverAreaFractions(std::span<LandCover* const> changed, std::span<const double> fractions);
+
     /**
      * Fix the land cover fractions to ensure that they sum to 1.
      *
@@ -377,6 +467,25 @@ class HydroUnit {
         return _structureId;
     }
 
+    /**
+     * Share the name index (names and lookups of the bricks, land covers and splitters) of
+     * another hydro unit built from the same structure variant. Must be called before any
+     * brick or splitter is added; the components must then be added in the same order.
+     *
+     * @param nameIndex The name index to share.
+     */
+    void SetNameIndex(std::shared_ptr<HydroUnitNameIndex> nameIndex);
+
+    /**
+     * Get the name index of the components of the hydro unit (possibly shared with other hydro
+     * units).
+     *
+     * @return The name index of the hydro unit.
+     */
+    [[nodiscard]] const std::shared_ptr<HydroUnitNameIndex>& GetNameIndex() const {
+        return _nameIndex;
+    }
+
     /**
      * Get the lateral connections of the hydro unit.
      *
@@ -409,14 +518,12 @@ class HydroUnit {
     double _area;                                                                  // [m²]
     std::vector<std::unique_ptr<HydroUnitProperty>> _properties;                   // owning
     std::vector<std::unique_ptr<HydroUnitLateralConnection>> _lateralConnections;  // owning
+    std::shared_ptr<HydroUnitNameIndex> _nameIndex;                                // shared per structure variant
     std::vector<std::unique_ptr<Brick>> _bricks;                                   // owning
-    std::unordered_map<string, Brick*> _brickMap;                                  // non-owning view into _bricks
     std::vector<LandCover*> _landCoverBricks;                                      // non-owning view into _bricks
-    std::unordered_map<string, LandCover*> _landCoverMap;    // non-owning view into _landCoverBricks
-    std::vector<std::unique_ptr<Splitter>> _splitters;       // owning
-    std::unordered_map<string, Splitter*> _splitterMap;      // non-owning view into _splitters
-    std::vector<std::unique_ptr<Forcing>> _forcing;          // owning
-    std::unordered_map<VariableType, Forcing*> _forcingMap;  // non-owning view into _forcing
+    std::vector<std::unique_ptr<Splitter>> _splitters;                             // owning
+    std::vector<std::unique_ptr<Forcing>> _forcing;                                // owning
+    std::unordered_map<VariableType, Forcing*> _forcingMap;                        // non-owning view into _forcing
 };
 
 #endif
@@ -0,0 +1,86 @@
+#include "HydroUnitNameIndex.h"
+
+#include <array>
+
+namespace {
+
+// 'open' is the canonical name of the generic land cover; the others are aliases kept for
+// backward compatibility, in decreasing order of preference.
+int GetGenericLandCoverPriority(const string& name) {
+    const std::array<const char*, 4> names = {"open", "ground", "generic", "generic_land_cover"};
+    for (int i = 0; i < static_cast<int>(names.size()); ++i) {
+        if (name == names[i]) {
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
+
+void SetIndex(vecInt& indices, Symbol symbol, int index) {
+    if (static_cast<int>(indices.size()) <= symbol.GetId()) {
+        indices.resize(symbol.GetId() + 1, -1);
+    }
+    indices[symbol.GetId()] = index;
+}
+
+int FindIndex(const vecInt& indices, Symbol symbol) {
+    return symbol.IsDefined() && symbol.GetId() < static_cast<int>(indices.size()) ? indices[symbol.GetId()] : -1;
+}
+
+}  // namespace
+
+void HydroUnitNameIndex::AddBrick(const string& name, bool isLandCover) {
+    Symbol symbol(name);
+    SetIndex(_brickIndices, symbol, GetBrickCount());
+    _brickNames.push_back(name);
+
+    if (isLandCover) {
+        int landCoverIndex = _landCoverCount++;
+        SetIndex(_landCoverIndices, symbol, landCoverIndex);
+        int priority = GetGenericLandCoverPriority(name);
+        if (priority > 0 && (_genericLandCoverIndex < 0 || priority < _genericLandCoverPriority)) {
+            _genericLandCoverIndex = landCoverIndex;
+            _genericLandCoverPriority = priority;
+        }
+    }
+}
+
+void HydroUnitNameIndex::AddSplitter(const string& name) {
+    SetIndex(_splitterIndices, Symbol(name), GetSplitterCount());
+    _splitterNames.push_back(name);
+}
+
+const string& HydroUnitNameIndex::GetBrickName(int index) const {
+    assert(index >= 0 && index < GetBrickCount());
+    return _brickNames[index];
+}
+
+const string& HydroUnitNameIndex::GetSplitterName(int index) const {
+    assert(index >= 0 && index < GetSplitterCount());
+    return _splitterNames[index];
+}
+
+int HydroUnitNameIndex::GetBrickIndex(std::string_view name) const {
+    return FindIndex(_brickIndices, Symbol::Find(name));
+}
+
+int HydroUnitNameIndex::GetBrickIndex(Symbol symbol) const {
+    return FindIndex(_brickIndices, symbol);
+}
+
+int HydroUnitNameIndex::GetLandCoverIndex(std::string_view name) const {
+    return FindIndex(_landCoverIndices, Symbol::Find(name));
+}
+
+int HydroUnitNameIndex::GetLandCoverIndex(Symbol symbol) const {
+    return FindIndex(_landCoverIndices, symbol);
+}
+
+int HydroUnitNameIndex::GetSplitterIndex(std::string_view name) const {
+    return FindIndex(_splitterIndices, Symbol::Find(name));
+}
+
+int HydroUnitNameIndex::GetSplitterIndex(Symbol symbol) const {
+    return FindIndex(_splitterIndices, symbol);
+}
@@ -0,0 +1,137 @@
+#ifndef HYDROBRICKS_HYDRO_UNIT_NAME_INDEX_H
+#define HYDROBRICKS_HYDRO_UNIT_NAME_INDEX_H
+
+#include "Includes.h"
+#include "Symbol.h"
+
+/**
+ * Name index of the components of a model-structure variant, shared by all the hydro units built
+ * from it: the name-to-index lookups of the bricks, land covers and splitters. The lookups are
+ * arrays indexed by the symbol identifiers of the names. Each hydro unit still owns its bricks,
+ * processes, fluxes and splitters, stored in the order of the index; only the lookups are shared.
+ */
+class HydroUnitNameIndex {
+  public:
+    HydroUnitNameIndex() = default;
+
+    virtual ~HydroUnitNameIndex() = default;
+
+    /**
+     * Register the brick at the next index.
+     *
+     * @param name The name of the brick.
+     * @param isLandCover True if the brick is a land cover.
+     */
+    void AddBrick(const string& name, bool isLandCover);
+
+    /**
+     * Register the splitter at the next index.
+     *
+     * @param name The name of the splitter.
+     */
+    void AddSplitter(const string& name);
+
+    /**
+     * Get the number of registered bricks.
+     *
+     * @return The number of bricks.
+     */
+    [[nodiscard]] int GetBrickCount() const {
+        return static_cast<int>(_brickNames.size());
+    }
+
+    /**
+     * Get the number of registered splitters.
+     *
+     * @return The number of splitters.
+     */
+    [[nodiscard]] int GetSplitterCount() const {
+        return static_cast<int>(_splitterNames.size());
+    }
+
+    /**
+     * Get the name of a brick.
+     *
+     * @param index The index of the brick.
+     * @return The name of the brick.
+     */
+    [[nodiscard]] const string& GetBrickName(int index) const;
+
+    /**
+     * Get the name of a splitter.
+     *
+     * @param index The index of the splitter.
+     * @return The name of the splitter.
+     */
+    [[nodiscard]] const string& GetSplitterName(int index) const;
+
+    /**
+     * Get the index of a brick.
+     *
+     * @param name The name of the brick.
+     * @return The index of the brick, or -1 if not found.
+     */
+    [[nodiscard]] int GetBrickIndex(std::string_view name) const;
+
+    /**
+     * Get the index of a brick from the symbol of its name.
+     *
+     * @param symbol The symbol of the name of the brick.
+     * @return The index of the brick, or -1 if not found.
+     */
+    [[nodiscard]] int GetBrickIndex(Symbol symbol) const;
+
+    /**
+     * Get the index of a land cover among the land covers.
+     *
+     * @param name The name of the land cover.
+     * @return The index of the land cover, or -1 if not found.
+     */
+    [[nodiscard]] int GetLandCoverIndex(std::string_view name) const;
+
+    /**
+     * Get the index of a land cover from the symbol of its name.
+     *
+     * @param symbol The symbol of the name of the land cover.
+     * @return The index of the land cover, or -1 if not found.
+     */
+    [[nodiscard]] int GetLandCoverIndex(Symbol symbol) const;
+
+    /**
+     * Get the index of a splitter.
+     *
+     * @param name The name of the splitter.
+     * @return The index of the splitter, or -1 if not found.
+     */
+    [[nodiscard]] int GetSplitterIndex(std::string_view name) const;
+
+    /**
+     * Get the index of a splitter from the symbol of its name.
+     *
+     * @param symbol The symbol of the name of the splitter.
+     * @return The index of the splitter, or -1 if not found.
+     */
+    [[nodiscard]] int GetSplitterIndex(Symbol symbol) const;
+
+    /**
+     * Get the index (among the land covers) of the generic land cover that absorbs the area
+     * changes ('open', or its 'ground'/'generic'/'generic_land_cover' aliases).
+     *
+     * @return The index of the generic land cover, or -1 if none is defined.
+     */
+    [[nodiscard]] int GetGenericLandCoverIndex() const {
+        return _genericLandCoverIndex;
+    }
+
+  protected:
+    vecStr _brickNames;
+    vecStr _splitterNames;
+    vecInt _brickIndices;      // brick index per symbol identifier (-1 if none)
+    vecInt _landCoverIndices;  // land cover index per symbol identifier (-1 if none)
+    vecInt _splitterIndices;   // splitter index per symbol identifier (-1 if none)
+    int _landCoverCount = 0;
+    int _genericLandCoverIndex = -1;
+    int _genericLandCoverPriority = 0;  // rank of the generic land cover name (lower is preferred)
+};
+
+#endif  // HYDROBRICKS_HYDRO_UNIT_NAME_INDEX_H
@@ -2,8 +2,9 @@
 #define HYDROBRICKS_HYDRO_UNIT_PROPERTY_H
 
 #include "Includes.h"
+#include "ModelArena.h"
 
-class HydroUnitProperty {
+class HydroUnitProperty : public ArenaAllocated {
   public:
     HydroUnitProperty();
 
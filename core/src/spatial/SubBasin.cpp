@@ -9,7 +9,8 @@
 
 SubBasin::SubBasin()
     : _area(0),
-      _outletTotal(0) {}
+      _outletTotal(0),
+      _inflow(0) {}
 
 SubBasin::~SubBasin() {
     // Unique_ptr members clean up owned objects automatically.
@@ -26,6 +27,8 @@ ModelResult SubBasin::Initialize(SettingsBasin& basinSettings) {
 }
 
 void SubBasin::BuildBasin(SettingsBasin& basinSettings) {
+    ModelArena::Scope arenaScope(&_arena);
+
     // Pre-reserve containers when counts are known.
     int hydroUnitCount = basinSettings.GetHydroUnitCount();
     ReserveHydroUnits(hydroUnitCount);
@@ -110,6 +113,7 @@ void SubBasin::Reset() {
     for (auto flux : _outletFluxes) {
         flux->Reset();
     }
+    _inflow = 0;
 }
 
 void SubBasin::SaveAsInitialState() {
@@ -184,6 +188,11 @@ int SubBasin::GetHydroUnitCount() const {
     return static_cast<int>(_hydroUnits.size());
 }
 
+ModelArena* SubBasin::AddArena() {
+    _arenas.push_back(std::make_unique<ModelArena>());
+    return _arenas.back().get();
+}
+
 HydroUnit* SubBasin::GetHydroUnit(size_t index) const {
     assert(_hydroUnits.size() > index);
     assert(_hydroUnits[index]);
@@ -314,13 +323,16 @@ double* SubBasin::GetValuePointer(std::string_view name) {
     if (name == "outlet") {
         return &_outletTotal;
     }
+    if (name == "inflow") {
+        return &_inflow;
+    }
     LogError("Element '{}' not found", name);
 
     return nullptr;
 }
 
 bool SubBasin::ComputeOutletDischarge() {
-    _outletTotal = 0;
+    _outletTotal = _inflow;
     for (auto flux : _outletFluxes) {
         _outletTotal += flux->GetAmount();
     }
@@ -8,6 +8,7 @@
 #include "Connector.h"
 #include "HydroUnit.h"
 #include "Includes.h"
+#include "ModelArena.h"
 #include "SettingsBasin.h"
 #include "TimeMachine.h"
 
@@ -160,6 +161,24 @@ class SubBasin {
      */
     [[nodiscard]] int GetHydroUnitCount() const;
 
+    /**
+     * Get the memory arena holding the components (bricks, processes, fluxes, etc.) of the
+     * sub-basin and its hydro units.
+     *
+     * @return The memory arena of the sub-basin.
+     */
+    [[nodiscard]] ModelArena* GetArena() {
+        return &_arena;
+    }
+
+    /**
+     * Add a memory arena for the components built by another thread. It lives as long as the
+     * sub-basin. Not thread-safe: the calls must be synchronized by the caller.
+     *
+     * @return The new memory arena.
+     */
+    ModelArena* AddArena();
+
     /**
      * Reset all dynamic forcing overrides in all hydro units.
      */
@@ -309,6 +328,16 @@ class SubBasin {
      */
     double* GetValuePointer(std::string_view name);
 
+    /**
+     * Set the discharge entering the sub-basin from upstream sub-basins for the current time step.
+     * It is added to the outlet discharge, which therefore includes the upstream water.
+     *
+     * @param inflow The inflow [mm] (relative to the sub-basin area).
+     */
+    void SetInflow(double inflow) {
+        _inflow = inflow;
+    }
+
     /**
      * Compute the outlet discharge for the sub-basin.
      *
@@ -326,8 +355,11 @@ class SubBasin {
     }
 
   protected:
-    double _area;  // m2
+    ModelArena _arena;                                 // declared first: outlives the components allocated in it
+    std::vector<std::unique_ptr<ModelArena>> _arenas;  // arenas of the worker threads of the build
+    double _area;                                      // m2
     double _outletTotal;
+    double _inflow;                                       // mm, from upstream sub-basins
     std::vector<std::unique_ptr<Brick>> _bricks;          // owning: SubBasin-level bricks
     std::unordered_map<string, Brick*> _brickMap;         // non-owning views into _bricks
     std::vector<std::unique_ptr<Splitter>> _splitters;    // owning: SubBasin-level splitters
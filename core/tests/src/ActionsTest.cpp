@@ -91,6 +91,98 @@ TEST_F(ActionsInModel, LandCoverChangeWorks) {
     EXPECT_NEAR(subBasin.GetHydroUnit(2)->GetLandCover("glacier")->GetAreaFraction(), 0.4f, 0.0000001);
 }
 
+TEST_F(ActionsInModel, LandCoverChangesAddedUnorderedAreAppliedInDateOrder) {
+    SettingsBasin basinSettings;
+    basinSettings.AddHydroUnit(1, 100);
+    basinSettings.AddLandCover("ground", "", 0.5);
+    basinSettings.AddLandCover("glacier", "", 0.5);
+    basinSettings.AddHydroUnit(2, 100);
+    basinSettings.AddLandCover("ground", "", 0.5);
+    basinSettings.AddLandCover("glacier", "", 0.5);
+
+    SubBasin subBasin;
+    EXPECT_TRUE(subBasin.Initialize(basinSettings));
+
+    ModelHydro model(&subBasin);
+    EXPECT_TRUE(model.Initialize(_model, basinSettings));
+    EXPECT_TRUE(model.IsValid());
+
+    ASSERT_TRUE(model.AddTimeSeries(std::unique_ptr<TimeSeries>(std::move(_tsPrecip))));
+    ASSERT_TRUE(model.AddTimeSeries(std::unique_ptr<TimeSeries>(std::move(_tsTemp))));
+    ASSERT_TRUE(model.AddTimeSeries(std::unique_ptr<TimeSeries>(std::move(_tsPet))));
+    ASSERT_TRUE(model.AttachTimeSeriesToHydroUnits());
+
+    ActionLandCoverChange action;
+    action.AddChange(GetMJD(2020, 1, 8), 1, "glacier", 10);
+    action.AddChange(GetMJD(2020, 1, 6), 2, "glacier", 90);
+    action.AddChange(GetMJD(2020, 1, 2), 1, "glacier", 60);
+    action.AddChange(GetMJD(2020, 1, 4), 1, "glacier", 70);
+    action.AddChange(GetMJD(2020, 1, 2), 2, "glacier", 20);
+    EXPECT_TRUE(model.AddAction(&action));
+
+    ActionLandCoverChange otherAction;
+    otherAction.AddChange(GetMJD(2020, 1, 5), 2, "glacier", 30);
+    otherAction.AddChange(GetMJD(2020, 1, 3), 1, "glacier", 40);
+    EXPECT_TRUE(model.AddAction(&otherAction));
+
+    vecDouble dates = model.GetActionsManager()->GetSporadicActionDates();
+    ASSERT_EQ(dates.size(), 7);
+    EXPECT_TRUE(std::ranges::is_sorted(dates));
+
+    EXPECT_TRUE(model.Run());
+
+    EXPECT_NEAR(subBasin.GetHydroUnit(0)->GetLandCover("glacier")->GetAreaFraction(), 0.1, 0.0000001);
+    EXPECT_NEAR(subBasin.GetHydroUnit(1)->GetLandCover("glacier")->GetAreaFraction(), 0.9, 0.0000001);
+}
+
+TEST_F(ActionsInModel, LandCoverFractionsAreRecordedOnChange) {
+    SettingsBasin basinSettings;
+    basinSettings.AddHydroUnit(1, 100);
+    basinSettings.AddLandCover("ground", "", 0.5);
+    basinSettings.AddLandCover("glacier", "", 0.5);
+    basinSettings.AddHydroUnit(2, 100);
+    basinSettings.AddLandCover("ground", "", 0.5);
+    basinSettings.AddLandCover("glacier", "", 0.5);
+
+    _model.SetRecordFractions();
+
+    SubBasin subBasin;
+    EXPECT_TRUE(subBasin.Initialize(basinSettings));
+
+    ModelHydro model(&subBasin);
+    EXPECT_TRUE(model.Initialize(_model, basinSettings));
+    EXPECT_TRUE(model.IsValid());
+
+    ASSERT_TRUE(model.AddTimeSeries(std::unique_ptr<TimeSeries>(std::move(_tsPrecip))));
+    ASSERT_TRUE(model.AddTimeSeries(std::unique_ptr<TimeSeries>(std::move(_tsTemp))));
+    ASSERT_TRUE(model.AddTimeSeries(std::unique_ptr<TimeSeries>(std::move(_tsPet))));
+    ASSERT_TRUE(model.AttachTimeSeriesToHydroUnits());
+
+    ActionLandCoverChange action;
+    action.AddChange(GetMJD(2020, 1, 2), 2, "glacier", 60);
+    action.AddChange(GetMJD(2020, 1, 6), 2, "glacier", 80);
+    EXPECT_TRUE(model.AddAction(&action));
+
+    EXPECT_TRUE(model.Run());
+
+    // The initial fractions, then the glacier and ground fractions of the second unit at both dates.
+    EXPECT_EQ(model.GetLogger()->GetHydroUnitFractionChangeCount(), 8);
+
+    axxd fractions = model.GetHydroUnitFractions("glacier");
+    ASSERT_EQ(fractions.rows(), 10);
+    for (int step = 0; step < 10; ++step) {
+        double expected = step < 1 ? 0.5 : (step < 5 ? 0.6 : 0.8);
+        EXPECT_NEAR(fractions(step, 0), 0.5, 0.0000001);
+        EXPECT_NEAR(fractions(step, 1), expected, 0.0000001);
+    }
+
+    // The fractions are recorded again on a new run.
+    model.Reset();
+    EXPECT_TRUE(model.Run());
+    EXPECT_EQ(model.GetLogger()->GetHydroUnitFractionChangeCount(), 8);
+    EXPECT_NEAR(model.GetHydroUnitFractions("glacier")(9, 1), 0.8, 0.0000001);
+}
+
 TEST_F(ActionsInModel, LandCoverChangeConservesWaterBalance) {
     SettingsBasin basinSettings;
     basinSettings.AddHydroUnit(1, 100);
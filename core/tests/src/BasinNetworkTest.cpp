@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "BasinNetwork.h"
+#include "ModelHydro.h"
+#include "SettingsModel.h"
+#include "TimeSeriesUniform.h"
+
+/**
+ * Sub-basin made of a linear storage fed by a constant precipitation.
+ */
+class NetworkSubBasin {
+  public:
+    NetworkSubBasin(double area, double precipitation) {
+        _modelSettings.SetLogAll(true);
+        _modelSettings.SetSolver("euler_explicit");
+        _modelSettings.SetTimer("2020-01-01", "2020-01-10", 1, "day");
+        _modelSettings.AddHydroUnitBrick("storage", "storage");
+        _modelSettings.AddBrickForcing("precipitation");
+        _modelSettings.AddBrickProcess("outflow", "outflow:linear");
+        _modelSettings.SetProcessParameterValue("response_factor", 0.2f);
+        _modelSettings.AddProcessOutput("outlet");
+        _modelSettings.AddLoggingToItem("outlet");
+
+        _basinSettings.AddHydroUnit(1, area);
+        EXPECT_TRUE(_subBasin.Initialize(_basinSettings));
+
+        _model = std::make_unique<ModelHydro>(&_subBasin);
+        EXPECT_TRUE(_model->Initialize(_modelSettings, _basinSettings));
+
+        auto data = std::make_unique<TimeSeriesDataRegular>(GetMJD(2020, 1, 1), GetMJD(2020, 1, 10), 1, TimeUnit::Day);
+        data->SetValues(vecDouble(10, precipitation));
+        auto ts = std::make_unique<TimeSeriesUniform>(VariableType::Precipitation);
+        ts->SetData(std::move(data));
+        EXPECT_TRUE(_model->AddTimeSeries(std::move(ts)));
+        EXPECT_TRUE(_model->AttachTimeSeriesToHydroUnits());
+    }
+
+    ModelHydro* GetModel() {
+        return _model.get();
+    }
+
+    axd RunAlone() {
+        EXPECT_TRUE(_model->Run());
+        axd discharge = _model->GetOutletDischarge();
+        _model->Reset();
+
+        return discharge;
+    }
+
+  protected:
+    SettingsModel _modelSettings;
+    SettingsBasin _basinSettings;
+    SubBasin _subBasin;
+    std::unique_ptr<ModelHydro> _model;
+};
+
+TEST(BasinNetwork, ExecutionOrderFollowsTheNetwork) {
+    NetworkSubBasin headwater1(100, 5), headwater2(100, 5), middle(100, 5), outlet(100, 5);
+    BasinNetwork network;
+    int o = network.AddModel(outlet.GetModel());
+    int m = network.AddModel(middle.GetModel());
+    int h1 = network.AddModel(headwater1.GetModel());
+    int h2 = network.AddModel(headwater2.GetModel());
+    network.Connect(h1, m);
+    network.Connect(h2, m);
+    network.Connect(m, o);
+
+    vecInt order = network.GetExecutionOrder();
+
+    ASSERT_EQ(order.size(), 4);
+    EXPECT_EQ(order[3], o);
+    EXPECT_EQ(order[2], m);
+    EXPECT_EQ(network.GetDownstream(m), o);
+    EXPECT_EQ(network.GetDownstream(o), -1);
+    EXPECT_EQ(network.GetConnectorCount(), 3);
+}
+
+TEST(BasinNetwork, UpstreamDischargeIsAddedDownstream) {
+    NetworkSubBasin upstream(300, 6), downstream(100, 2);
+    axd upstreamAlone = upstream.RunAlone();
+    axd downstreamAlone = downstream.RunAlone();
+
+    BasinNetwork network;
+    int up = network.AddModel(upstream.GetModel());
+    int down = network.AddModel(downstream.GetModel());
+    network.Connect(up, down);
+    ASSERT_TRUE(network.Run(2));
+
+    axd downstreamDischarge = downstream.GetModel()->GetOutletDischarge();
+    axd expected = downstreamAlone + upstreamAlone * 300.0 / 100.0;
+    ASSERT_EQ(downstreamDischarge.size(), expected.size());
+    for (int i = 0; i < expected.size(); ++i) {
+        EXPECT_NEAR(downstreamDischarge[i], expected[i], 1e-10);
+    }
+    EXPECT_TRUE(upstream.GetModel()->GetOutletDischarge().isApprox(upstreamAlone));
+}
+
+TEST(BasinNetwork, DownstreamWaterBalanceCloses) {
+    NetworkSubBasin upstream(300, 6), downstream(100, 2);
+
+    BasinNetwork network;
+    int up = network.AddModel(upstream.GetModel());
+    int down = network.AddModel(downstream.GetModel());
+    network.Connect(up, down);
+    ASSERT_TRUE(network.Run(2));
+
+    // The downstream outlet includes the upstream water, which is logged as an inflow.
+    ModelHydro* model = downstream.GetModel();
+    double precipitation = 2.0 * 10;
+    double inflow = model->GetTotalInflow();
+    EXPECT_NEAR(inflow, upstream.GetModel()->GetTotalOutletDischarge() * 300.0 / 100.0, 1e-10);
+    EXPECT_DOUBLE_EQ(upstream.GetModel()->GetTotalInflow(), 0);
+
+    double balance = precipitation + inflow - model->GetTotalET() - model->GetTotalOutletDischarge() -
+                     model->GetTotalWaterStorageChanges();
+    EXPECT_NEAR(balance, 0, 1e-10);
+}
+
+TEST(BasinNetwork, ResultsDoNotDependOnTheThreadsNumber) {
+    vector<std::unique_ptr<NetworkSubBasin>> subBasins;
+    for (int i = 0; i < 7; ++i) {
+        subBasins.push_back(std::make_unique<NetworkSubBasin>(100 + 10 * i, 1 + i));
+    }
+
+    // Binary tree: 1, 2 -> 0; 3, 4 -> 1; 5, 6 -> 2.
+    BasinNetwork network;
+    for (auto& subBasin : subBasins) {
+        network.AddModel(subBasin->GetModel());
+    }
+    for (int i = 1; i < 7; ++i) {
+        network.Connect(i, (i - 1) / 2);
+    }
+
+    ASSERT_TRUE(network.Run(1));
+    axd sequential = subBasins[0]->GetModel()->GetOutletDischarge();
+    network.Reset();
+    ASSERT_TRUE(network.Run(4));
+    axd concurrent = subBasins[0]->GetModel()->GetOutletDischarge();
+
+    for (int i = 0; i < sequential.size(); ++i) {
+        EXPECT_DOUBLE_EQ(sequential[i], concurrent[i]);
+    }
+}
+
+TEST(BasinNetwork, InvalidConnectionsThrow) {
+    NetworkSubBasin a(100, 5), b(100, 5), c(100, 5);
+    BasinNetwork network;
+    int ia = network.AddModel(a.GetModel());
+    int ib = network.AddModel(b.GetModel());
+    int ic = network.AddModel(c.GetModel());
+    network.Connect(ia, ib);
+    network.Connect(ib, ic);
+
+    EXPECT_THROW(network.Connect(ia, ic), ModelConfigError);
+    EXPECT_THROW(network.Connect(ic, ia), ModelConfigError);
+    EXPECT_THROW(network.Connect(ic, ic), ModelConfigError);
+    EXPECT_THROW(network.Connect(ic, 5), ModelConfigError);
+}
+
+TEST(BasinNetwork, UpstreamDischargeIsRouted) {
+    NetworkSubBasin upstream(100, 6), downstream(100, 2);
+    axd upstreamAlone = upstream.RunAlone();
+    axd downstreamAlone = downstream.RunAlone();
+
+    BasinNetwork network;
+    int up = network.AddModel(upstream.GetModel());
+    int down = network.AddModel(downstream.GetModel());
+    EXPECT_THROW(network.SetRouting(up, "lag_and_route", {{"lag", 1}}), ModelConfigError);
+    network.Connect(up, down);
+    network.SetRouting(up, "lag_and_route", {{"lag", 1}});
+    ASSERT_TRUE(network.Run());
+
+    axd downstreamDischarge = downstream.GetModel()->GetOutletDischarge();
+    EXPECT_NEAR(downstreamDischarge[0], downstreamAlone[0], 1e-10);
+    for (int i = 1; i < downstreamDischarge.size(); ++i) {
+        EXPECT_NEAR(downstreamDischarge[i], downstreamAlone[i] + upstreamAlone[i - 1], 1e-10);
+    }
+}
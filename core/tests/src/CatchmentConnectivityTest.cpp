@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include "CatchmentConnectivity.h"
+
+namespace {
+
+// Two rows draining eastwards: unit 1 sends 3 cells to unit 2 and 1 cell to unit 3.
+void MakeTwoReceiversCase(axxi& unitMap, axxd& flowDir) {
+    unitMap.resize(2, 3);
+    unitMap << 1, 1, 2, 1, 1, 3;
+    flowDir.resize(2, 3);
+    flowDir << 1, 1, 1, 128, 1, 1;
+}
+
+}  // namespace
+
+TEST(CatchmentConnectivity, AccumulatesFlowWithinUnitsD8) {
+    axxi unitMap(1, 3);
+    unitMap << 1, 1, 2;
+    axxd flowDir = axxd::Constant(1, 3, 1);
+
+    SparseMatrixd contributions = ComputeUnitFlowContributions(unitMap, flowDir, {1, 2});
+
+    ASSERT_EQ(contributions.rows(), 2);
+    ASSERT_EQ(contributions.cols(), 3);
+    EXPECT_DOUBLE_EQ(contributions.coeff(0, 1), 2.0);
+    EXPECT_EQ(contributions.nonZeros(), 1);
+}
+
+TEST(CatchmentConnectivity, SplitsFlowWithDInf) {
+    axxi unitMap(2, 2);
+    unitMap << 0, 3, 1, 2;
+    axxd flowDir = axxd::Constant(2, 2, NAN_D);
+    flowDir(1, 0) = constants::pi / 8;
+
+    SparseMatrixd contributions = ComputeUnitFlowContributions(unitMap, flowDir, {1, 2, 3}, FlowRouting::DInf);
+
+    EXPECT_DOUBLE_EQ(contributions.coeff(0, 1), 0.5);
+    EXPECT_DOUBLE_EQ(contributions.coeff(0, 2), 0.5);
+}
+
+TEST(CatchmentConnectivity, MultipleModeNormalizesFractions) {
+    axxi unitMap;
+    axxd flowDir;
+    MakeTwoReceiversCase(unitMap, flowDir);
+
+    SparseMatrixd connectivity = ComputeUnitConnectivity(unitMap, flowDir, {1, 2, 3});
+
+    EXPECT_DOUBLE_EQ(connectivity.coeff(0, 1), 0.75);
+    EXPECT_DOUBLE_EQ(connectivity.coeff(0, 2), 0.25);
+    EXPECT_EQ(connectivity.nonZeros(), 2);
+}
+
+TEST(CatchmentConnectivity, SingleModeKeepsMainConnection) {
+    axxi unitMap;
+    axxd flowDir;
+    MakeTwoReceiversCase(unitMap, flowDir);
+
+    SparseMatrixd connectivity = ComputeUnitConnectivity(unitMap, flowDir, {1, 2, 3}, "d8", "single");
+
+    EXPECT_DOUBLE_EQ(connectivity.coeff(0, 1), 1.0);
+    EXPECT_EQ(connectivity.nonZeros(), 1);
+}
+
+TEST(CatchmentConnectivity, UnitsDrainingOutAreConnectedToNeighboursOnlyWhenForced) {
+    axxi unitMap(2, 2);
+    unitMap << 1, 2, 0, 0;
+    axxd flowDir = axxd::Constant(2, 2, 4);
+
+    SparseMatrixd connectivity = ComputeUnitConnectivity(unitMap, flowDir, {1, 2});
+    EXPECT_EQ(connectivity.nonZeros(), 0);
+
+    SparseMatrixd forced = ComputeUnitConnectivity(unitMap, flowDir, {1, 2}, "d8", "multiple", true);
+    EXPECT_DOUBLE_EQ(forced.coeff(0, 1), 1.0);
+    EXPECT_DOUBLE_EQ(forced.coeff(1, 0), 1.0);
+}
+
+TEST(CatchmentConnectivity, UnknownUnitIdThrows) {
+    axxi unitMap = axxi::Constant(2, 2, 5);
+    axxd flowDir = axxd::Constant(2, 2, 1);
+
+    EXPECT_THROW(ComputeUnitFlowContributions(unitMap, flowDir, {1, 2}), InputError);
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include "ChannelRouting.h"
+
+namespace {
+
+// Unit pulse followed by zeros, long enough for the routed volume to leave the reach.
+axd MakePulse(int size = 200) {
+    axd pulse = axd::Zero(size);
+    pulse[1] = 10;
+
+    return pulse;
+}
+
+int GetPeakIndex(const axd& series) {
+    Eigen::Index index;
+    series.maxCoeff(&index);
+
+    return static_cast<int>(index);
+}
+
+}  // namespace
+
+TEST(ChannelRouting, LagShiftsTheSeries) {
+    auto routing = ChannelRouting::Factory("lag_and_route");
+    routing->SetParameter("lag", 2);
+
+    axd outflow = routing->Route(MakePulse(10), 1);
+
+    EXPECT_DOUBLE_EQ(outflow[3], 10);
+    EXPECT_DOUBLE_EQ(outflow.sum(), 10);
+}
+
+TEST(ChannelRouting, FractionalLagIsInterpolated) {
+    auto routing = ChannelRouting::Factory("lag_and_route");
+    routing->SetParameter("lag", 1.5);
+
+    axd outflow = routing->Route(MakePulse(10), 1);
+
+    EXPECT_DOUBLE_EQ(outflow[2], 5);
+    EXPECT_DOUBLE_EQ(outflow[3], 5);
+}
+
+TEST(ChannelRouting, LagAndRouteAttenuatesAndConservesMass) {
+    auto routing = ChannelRouting::Factory("lag_and_route");
+    routing->SetParameter("lag", 1);
+    routing->SetParameter("storage_constant", 2);
+
+    axd outflow = routing->Route(MakePulse(), 1);
+
+    EXPECT_DOUBLE_EQ(outflow[1], 0);
+    EXPECT_LT(outflow.maxCoeff(), 10);
+    EXPECT_NEAR(outflow.sum(), 10, 1e-9);
+}
+
+TEST(ChannelRouting, LinearReservoirCascadeDelaysThePeak) {
+    auto single = ChannelRouting::Factory("linear_reservoir_cascade");
+    single->SetParameter("storage_constant", 1);
+    auto cascade = ChannelRouting::Factory("linear_reservoir_cascade");
+    cascade->SetParameter("storage_constant", 1);
+    cascade->SetParameter("reservoirs_nb", 4);
+
+    axd singleOutflow = single->Route(MakePulse(), 1);
+    axd cascadeOutflow = cascade->Route(MakePulse(), 1);
+
+    EXPECT_GT(GetPeakIndex(cascadeOutflow), GetPeakIndex(singleOutflow));
+    EXPECT_LT(cascadeOutflow.maxCoeff(), singleOutflow.maxCoeff());
+    EXPECT_NEAR(cascadeOutflow.sum(), 10, 1e-9);
+}
+
+TEST(ChannelRouting, MuskingumCungeTranslatesAndConservesMass) {
+    auto routing = ChannelRouting::Factory("muskingum_cunge");
+    routing->SetParameter("length", 50000);
+    routing->SetParameter("celerity", 0.2);  // travel time of ~2.9 days
+    routing->SetParameter("diffusivity", 1000);
+
+    axd outflow = routing->Route(MakePulse(), 1);
+
+    EXPECT_GE(GetPeakIndex(outflow), 3);
+    EXPECT_LE(GetPeakIndex(outflow), 5);
+    EXPECT_NEAR(outflow.sum(), 10, 1e-9);
+}
+
+TEST(ChannelRouting, MuskingumCungeWithoutLengthKeepsTheSeries) {
+    auto routing = ChannelRouting::Factory("muskingum_cunge");
+
+    axd pulse = MakePulse(10);
+    EXPECT_TRUE(routing->Route(pulse, 1).isApprox(pulse));
+}
+
+TEST(ChannelRouting, InvalidSettingsThrow) {
+    EXPECT_THROW(ChannelRouting::Factory("kinematic_wave"), ModelConfigError);
+
+    auto routing = ChannelRouting::Factory("linear_reservoir_cascade");
+    EXPECT_THROW(routing->SetParameter("reservoirs_nb", 1.5), ModelConfigError);
+    EXPECT_THROW(routing->SetParameter("storage_constant", -1), ModelConfigError);
+    EXPECT_THROW(routing->SetParameter("lag", 1), ModelConfigError);
+}
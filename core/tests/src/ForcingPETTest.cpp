@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "ForcingPET.h"
+#include "ModelHydro.h"
+#include "SettingsModel.h"
+#include "TimeSeriesUniform.h"
+
+namespace {
+
+void BuildSoilModelWithNativePET(SettingsModel& model, const string& petMethod) {
+    model.SetSolver("heun_explicit");
+    model.SetTimer("2020-07-01", "2020-07-10", 1, "day");
+    model.SetLogAll(true);
+    model.SetPETMethod(petMethod);
+    model.GeneratePrecipitationSplitters(false);
+
+    model.AddLandCoverBrick("ground", "generic_land_cover");
+    model.SelectHydroUnitBrick("ground");
+    model.AddBrickProcess("throughfall", "outflow:direct", "soil");
+    model.SetProcessOutputsAsInstantaneous();
+
+    model.AddHydroUnitBrick("soil", "storage");
+    model.AddBrickParameter("capacity", 100.0f);
+    model.AddBrickProcess("et", "et:linear");
+    model.AddBrickProcess("outflow", "outflow:linear", "outlet");
+    model.SetProcessParameterValue("response_factor", 0.2f);
+    model.AddBrickProcess("overflow", "overflow", "outlet");
+
+    model.AddLoggingToItem("outlet");
+}
+
+std::unique_ptr<TimeSeries> MakeForcing(VariableType type, double value) {
+    auto data = std::make_unique<TimeSeriesDataRegular>(GetMJD(2020, 7, 1), GetMJD(2020, 7, 10), 1, TimeUnit::Day);
+    data->SetValues(vecDouble(10, value));
+    auto ts = std::make_unique<TimeSeriesUniform>(type);
+    ts->SetData(std::move(data));
+    return ts;
+}
+
+}  // namespace
+
+TEST(ForcingPET, ExtraterrestrialRadiationMatchesFAO56Example) {
+    // FAO-56, example 8: 20°S on the 3rd of September.
+    double ra = ForcingPET::ComputeExtraterrestrialRadiation(-20.0 * constants::pi / 180.0, 246);
+
+    EXPECT_NEAR(ra, 32.2, 0.1);
+}
+
+TEST(ForcingPET, DayLengthIsTwelveHoursAtEquator) {
+    EXPECT_NEAR(ForcingPET::ComputeDayLength(0, 100), 12.0, 1e-9);
+}
+
+TEST(ForcingPET, DayLengthIsLongerInNorthernSummer) {
+    double latitude = 46.0 * constants::pi / 180.0;
+
+    EXPECT_GT(ForcingPET::ComputeDayLength(latitude, 172), 15.0);
+    EXPECT_LT(ForcingPET::ComputeDayLength(latitude, 355), 9.0);
+}
+
+TEST(ForcingPET, KernelsReturnPlausibleSummerValues) {
+    double latitude = 46.0 * constants::pi / 180.0;
+    double ra = ForcingPET::ComputeExtraterrestrialRadiation(latitude, 182);
+    double dayLength = ForcingPET::ComputeDayLength(latitude, 182);
+
+    double hamon = ForcingPET::ComputeHamon(20, dayLength);
+    double oudin = ForcingPET::ComputeOudin(20, ra);
+    double hargreaves = ForcingPET::ComputeHargreaves(20, 12, 28, ra);
+    double priestleyTaylor = ForcingPET::ComputePriestleyTaylor(20, 12, 28, 25, ra, 500);
+
+    for (double pet : {hamon, oudin, hargreaves, priestleyTaylor}) {
+        EXPECT_GT(pet, 2.0);
+        EXPECT_LT(pet, 8.0);
+    }
+}
+
+TEST(ForcingPET, KernelsDoNotReturnNegativeValues) {
+    double ra = ForcingPET::ComputeExtraterrestrialRadiation(60.0 * constants::pi / 180.0, 355);
+
+    EXPECT_DOUBLE_EQ(ForcingPET::ComputeOudin(-10, ra), 0.0);
+    EXPECT_DOUBLE_EQ(ForcingPET::ComputeHargreaves(-25, -30, -20, ra), 0.0);
+    EXPECT_DOUBLE_EQ(ForcingPET::ComputeHargreaves(10, 12, 8, ra), 0.0);
+    EXPECT_GE(ForcingPET::ComputePriestleyTaylor(-15, -20, -10, 0.5, ra, 1000), 0.0);
+}
+
+TEST(ForcingPET, MethodNamesAreResolved) {
+    EXPECT_EQ(ForcingPET::GetMethodFromName("Hamon"), PETMethod::Hamon);
+    EXPECT_EQ(ForcingPET::GetMethodFromName("oudin"), PETMethod::Oudin);
+    EXPECT_EQ(ForcingPET::GetMethodFromName("Hargreaves"), PETMethod::Hargreaves);
+    EXPECT_EQ(ForcingPET::GetMethodFromName("Priestley-Taylor"), PETMethod::PriestleyTaylor);
+    EXPECT_EQ(ForcingPET::GetMethodFromName("priestley_taylor"), PETMethod::PriestleyTaylor);
+    EXPECT_THROW(ForcingPET::GetMethodFromName("penman"), InputError);
+}
+
+TEST(ForcingPET, ModelComputesPETFromTemperature) {
+    SettingsModel settings;
+    BuildSoilModelWithNativePET(settings, "Oudin");
+
+    SettingsBasin basinSettings;
+    basinSettings.AddHydroUnit(1, 100);
+    basinSettings.AddHydroUnitPropertyDouble("latitude", 46.0, "degrees");
+    basinSettings.AddLandCover("ground", "", 1.0);
+
+    SubBasin subBasin;
+    ASSERT_TRUE(subBasin.Initialize(basinSettings));
+
+    ModelHydro model(&subBasin);
+    ASSERT_TRUE(model.Initialize(settings, basinSettings));
+    ASSERT_TRUE(model.IsValid());
+
+    // No PET time series: it is derived from the temperature.
+    ASSERT_TRUE(model.AddTimeSeries(MakeForcing(VariableType::Precipitation, 10.0)));
+    ASSERT_TRUE(model.AddTimeSeries(MakeForcing(VariableType::Temperature, 20.0)));
+    ASSERT_TRUE(model.AttachTimeSeriesToHydroUnits());
+
+    ASSERT_TRUE(model.Run());
+
+    Logger* logger = model.GetLogger();
+    double et = logger->GetTotalET();
+    EXPECT_GT(et, 0.0);
+    EXPECT_NEAR(logger->GetTotalOutletDischarge() + et + logger->GetTotalWaterStorageChanges() - 100.0, 0.0, 1e-7);
+}
+
+TEST(ForcingPET, MissingTemperatureSeriesIsRejected) {
+    SettingsModel settings;
+    BuildSoilModelWithNativePET(settings, "Oudin");
+
+    SettingsBasin basinSettings;
+    basinSettings.AddHydroUnit(1, 100);
+    basinSettings.AddHydroUnitPropertyDouble("latitude", 46.0, "degrees");
+    basinSettings.AddLandCover("ground", "", 1.0);
+
+    SubBasin subBasin;
+    ASSERT_TRUE(subBasin.Initialize(basinSettings));
+
+    ModelHydro model(&subBasin);
+    ASSERT_TRUE(model.Initialize(settings, basinSettings));
+
+    ASSERT_TRUE(model.AddTimeSeries(MakeForcing(VariableType::Precipitation, 10.0)));
+    EXPECT_FALSE(model.AttachTimeSeriesToHydroUnits());
+}
+
+TEST(ForcingPET, PETSeriesIsRejectedWithNativeMethod) {
+    SettingsModel settings;
+    BuildSoilModelWithNativePET(settings, "Oudin");
+
+    SettingsBasin basinSettings;
+    basinSettings.AddHydroUnit(1, 100);
+    basinSettings.AddHydroUnitPropertyDouble("latitude", 46.0, "degrees");
+    basinSettings.AddLandCover("ground", "", 1.0);
+
+    SubBasin subBasin;
+    ASSERT_TRUE(subBasin.Initialize(basinSettings));
+
+    ModelHydro model(&subBasin);
+    ASSERT_TRUE(model.Initialize(settings, basinSettings));
+
+    ASSERT_TRUE(model.AddTimeSeries(MakeForcing(VariableType::Precipitation, 10.0)));
+    ASSERT_TRUE(model.AddTimeSeries(MakeForcing(VariableType::Temperature, 20.0)));
+    ASSERT_TRUE(model.AddTimeSeries(MakeForcing(VariableType::PET, 3.0)));
+    EXPECT_FALSE(model.AttachTimeSeriesToHydroUnits());
+}
+
+TEST(ForcingPET, ModelRequiresLatitude) {
+    SettingsModel settings;
+    BuildSoilModelWithNativePET(settings, "Hamon");
+
+    SettingsBasin basinSettings;
+    basinSettings.AddHydroUnit(1, 100);
+    basinSettings.AddLandCover("ground", "", 1.0);
+
+    SubBasin subBasin;
+    ASSERT_TRUE(subBasin.Initialize(basinSettings));
+
+    ModelHydro model(&subBasin);
+    EXPECT_FALSE(model.Initialize(settings, basinSettings));
+}
+
+TEST(ForcingPET, UnknownMethodIsRejectedBySettings) {
+    SettingsModel settings;
+
+    EXPECT_THROW(settings.SetPETMethod("thornthwaite"), InputError);
+}
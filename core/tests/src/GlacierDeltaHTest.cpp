@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include "ActionGlacierEvolutionDeltaH.h"
+#include "GlacierDeltaH.h"
+
+class GlacierDeltaHProfile : public ::testing::Test {
+  protected:
+    axd _elevations;
+    axd _areas;
+    axd _thicknesses;
+    axi _unitIds;
+    double _catchmentArea{1e8};
+
+    void SetUp() override {
+        _elevations = axd::LinSpaced(8, 2500, 3200);
+        _areas.resize(8);
+        _areas << 0, 2e5, 4e5, 6e5, 6e5, 4e5, 2e5, 1e5;
+        _thicknesses.resize(8);
+        _thicknesses << 0, 20, 45, 70, 80, 60, 40, 20;
+        _unitIds.resize(8);
+        _unitIds << 1, 1, 1, 2, 2, 2, 3, 3;
+    }
+};
+
+TEST_F(GlacierDeltaHProfile, TablesStartFromTheInitialProfileAndEndWithoutGlacier) {
+    GlacierDeltaH deltaH(_elevations, _areas, _thicknesses, _unitIds, _catchmentArea);
+    deltaH.Compute(100);
+
+    const axxd& areas = deltaH.GetLookupTableArea();
+    const axxd& volumes = deltaH.GetLookupTableVolume();
+
+    ASSERT_EQ(areas.rows(), 101);
+    ASSERT_EQ(areas.cols(), 3);
+    EXPECT_NEAR(areas.row(0).sum(), _areas.sum(), 1e-6);
+    EXPECT_NEAR(volumes.row(0).sum(), (_areas * _thicknesses).sum(), 1e-3);
+    EXPECT_NEAR(areas(0, 0), 6e5, 1e-6);
+    EXPECT_DOUBLE_EQ(areas.row(100).sum(), 0.0);
+    EXPECT_DOUBLE_EQ(volumes.row(100).sum(), 0.0);
+    EXPECT_EQ(deltaH.GetElevationParts().size(), 7);
+}
+
+TEST_F(GlacierDeltaHProfile, VolumeDecreasesByOneIncrement) {
+    GlacierDeltaH deltaH(_elevations, _areas, _thicknesses, _unitIds, _catchmentArea);
+    deltaH.Compute(50);
+
+    const axxd& volumes = deltaH.GetLookupTableVolume();
+    double initialVolume = volumes.row(0).sum();
+
+    EXPECT_NEAR(volumes.row(1).sum(), initialVolume * (1 - 1.0 / 50), 1e-6 * initialVolume);
+    for (int i = 1; i < volumes.rows(); ++i) {
+        EXPECT_LE(volumes.row(i).sum(), volumes.row(i - 1).sum() + 1e-6);
+    }
+}
+
+TEST_F(GlacierDeltaHProfile, TongueRetreatsFirst) {
+    GlacierDeltaH deltaH(_elevations, _areas, _thicknesses, _unitIds, _catchmentArea);
+    deltaH.Compute(100);
+
+    const axxd& areas = deltaH.GetLookupTableArea();
+
+    // Relative area loss at mid-course: the lowest unit shrinks faster than the highest one.
+    EXPECT_LT(areas(50, 0) / areas(0, 0), areas(50, 2) / areas(0, 2));
+}
+
+TEST_F(GlacierDeltaHProfile, SplittingBandsBetweenUnitsKeepsTotals) {
+    GlacierDeltaH reference(_elevations, _areas, _thicknesses, axi::Ones(8), _catchmentArea);
+    reference.Compute(40);
+
+    // Every band is split in two halves belonging to different hydro units.
+    axd elevations(16), areas(16), thicknesses(16);
+    axi unitIds(16);
+    for (int i = 0; i < 8; ++i) {
+        for (int k = 0; k < 2; ++k) {
+            elevations[2 * i + k] = _elevations[i];
+            areas[2 * i + k] = _areas[i] / 2;
+            thicknesses[2 * i + k] = _thicknesses[i];
+            unitIds[2 * i + k] = k + 1;
+        }
+    }
+    GlacierDeltaH split(elevations, areas, thicknesses, unitIds, _catchmentArea);
+    split.Compute(40);
+
+    axd referenceVolumes = reference.GetLookupTableVolume().col(0);
+    axd splitVolumes = split.GetLookupTableVolume().rowwise().sum();
+    EXPECT_TRUE(splitVolumes.isApprox(referenceVolumes, 1e-9));
+    EXPECT_TRUE(split.GetLookupTableArea().col(0).isApprox(split.GetLookupTableArea().col(1), 1e-9));
+}
+
+TEST_F(GlacierDeltaHProfile, WidthUpdateOptionsProduceValidTables) {
+    for (const auto& [updateWidth, reference] : {std::pair{true, "previous"}, std::pair{false, "initial"}}) {
+        GlacierDeltaH deltaH(_elevations, _areas, _thicknesses, _unitIds, _catchmentArea);
+        deltaH.Compute(60, updateWidth, reference);
+
+        const axxd& areas = deltaH.GetLookupTableArea();
+        EXPECT_FALSE(areas.isNaN().any());
+        EXPECT_NEAR(areas.row(0).sum(), _areas.sum(), 1e-6);
+        EXPECT_LE(areas.row(30).sum(), areas.row(0).sum());
+        EXPECT_DOUBLE_EQ(areas.row(60).sum(), 0.0);
+    }
+}
+
+TEST_F(GlacierDeltaHProfile, ObservedDeltaHIsUsed) {
+    GlacierDeltaH deltaH(_elevations, _areas, _thicknesses, _unitIds, _catchmentArea);
+    axd normElevations(2), normDeltaH(2);
+    normElevations << 1, 0;
+    normDeltaH << 1, 1;
+    deltaH.SetObservedDeltaH(normElevations, normDeltaH);
+    deltaH.Compute(100, false);
+
+    // A uniform thinning removes the same water equivalent (per initial area) everywhere in the first increment.
+    const axxd& we = deltaH.GetWaterEquivalentParts();
+    const axxd& areas = deltaH.GetAreaFractionParts();
+    axd loss = (we.row(0) * areas.row(0) - we.row(1) * areas.row(1)) / areas.row(0);
+    EXPECT_NEAR(loss.maxCoeff(), loss.minCoeff(), 1e-6);
+}
+
+TEST_F(GlacierDeltaHProfile, FeedsTheAction) {
+    GlacierDeltaH deltaH(_elevations, _areas, _thicknesses, _unitIds, _catchmentArea);
+    deltaH.Compute(20);
+
+    ActionGlacierEvolutionDeltaH action;
+    deltaH.AddLookupTablesTo(action, 10, "glacier");
+
+    EXPECT_EQ(action.GetLandCoverName(), "glacier");
+    EXPECT_TRUE((action.GetHydroUnitIds() == deltaH.GetHydroUnitIds()).all());
+    EXPECT_TRUE(action.GetLookupTableVolume().isApprox(deltaH.GetLookupTableVolume()));
+}
+
+TEST(GlacierDeltaH, ProfileWithoutGlacierThrows) {
+    axd elevations = axd::LinSpaced(3, 2000, 2200);
+    axd areas = axd::Zero(3);
+    axd thicknesses = axd::Ones(3);
+    axi unitIds = axi::Ones(3);
+
+    EXPECT_THROW(GlacierDeltaH(elevations, areas, thicknesses, unitIds, 1e6), InputError);
+}
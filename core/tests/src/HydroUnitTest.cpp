@@ -192,6 +192,27 @@ TEST(HydroUnit, ChangeLandCoverAreaFractionValidatesInvariants) {
     EXPECT_TRUE(unit.IsValid(false));
 }
 
+TEST(HydroUnit, ChangeLandCoverAreaFractionByPointer) {
+    HydroUnit unit(100, HydroUnit::Lumped);
+
+    auto ground = std::make_unique<LandCover>();
+    ground->SetName("ground");
+    ground->SetAreaFraction(0.7);
+    unit.AddBrick(std::move(ground));
+
+    auto glacier = std::make_unique<LandCover>();
+    glacier->SetName("glacier");
+    glacier->SetAreaFraction(0.3);
+    unit.AddBrick(std::move(glacier));
+
+    LandCover* glacierCover = unit.GetLandCover("glacier");
+    EXPECT_TRUE(unit.ChangeLandCoverAreaFraction(glacierCover, 0.6));
+    EXPECT_FALSE(unit.ChangeLandCoverAreaFraction(glacierCover, 1.2));
+
+    EXPECT_NEAR(glacierCover->GetAreaFraction(), 0.6, 0.0000001);
+    EXPECT_NEAR(unit.GetLandCover("ground")->GetAreaFraction(), 0.4, 0.0000001);
+}
+
 TEST(HydroUnit, ChangeLandCoverAreaFractionConservesWaterAndIce) {
     HydroUnit unit(100, HydroUnit::Lumped);
 
@@ -233,6 +254,51 @@ TEST(HydroUnit, ChangeLandCoverAreaFractionConservesWaterAndIce) {
     EXPECT_NEAR(waterVolume(), waterBefore, 1e-8);
 }
 
+TEST(HydroUnit, ChangeLandCoverAreaFractionsAtOnceConservesWater) {
+    HydroUnit unit(100, HydroUnit::Lumped);
+
+    auto ground = std::make_unique<GenericLandCover>();
+    ground->SetName("ground");
+    ground->SetAreaFraction(0.5);
+    ground->UpdateContent(30.0, ContentType::Water);
+    unit.AddBrick(std::move(ground));
+
+    auto glacier = std::make_unique<Glacier>();
+    glacier->SetName("glacier");
+    glacier->SetAreaFraction(0.3);
+    glacier->UpdateContent(10.0, ContentType::Water);
+    LandCover* glacierPtr = glacier.get();
+    unit.AddBrick(std::move(glacier));
+
+    auto forest = std::make_unique<GenericLandCover>();
+    forest->SetName("forest");
+    forest->SetAreaFraction(0.2);
+    forest->UpdateContent(20.0, ContentType::Water);
+    LandCover* forestPtr = forest.get();
+    unit.AddBrick(std::move(forest));
+
+    auto waterVolume = [&unit]() {
+        double volume = 0;
+        for (const char* name : {"ground", "glacier", "forest"}) {
+            LandCover* cover = unit.GetLandCover(name);
+            volume += cover->GetContent(ContentType::Water) * cover->GetAreaFraction();
+        }
+        return volume;
+    };
+
+    double waterBefore = waterVolume();
+
+    vector<LandCover*> changed = {glacierPtr, forestPtr};
+    vecDouble fractions = {0.1, 0.6};
+    EXPECT_TRUE(unit.ChangeLandCoverAreaFractions(changed, fractions));
+
+    EXPECT_NEAR(glacierPtr->GetAreaFraction(), 0.1, 1e-8);
+    EXPECT_NEAR(forestPtr->GetAreaFraction(), 0.6, 1e-8);
+    EXPECT_NEAR(unit.GetLandCover("ground")->GetAreaFraction(), 0.3, 1e-8);
+    EXPECT_NEAR(waterVolume(), waterBefore, 1e-8);
+    EXPECT_TRUE(unit.IsValid(false));
+}
+
 TEST(HydroUnit, ChangeLandCoverAreaFractionConservesSnow) {
     HydroUnit unit(100, HydroUnit::Lumped);
 
@@ -348,3 +414,67 @@ TEST(HydroUnit, IsValidNegativeArea) {
     EXPECT_FALSE(unit.IsValid());
     EXPECT_THROW(unit.Validate(), ModelConfigError);
 }
+
+TEST(HydroUnit, SharesTheNameIndexOfAnotherUnit) {
+    HydroUnit first(100, HydroUnit::Distributed);
+    auto ground = std::make_unique<LandCover>();
+    ground->SetName("open");
+    ground->SetAreaFraction(0.6);
+    first.AddBrick(std::move(ground));
+    auto glacier = std::make_unique<LandCover>();
+    glacier->SetName("glacier");
+    glacier->SetAreaFraction(0.4);
+    first.AddBrick(std::move(glacier));
+
+    HydroUnit second(100, HydroUnit::Distributed);
+    second.SetNameIndex(first.GetNameIndex());
+    auto secondGround = std::make_unique<LandCover>();
+    secondGround->SetName("open");
+    secondGround->SetAreaFraction(0.6);
+    LandCover* secondGroundPtr = secondGround.get();
+    second.AddBrick(std::move(secondGround));
+
+    EXPECT_EQ(first.GetNameIndex(), second.GetNameIndex());
+    EXPECT_EQ(second.GetBrick("open"), secondGroundPtr);
+    EXPECT_EQ(second.GetGenericLandCover(), secondGroundPtr);
+    EXPECT_NE(first.GetBrick("open"), secondGroundPtr);
+
+    // The shared name index describes a brick this unit does not hold yet.
+    EXPECT_FALSE(second.HasBrick("glacier"));
+    EXPECT_EQ(second.TryGetLandCover("glacier"), nullptr);
+
+    auto mismatch = std::make_unique<LandCover>();
+    mismatch->SetName("forest");
+    EXPECT_THROW(second.AddBrick(std::move(mismatch)), ModelConfigError);
+    EXPECT_THROW(second.SetNameIndex(first.GetNameIndex()), ShouldNotHappen);
+}
+
+TEST(HydroUnit, FindsComponentsBySymbol) {
+    HydroUnit unit(100, HydroUnit::Distributed);
+    auto ground = std::make_unique<LandCover>();
+    ground->SetName("open");
+    ground->SetAreaFraction(1.0);
+    LandCover* groundPtr = ground.get();
+    unit.AddBrick(std::move(ground));
+
+    Symbol open("open");
+    EXPECT_EQ(Symbol("open"), open);
+    EXPECT_EQ(Symbol::Find("open"), open);
+    EXPECT_EQ(open.GetName(), "open");
+    EXPECT_EQ(unit.GetBrick(open), groundPtr);
+    EXPECT_EQ(unit.TryGetLandCover(open), groundPtr);
+    EXPECT_TRUE(unit.HasBrick(open));
+
+    // A name that was interned elsewhere but is not a component of the unit.
+    Symbol other("symbol_not_in_unit");
+    EXPECT_NE(other, open);
+    EXPECT_FALSE(unit.HasBrick(other));
+    EXPECT_EQ(unit.TryGetSplitter(other), nullptr);
+    EXPECT_THROW((void)unit.GetBrick(other), ModelConfigError);
+
+    // Looking up a name never interned does not register it.
+    int count = Symbol::GetCount();
+    EXPECT_FALSE(Symbol::Find("name_never_interned").IsDefined());
+    EXPECT_FALSE(unit.HasBrick("name_never_interned"));
+    EXPECT_EQ(Symbol::GetCount(), count);
+}
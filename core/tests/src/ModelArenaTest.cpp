@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "FluxSimple.h"
+#include "ModelArena.h"
+#include "ModelHydro.h"
+#include "SettingsModel.h"
+#include "Storage.h"
+
+TEST(ModelArena, ObjectsAreAllocatedInTheCurrentArena) {
+    ModelArena arena;
+    std::unique_ptr<Flux> inArena;
+    {
+        ModelArena::Scope scope(&arena);
+        inArena = std::make_unique<FluxSimple>();
+        EXPECT_EQ(ModelArena::GetCurrent(), &arena);
+    }
+    EXPECT_EQ(ModelArena::GetCurrent(), nullptr);
+    EXPECT_GE(arena.GetAllocatedSize(), sizeof(FluxSimple));
+
+    size_t allocatedSize = arena.GetAllocatedSize();
+    auto onHeap = std::make_unique<FluxSimple>();
+    EXPECT_EQ(arena.GetAllocatedSize(), allocatedSize);
+
+    // Deleting objects from both origins is safe.
+    inArena.reset();
+    onHeap.reset();
+}
+
+TEST(ModelArena, ScopesCanBeNested) {
+    ModelArena outer, inner;
+    ModelArena::Scope outerScope(&outer);
+    {
+        ModelArena::Scope innerScope(&inner);
+        auto brick = std::make_unique<Storage>();
+        EXPECT_GT(inner.GetAllocatedSize(), 0);
+        EXPECT_EQ(outer.GetAllocatedSize(), 0);
+    }
+    EXPECT_EQ(ModelArena::GetCurrent(), &outer);
+}
+
+TEST(ModelArena, ModelComponentsAreAllocatedInTheSubBasinArena) {
+    SettingsModel modelSettings;
+    modelSettings.SetSolver("heun_explicit");
+    modelSettings.SetTimer("2020-01-01", "2020-01-10", 1, "day");
+    modelSettings.AddHydroUnitBrick("storage", "storage");
+    modelSettings.AddBrickForcing("precipitation");
+    modelSettings.AddBrickProcess("outflow", "outflow:linear");
+    modelSettings.AddProcessOutput("outlet");
+
+    SettingsBasin basinSettings;
+    basinSettings.AddHydroUnit(1, 100);
+
+    SubBasin subBasin;
+    ASSERT_TRUE(subBasin.Initialize(basinSettings));
+    size_t basinSize = subBasin.GetArena()->GetAllocatedSize();
+
+    ModelHydro model(&subBasin);
+    ASSERT_TRUE(model.Initialize(modelSettings, basinSettings));
+
+    EXPECT_GT(subBasin.GetArena()->GetAllocatedSize(), basinSize);
+    EXPECT_EQ(ModelArena::GetCurrent(), nullptr);
+}
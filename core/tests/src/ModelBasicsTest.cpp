@@ -217,6 +217,134 @@ TEST_F(ModelBasics, InMemoryHydroUnitValuesMatchLogger) {
         std::invalid_argument);
 }
 
+TEST_F(ModelBasics, HydroUnitValuesAreAggregatedOverPeriods) {
+    _model1.SetTimer("2020-01-25", "2020-02-03", 1, "day");
+
+    auto runModel = [this](vecStr& labels, axd& hydroUnitTime, axd& outlet) {
+        SettingsBasin basinSettings;
+        basinSettings.AddHydroUnit(1, 100);
+
+        SubBasin subBasin;
+        EXPECT_TRUE(subBasin.Initialize(basinSettings));
+
+        ModelHydro model(&subBasin);
+        EXPECT_TRUE(model.Initialize(_model1, basinSettings));
+
+        auto data = std::make_unique<TimeSeriesDataRegular>(GetMJD(2020, 1, 25), GetMJD(2020, 2, 3), 1,
+                                                            TimeUnit::Day);
+        data->SetValues({0.0, 10.0, 0.0, 5.0, 0.0, 0.0, 20.0, 0.0, 2.0, 0.0});
+        auto precip = std::make_unique<TimeSeriesUniform>(VariableType::Precipitation);
+        precip->SetData(std::move(data));
+        EXPECT_TRUE(model.AddTimeSeries(std::move(precip)));
+        EXPECT_TRUE(model.AttachTimeSeriesToHydroUnits());
+        EXPECT_TRUE(model.Run());
+
+        labels = model.GetRecordedHydroUnitLabels();
+        hydroUnitTime = model.GetLogger()->GetHydroUnitTime();
+        outlet = model.GetOutletDischarge();
+        vecAxxd values;
+        for (const auto& label : labels) {
+            values.push_back(model.GetHydroUnitValues(label));
+        }
+        return values;
+    };
+
+    // Reference: the values of every time step.
+    vecStr labels;
+    axd time, outlet;
+    vecAxxd reference = runModel(labels, time, outlet);
+    ASSERT_EQ(time.size(), 10);
+    auto content = std::ranges::find(labels, "storage:water_content");
+    auto output = std::ranges::find_if(labels, [](const string& label) { return label.ends_with(":output"); });
+    ASSERT_NE(content, labels.end());
+    ASSERT_NE(output, labels.end());
+    const axxd& refContent = reference[std::distance(labels.begin(), content)];
+    const axxd& refOutput = reference[std::distance(labels.begin(), output)];
+
+    // Monthly records: 7 days in January and 3 days in February.
+    _model1.SetHydroUnitLogPeriod("month");
+    _model1.SetLogAggregation("storage:water_content", "mean");
+    vecStr monthlyLabels;
+    axd monthlyTime, monthlyOutlet;
+    vecAxxd monthly = runModel(monthlyLabels, monthlyTime, monthlyOutlet);
+    ASSERT_EQ(monthlyTime.size(), 2);
+    EXPECT_DOUBLE_EQ(monthlyTime[0], GetMJD(2020, 1, 25));
+    EXPECT_DOUBLE_EQ(monthlyTime[1], GetMJD(2020, 2, 1));
+
+    // The outlet stays at the time step resolution.
+    ASSERT_EQ(monthlyOutlet.size(), 10);
+    EXPECT_TRUE(monthlyOutlet.isApprox(outlet));
+
+    const axxd& monthlyContent = monthly[std::distance(labels.begin(), content)];
+    const axxd& monthlyOutput = monthly[std::distance(labels.begin(), output)];
+    ASSERT_EQ(monthlyContent.rows(), 2);
+    EXPECT_NEAR(monthlyContent(0, 0), refContent.col(0).head(7).mean(), 1e-9);
+    EXPECT_NEAR(monthlyContent(1, 0), refContent.col(0).tail(3).mean(), 1e-9);
+    EXPECT_NEAR(monthlyOutput(0, 0), refOutput.col(0).head(7).sum(), 1e-9);
+    EXPECT_NEAR(monthlyOutput(1, 0), refOutput.col(0).tail(3).sum(), 1e-9);
+
+    EXPECT_THROW(_model1.SetHydroUnitLogPeriod("week"), InputError);
+    EXPECT_THROW(_model1.SetLogAggregation("storage:water_content", "median"), InputError);
+}
+
+TEST_F(ModelBasics, HydroUnitRecordsReadBackInTheTimeStepLayout) {
+    SettingsBasin basinSettings;
+    basinSettings.AddHydroUnit(1, 100);
+    basinSettings.AddHydroUnit(2, 50);
+    basinSettings.AddHydroUnit(3, 20);
+
+    SubBasin subBasin;
+    EXPECT_TRUE(subBasin.Initialize(basinSettings));
+
+    ModelHydro model(&subBasin);
+    ASSERT_TRUE(model.Initialize(_model1, basinSettings));
+
+    // Record known values per (label, step, unit), through the unit-major records.
+    Logger* logger = model.GetLogger();
+    const int labelsNb = static_cast<int>(model.GetRecordedHydroUnitLabels().size());
+    const int unitsNb = 3;
+    const int stepsNb = 10;
+    ASSERT_GT(labelsNb, 0);
+    vecDouble current(labelsNb * unitsNb);
+    for (int iLabel = 0; iLabel < labelsNb; ++iLabel) {
+        for (int iUnit = 0; iUnit < unitsNb; ++iUnit) {
+            logger->SetHydroUnitValuePointer(iUnit, iLabel, &current[iLabel * unitsNb + iUnit]);
+        }
+    }
+    auto expected = [](int run, int iLabel, int step, int iUnit) {
+        return 10000.0 * run + 1000.0 * iLabel + 10.0 * step + iUnit;
+    };
+
+    // A second recording after the values were read must switch back to the recording layout.
+    for (int run = 0; run < 2; ++run) {
+        logger->Reset();
+        for (int step = 0; step < stepsNb; ++step) {
+            for (int iLabel = 0; iLabel < labelsNb; ++iLabel) {
+                for (int iUnit = 0; iUnit < unitsNb; ++iUnit) {
+                    current[iLabel * unitsNb + iUnit] = expected(run, iLabel, step, iUnit);
+                }
+            }
+            logger->Record();
+            logger->Increment();
+        }
+
+        const vecAxxd& values = logger->GetHydroUnitValues();
+        ASSERT_EQ(values.size(), labelsNb);
+        for (int iLabel = 0; iLabel < labelsNb; ++iLabel) {
+            ASSERT_EQ(values[iLabel].rows(), stepsNb);
+            ASSERT_EQ(values[iLabel].cols(), unitsNb);
+            for (int step = 0; step < stepsNb; ++step) {
+                for (int iUnit = 0; iUnit < unitsNb; ++iUnit) {
+                    EXPECT_EQ(values[iLabel](step, iUnit), expected(run, iLabel, step, iUnit));
+                }
+            }
+        }
+
+        // Reading again does not transpose the values back.
+        EXPECT_EQ(logger->GetHydroUnitValues()[0].rows(), stepsNb);
+    }
+}
+
 TEST_F(ModelBasics, Model1WithEulerExplicitWithNoOutflowClosesBalance) {
     SettingsBasin basinSettings;
     basinSettings.AddHydroUnit(1, 100);
@@ -418,3 +546,38 @@ TEST_F(ModelBasics, Model2ClosesBalance) {
 
     EXPECT_NEAR(balance, 0.0, 0.0000001);
 }
+
+TEST_F(ModelBasics, BalanceTotalsAreAccumulatedWhileRecording) {
+    SettingsBasin basinSettings;
+    basinSettings.AddHydroUnit(1, 100);
+
+    SubBasin subBasin;
+    EXPECT_TRUE(subBasin.Initialize(basinSettings));
+
+    ModelHydro model(&subBasin);
+    ASSERT_TRUE(model.Initialize(_model2, basinSettings));
+
+    ASSERT_TRUE(model.AddTimeSeries(std::unique_ptr<TimeSeries>(std::move(_tsPrecip))));
+    ASSERT_TRUE(model.AttachTimeSeriesToHydroUnits());
+    EXPECT_TRUE(model.Run());
+
+    Logger* logger = model.GetLogger();
+    double discharge = logger->GetTotalOutletDischarge();
+    double storage = logger->GetTotalWaterStorageChanges();
+
+    // The running totals match the totals computed from the recorded series.
+    EXPECT_NEAR(discharge, logger->GetTotalSubBasin("outlet"), 1e-12);
+    EXPECT_NEAR(storage,
+                logger->GetHydroUnitsFinalStorageState(":water_content") -
+                    logger->GetHydroUnitsInitialStorageState(":water_content"),
+                1e-12);
+    EXPECT_NEAR(logger->GetTotalPrecipitation(), 10.0, 1e-12);
+    EXPECT_NEAR(discharge + storage - model.GetTotalPrecipitation(), 0.0, 1e-7);
+
+    // They are restarted with a new run.
+    model.Reset();
+    EXPECT_TRUE(model.Run());
+    EXPECT_NEAR(logger->GetTotalOutletDischarge(), discharge, 1e-12);
+    EXPECT_NEAR(logger->GetTotalWaterStorageChanges(), storage, 1e-12);
+    EXPECT_NEAR(logger->GetTotalPrecipitation(), 10.0, 1e-12);
+}
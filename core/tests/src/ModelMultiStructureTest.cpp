@@ -63,6 +63,11 @@ TEST(MultiStructure, HeterogeneousUnitsBuildAndLogPerStructure) {
     ASSERT_TRUE(initResult.has_value()) << "Initialize failed: " << initResult.error();
     EXPECT_TRUE(model.IsValid());
 
+    // Each structure variant has its own name index.
+    EXPECT_NE(subBasin.GetHydroUnit(0)->GetNameIndex(), subBasin.GetHydroUnit(1)->GetNameIndex());
+    EXPECT_TRUE(subBasin.GetHydroUnit(1)->HasBrick("extra"));
+    EXPECT_FALSE(subBasin.GetHydroUnit(0)->HasBrick("extra"));
+
     auto precip = std::make_unique<TimeSeriesDataRegular>(GetMJD(2020, 1, 1), GetMJD(2020, 1, 5), 1, TimeUnit::Day);
     precip->SetValues({0.0, 10.0, 10.0, 10.0, 0.0});
     auto tsPrecip = std::make_unique<TimeSeriesUniform>(VariableType::Precipitation);
@@ -175,3 +180,46 @@ TEST(MultiStructure, StructureAutoAssignedFromLandCovers) {
     EXPECT_FALSE(subBasin->GetHydroUnit(1)->HasBrick("forest"));
     EXPECT_TRUE(subBasin->GetHydroUnit(1)->HasBrick("ground"));
 }
+
+/**
+ * Hydro units built from the same structure variant share a single name index (names and
+ * lookups of their components) while holding their own bricks.
+ */
+TEST(MultiStructure, UnitsOfTheSameStructureShareTheirNameIndex) {
+    SettingsModel settings;
+    settings.SetSolver("heun_explicit");
+    settings.SetTimer("2020-01-01", "2020-01-05", 1, "day");
+    settings.GeneratePrecipitationSplitters(false);
+    settings.AddLandCoverBrick("ground", "generic_land_cover");
+    settings.SelectHydroUnitBrick("ground");
+    settings.AddBrickProcess("outflow", "outflow:direct", "outlet");
+    settings.AddStructure();
+    settings.GeneratePrecipitationSplitters(false);
+    settings.AddLandCoverBrick("ground", "generic_land_cover");
+    settings.SelectHydroUnitBrick("ground");
+    settings.AddBrickProcess("outflow", "outflow:direct", "outlet");
+    settings.AddHydroUnitBrick("extra", "storage");
+    settings.SelectHydroUnitBrick("extra");
+    settings.AddBrickProcess("outflow", "outflow:linear", "outlet");
+
+    SettingsBasin basin;
+    for (int id = 1; id <= 3; ++id) {
+        basin.AddHydroUnit(id, 100);
+        basin.AddLandCover("ground", "", 1.0);
+    }
+
+    SubBasin subBasin;
+    ASSERT_TRUE(subBasin.Initialize(basin));
+    subBasin.GetHydroUnit(1)->SetStructureId(2);
+
+    ModelHydro model(&subBasin);
+    auto initResult = model.Initialize(settings, basin);
+    ASSERT_TRUE(initResult.has_value()) << "Initialize failed: " << initResult.error();
+
+    HydroUnit* first = subBasin.GetHydroUnit(0);
+    HydroUnit* third = subBasin.GetHydroUnit(2);
+    EXPECT_EQ(first->GetNameIndex(), third->GetNameIndex());
+    EXPECT_NE(first->GetNameIndex(), subBasin.GetHydroUnit(1)->GetNameIndex());
+    EXPECT_NE(first->GetBrick("ground"), third->GetBrick("ground"));
+    EXPECT_EQ(third->GetLandCover("ground")->GetHydroUnit(), third);
+}
@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <filesystem>
+#include <functional>
 #include <memory>
 
 #include "ModelHydro.h"
@@ -46,6 +47,44 @@ class ModelSocontBasic : public ::testing::Test {
     void TearDown() override {
         // RAII cleanup via unique_ptr
     }
+
+    /**
+     * Run the model with the current settings on fresh copies of the meteorological series.
+     *
+     * @param basinSettings The basin settings.
+     * @param checkModel A check applied to the initialized sub-basin and model before the run.
+     * @return The outlet discharge series (empty if the run failed).
+     */
+    axd RunOutletDischarge(SettingsBasin& basinSettings,
+                           const std::function<void(SubBasin&, ModelHydro&)>& checkModel) {
+        const std::vector<std::pair<VariableType, vecDouble>> series = {
+            {VariableType::Precipitation, {0.0, 10.0, 10.0, 10.0, 10.0, 10.0, 10.0, 10.0, 10.0, 0.0}},
+            {VariableType::Temperature, {-2.0, -1.0, -1.0, 1.0, 2.0, 3.0, 4.0, 5.0, 8.0, 9.0}},
+            {VariableType::PET, vecDouble(10, 1.0)}};
+
+        SubBasin subBasin;
+        EXPECT_TRUE(subBasin.Initialize(basinSettings));
+        ModelHydro model(&subBasin);
+        EXPECT_TRUE(model.Initialize(_model, basinSettings));
+        checkModel(subBasin, model);
+
+        for (const auto& [type, values] : series) {
+            auto data = std::make_unique<TimeSeriesDataRegular>(GetMJD(2020, 1, 1), GetMJD(2020, 1, 10), 1,
+                                                                TimeUnit::Day);
+            data->SetValues(values);
+            auto ts = std::make_unique<TimeSeriesUniform>(type);
+            ts->SetData(std::move(data));
+            EXPECT_TRUE(model.AddTimeSeries(std::move(ts)));
+        }
+        EXPECT_TRUE(model.AttachTimeSeriesToHydroUnits());
+        auto result = model.Run();
+        if (!result) {
+            ADD_FAILURE() << result.error();
+            return {};
+        }
+
+        return model.GetOutletDischarge();
+    }
 };
 
 TEST_F(ModelSocontBasic, ModelBuildsCorrectly) {
@@ -485,6 +524,58 @@ TEST_F(ModelSocontBasic, WaterBalanceClosesWith4HydroUnits) {
     EXPECT_NEAR(balance, 0.0, 0.0000001);
 }
 
+TEST_F(ModelSocontBasic, ProcessKernelsGiveTheSameResults) {
+    SettingsBasin basinSettings;
+    basinSettings.AddHydroUnit(1, 100);
+    basinSettings.AddLandCover("ground", "", 0.5);
+    basinSettings.AddLandCover("glacier", "", 0.5);
+    basinSettings.AddHydroUnit(2, 50);
+    basinSettings.AddLandCover("ground", "", 0.2);
+    basinSettings.AddLandCover("glacier", "", 0.8);
+    basinSettings.AddHydroUnit(3, 200);
+    basinSettings.AddLandCover("ground", "", 1);
+    basinSettings.AddLandCover("glacier", "", 0);
+    _model.SetSolver("runge_kutta");
+
+    axd discharges[2];
+    for (int kernels = 0; kernels < 2; ++kernels) {
+        _model.SetProcessKernels(kernels == 1);
+        discharges[kernels] = RunOutletDischarge(basinSettings, [kernels](SubBasin&, ModelHydro& model) {
+            EXPECT_EQ(model.GetProcessor()->GetProcessKernelCount() > 0, kernels == 1);
+        });
+    }
+
+    ASSERT_EQ(discharges[0].size(), discharges[1].size());
+    for (int i = 0; i < discharges[0].size(); ++i) {
+        EXPECT_NEAR(discharges[0][i], discharges[1][i], 1e-12);
+    }
+}
+
+TEST_F(ModelSocontBasic, ParallelBuildGivesTheSameResults) {
+    SettingsBasin basinSettings;
+    const int unitsNb = 300;
+    for (int i = 0; i < unitsNb; ++i) {
+        basinSettings.AddHydroUnit(i + 1, 100 + i);
+        double glacierFraction = (i % 5) / 5.0;
+        basinSettings.AddLandCover("ground", "", 1 - glacierFraction);
+        basinSettings.AddLandCover("glacier", "", glacierFraction);
+    }
+
+    axd discharges[2];
+    const int threadsNb[2] = {1, 4};
+    for (int i = 0; i < 2; ++i) {
+        _model.SetBuildThreads(threadsNb[i]);
+        discharges[i] = RunOutletDischarge(basinSettings, [unitsNb](SubBasin& subBasin, ModelHydro&) {
+            EXPECT_EQ(subBasin.GetHydroUnit(unitsNb - 1)->GetNameIndex(), subBasin.GetHydroUnit(0)->GetNameIndex());
+        });
+    }
+
+    ASSERT_EQ(discharges[0].size(), discharges[1].size());
+    for (int i = 0; i < discharges[0].size(); ++i) {
+        EXPECT_DOUBLE_EQ(discharges[0][i], discharges[1][i]);
+    }
+}
+
 TEST(ModelSocont, WaterBalanceCloses) {
     SettingsBasin basinSettings;
     EXPECT_TRUE(basinSettings.Parse("../../tests/files/catchments/ch_sitter_appenzell/hydro_units.nc"));
@@ -0,0 +1,30 @@
+#include <gtest/gtest.h>
+
+#include "Includes.h"
+#include "Parallel.h"
+
+TEST(Parallel, BlocksCoverTheWholeRange) {
+    vecInt counts(1000, 0);
+    ParallelFor(
+        1000,
+        [&](int start, int end) {
+            for (int i = start; i < end; ++i) {
+                counts[i]++;
+            }
+        },
+        3);
+
+    for (int count : counts) {
+        EXPECT_EQ(count, 1);
+    }
+}
+
+TEST(Parallel, ExceptionsArePropagated) {
+    EXPECT_THROW(ParallelFor(
+                     100,
+                     [](int start, int) {
+                         if (start > 0) throw RuntimeError("Failure in a worker.");
+                     },
+                     4),
+                 RuntimeError);
+}
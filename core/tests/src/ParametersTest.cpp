@@ -1,8 +1,13 @@
 #include <gtest/gtest.h>
 
+#include <memory>
+
+#include "ModelHydro.h"
 #include "Parameter.h"
 #include "ParameterModifier.h"
 #include "ParametersUpdater.h"
+#include "TimeMachine.h"
+#include "TimeSeriesUniform.h"
 
 std::vector<double> GenerateDailyDatesVector() {
     std::vector<double> dates;
@@ -162,3 +167,92 @@ TEST(ParametersUpdater, DateUpdateYear) {
 
     EXPECT_EQ(parameter.GetValue(), 5);
 }
+
+TEST(ParametersUpdater, TrajectoriesGiveTheSameValuesAsDateUpdates) {
+    ParameterModifier yearly(ParameterModifierType::Yearly);
+    yearly.SetYearlyValues(2009, 2011, {1, 2, 3});
+    ParameterModifier monthly(ParameterModifierType::Monthly);
+    monthly.SetMonthlyValues({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+    ParameterModifier dated(ParameterModifierType::Dates);
+    dated.SetDatesAndValues(GenerateDailyDatesVector(), {1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+
+    std::vector<Parameter> parameters;
+    for (const auto& modifier : {yearly, monthly, dated, yearly, monthly, dated}) {
+        parameters.emplace_back("dummy_parameter", 0.0f);
+        parameters.back().SetModifier(modifier);
+    }
+    ParametersUpdater dateUpdater, stepUpdater;
+    for (int i = 0; i < 3; ++i) {
+        dateUpdater.AddParameter(&parameters[i]);
+        stepUpdater.AddParameter(&parameters[i + 3]);
+    }
+
+    TimeMachine timer;
+    timer.Initialize(GetMJD(2009, 12, 25), GetMJD(2010, 3, 5), 1, TimeUnit::Day);
+    stepUpdater.BuildTrajectories(timer);
+    ASSERT_TRUE(stepUpdater.HasTrajectories());
+
+    // Two runs, as the timer can be reset between runs.
+    for (int run = 0; run < 2; ++run) {
+        timer.Reset();
+        while (!timer.IsOver()) {
+            timer.IncrementTime();
+            dateUpdater.DateUpdate(timer.GetDate(), timer.GetCalendar());
+            stepUpdater.StepUpdate(timer.GetCurrentStep());
+            for (int i = 0; i < 3; ++i) {
+                EXPECT_EQ(parameters[i].GetValue(), parameters[i + 3].GetValue());
+            }
+        }
+    }
+
+    // Adding a parameter discards the trajectories.
+    stepUpdater.AddParameter(&parameters[0]);
+    EXPECT_FALSE(stepUpdater.HasTrajectories());
+}
+
+TEST(ParametersUpdater, ModelAppliesTheModifiedParameterValues) {
+    ParameterModifier monthly(ParameterModifierType::Monthly);
+    monthly.SetMonthlyValues({0, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f});
+
+    // Once with the precomputed trajectories and once with the date-based updates.
+    vector<axd> discharges;
+    for (bool trajectories : {true, false}) {
+        SettingsModel settings;
+        settings.SetSolver("euler_explicit");
+        settings.SetTimer("2020-01-25", "2020-02-05", 1, "day");
+        settings.SetParameterTrajectories(trajectories);
+        settings.AddHydroUnitBrick("storage", "storage");
+        settings.AddBrickForcing("precipitation");
+        settings.AddBrickProcess("outflow", "outflow:linear");
+        settings.SetProcessParameterValue("response_factor", 0.0f);
+        settings.AddProcessOutput("outlet");
+        settings.AddLoggingToItem("outlet");
+        ASSERT_TRUE(settings.SetParameterModifier("storage", "response_factor", monthly));
+        EXPECT_FALSE(settings.SetParameterModifier("storage", "unknown_parameter", monthly));
+
+        SettingsBasin basinSettings;
+        basinSettings.AddHydroUnit(1, 100);
+        SubBasin subBasin;
+        ASSERT_TRUE(subBasin.Initialize(basinSettings));
+        ModelHydro model(&subBasin);
+        ASSERT_TRUE(model.Initialize(settings, basinSettings));
+
+        auto data = std::make_unique<TimeSeriesDataRegular>(GetMJD(2020, 1, 25), GetMJD(2020, 2, 5), 1, TimeUnit::Day);
+        data->SetValues(vecDouble(12, 10.0));
+        auto precipitation = std::make_unique<TimeSeriesUniform>(VariableType::Precipitation);
+        precipitation->SetData(std::move(data));
+        ASSERT_TRUE(model.AddTimeSeries(std::move(precipitation)));
+        ASSERT_TRUE(model.AttachTimeSeriesToHydroUnits());
+        ASSERT_TRUE(model.Run());
+
+        discharges.push_back(model.GetOutletDischarge());
+    }
+
+    // No outflow in January, then the storage drains with the February response factor.
+    for (const auto& discharge : discharges) {
+        ASSERT_EQ(discharge.size(), 12);
+        EXPECT_DOUBLE_EQ(discharge.head(7).abs().sum(), 0.0);
+        EXPECT_GT(discharge[7], 0.0);
+    }
+    EXPECT_TRUE(discharges[0].isApprox(discharges[1]));
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include "PotentialSolarRadiation.h"
+
+namespace {
+
+/**
+ * Slope and aspect of a plane tilted towards a given aspect (uniform over the grid).
+ */
+void MakePlane(int rows, int cols, double slopeDeg, double aspectDeg, axxd& slope, axxd& aspect) {
+    slope = axxd::Constant(rows, cols, slopeDeg);
+    aspect = axxd::Constant(rows, cols, aspectDeg);
+}
+
+}  // namespace
+
+TEST(PotentialSolarRadiation, HorizonTangentOfSimpleProfile) {
+    axxd dem(1, 3);
+    dem << 0, 0, 10;
+
+    // Towards the east (azimuth -90° from the south): the cell at 20 m from the top is the horizon.
+    axxd horizon = ComputeHorizonTangents(dem, 10, -90);
+
+    EXPECT_DOUBLE_EQ(horizon(0, 0), 0.5);
+    EXPECT_DOUBLE_EQ(horizon(0, 1), 1.0);
+    EXPECT_TRUE(std::isinf(horizon(0, 2)));
+}
+
+TEST(PotentialSolarRadiation, HorizonOfFlatTerrainIsFlat) {
+    axxd dem = axxd::Constant(5, 5, 1000);
+
+    axxd horizon = ComputeHorizonTangents(dem, 25, 30);
+
+    EXPECT_LE(horizon.maxCoeff(), 0.0);
+}
+
+TEST(PotentialSolarRadiation, FlatTerrainHasNoCastShadows) {
+    axxd dem = axxd::Constant(6, 6, 500);
+    axxd slope, aspect;
+    MakePlane(6, 6, 0, 0, slope, aspect);
+
+    axxd withShadows = ComputeDailyPotentialRadiation(dem, slope, aspect, 100, 46, 500, 0.75, 2, true);
+    axxd withoutShadows = ComputeDailyPotentialRadiation(dem, slope, aspect, 100, 46, 500, 0.75, 2, false);
+
+    ASSERT_EQ(withShadows.rows(), 366);
+    ASSERT_EQ(withShadows.cols(), 36);
+    EXPECT_TRUE(withShadows.isApprox(withoutShadows));
+    EXPECT_GT(withShadows(171, 0), withShadows(354, 0));
+}
+
+TEST(PotentialSolarRadiation, SouthFacingSlopeReceivesMoreInWinter) {
+    axxd dem = axxd::Constant(3, 3, 500);
+    axxd slope, aspect;
+    MakePlane(3, 3, 30, 180, slope, aspect);
+    axxd south = ComputeDailyPotentialRadiation(dem, slope, aspect, 100, 46, 500, 0.75, 2, false);
+    MakePlane(3, 3, 30, 0, slope, aspect);
+    axxd north = ComputeDailyPotentialRadiation(dem, slope, aspect, 100, 46, 500, 0.75, 2, false);
+
+    EXPECT_GT(south(354, 4), 2 * north(354, 4));
+}
+
+TEST(PotentialSolarRadiation, RidgeCastsShadowsOnItsNorthSide) {
+    int rows = 20;
+    int cols = 5;
+    axxd dem = axxd::Constant(rows, cols, 1000);
+    dem.row(10).setConstant(2000);
+    axxd slope, aspect;
+    MakePlane(rows, cols, 0, 0, slope, aspect);
+
+    axxd radiation = ComputeDailyPotentialRadiation(dem, slope, aspect, 100, 46, 1000, 0.75, 2, true);
+
+    // In winter, the cells just north of the ridge stay in its shadow, while those south of it do not.
+    int northCell = 9 * cols + 2;
+    int southCell = 11 * cols + 2;
+    EXPECT_DOUBLE_EQ(radiation(354, northCell), 0.0);
+    EXPECT_GT(radiation(354, southCell), 0.0);
+}
+
+TEST(PotentialSolarRadiation, MultithreadedMatchesSingleThreaded) {
+    int rows = 15;
+    int cols = 12;
+    axxd dem(rows, cols);
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            dem(r, c) = 1000 + 80 * std::sin(0.7 * r) * std::cos(0.5 * c) + 20 * r;
+        }
+    }
+    axxd slope = axxd::Constant(rows, cols, 15);
+    axxd aspect = axd::LinSpaced(rows * cols, 0, 359).reshaped(rows, cols);
+
+    axxd single = ComputeDailyPotentialRadiation(dem, slope, aspect, 50, 46, 1200, 0.75, 4, true, 72, 1);
+    axxd multi = ComputeDailyPotentialRadiation(dem, slope, aspect, 50, 46, 1200, 0.75, 4, true, 72, 4);
+
+    EXPECT_TRUE(single.isApprox(multi));
+}
+
+TEST(PotentialSolarRadiation, WrongShapeThrows) {
+    axxd dem = axxd::Constant(3, 3, 500);
+    axxd slope = axxd::Zero(3, 2);
+    axxd aspect = axxd::Zero(3, 3);
+
+    EXPECT_THROW(ComputeDailyPotentialRadiation(dem, slope, aspect, 100, 46, 500), InputError);
+}
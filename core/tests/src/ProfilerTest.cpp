@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include "ModelHydro.h"
+#include "Profiler.h"
+#include "SettingsModel.h"
+#include "TimeSeriesUniform.h"
+
+TEST(Profiler, SectionsAreRegisteredOnce) {
+    int section = Profiler::RegisterSection("test", "section_a");
+    EXPECT_EQ(Profiler::RegisterSection("test", "section_a"), section);
+    EXPECT_NE(Profiler::RegisterSection("test", "section_b"), section);
+}
+
+TEST(Profiler, SectionsAreTimedOnlyWithinAScope) {
+    int section = Profiler::RegisterSection("test", "scoped_section");
+    Profiler profiler;
+    {
+        ProfiledSection notProfiled(section);
+    }
+    EXPECT_TRUE(profiler.GetReport().empty());
+
+    {
+        Profiler::Scope scope(&profiler);
+        EXPECT_EQ(Profiler::GetCurrent(), &profiler);
+        for (int i = 0; i < 3; ++i) {
+            ProfiledSection profiled(section);
+        }
+    }
+    EXPECT_EQ(Profiler::GetCurrent(), nullptr);
+
+    vector<ProfilingRecord> report = profiler.GetReport();
+    ASSERT_EQ(report.size(), 1);
+    EXPECT_EQ(report[0].category, "test");
+    EXPECT_EQ(report[0].name, "scoped_section");
+    EXPECT_EQ(report[0].calls, 3);
+    EXPECT_GE(report[0].time, 0);
+
+    profiler.Reset();
+    EXPECT_TRUE(profiler.GetReport().empty());
+}
+
+TEST(Profiler, ModelRunIsProfiledWhenEnabled) {
+    SettingsModel modelSettings;
+    modelSettings.SetSolver("heun_explicit");
+    modelSettings.SetTimer("2020-01-01", "2020-01-10", 1, "day");
+    modelSettings.AddHydroUnitBrick("storage", "storage");
+    modelSettings.AddBrickForcing("precipitation");
+    modelSettings.AddBrickProcess("outflow", "outflow:linear");
+    modelSettings.SetProcessParameterValue("response_factor", 0.3f);
+    modelSettings.AddProcessOutput("outlet");
+    modelSettings.AddLoggingToItem("outlet");
+
+    SettingsBasin basinSettings;
+    basinSettings.AddHydroUnit(1, 100);
+
+    SubBasin subBasin;
+    ASSERT_TRUE(subBasin.Initialize(basinSettings));
+
+    ModelHydro model(&subBasin);
+    ASSERT_TRUE(model.Initialize(modelSettings, basinSettings));
+
+    auto data = std::make_unique<TimeSeriesDataRegular>(GetMJD(2020, 1, 1), GetMJD(2020, 1, 10), 1, TimeUnit::Day);
+    data->SetValues({0.0, 10.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0});
+    auto precip = std::make_unique<TimeSeriesUniform>(VariableType::Precipitation);
+    precip->SetData(std::move(data));
+    ASSERT_TRUE(model.AddTimeSeries(std::move(precip)));
+    ASSERT_TRUE(model.AttachTimeSeriesToHydroUnits());
+
+    ASSERT_TRUE(model.Run());
+    EXPECT_TRUE(model.GetProfilingReport().empty());
+
+    model.EnableProfiling();
+    model.Reset();
+    ASSERT_TRUE(model.Run());
+    vector<ProfilingRecord> report = model.GetProfilingReport();
+
+#ifdef USE_PROFILING
+    auto findRecord = [&report](const string& category, const string& name) {
+        return std::ranges::find_if(report, [&](const ProfilingRecord& record) {
+            return record.category == category && record.name == name;
+        });
+    };
+    auto record = findRecord("model", "record");
+    ASSERT_NE(record, report.end());
+    EXPECT_EQ(record->calls, 10);
+    auto process = findRecord("process", "outflow:linear");
+    ASSERT_NE(process, report.end());
+    EXPECT_GT(process->calls, 0);
+    EXPECT_NE(findRecord("solver", "evaluate_rates"), report.end());
+    EXPECT_NE(findRecord("model", "update_forcing"), report.end());
+#else
+    EXPECT_TRUE(report.empty());
+#endif
+
+    model.ResetProfiling();
+    EXPECT_TRUE(model.GetProfilingReport().empty());
+}
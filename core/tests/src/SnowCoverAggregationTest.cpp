@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+#include "FileNetcdf.h"
+#include "SnowCoverAggregation.h"
+
+class SnowCoverStack : public ::testing::Test {
+  protected:
+    axxi _unitMap;
+    axxdRowMajor _grids;
+
+    void SetUp() override {
+        // Unit 1 on the left column, unit 2 on the right columns, one cell outside.
+        _unitMap.resize(2, 3);
+        _unitMap << 1, 2, 2, 1, 2, 0;
+
+        // Raw snow cover (0-100 %), 250: cloud.
+        _grids.resize(3, 6);
+        _grids << 100, 0, 50, 100, 100, 100,  // all valid
+            250, 0, 100, 100, 250, 20,         // one cloudy cell per unit
+            250, 250, 250, 250, 100, 0;        // unit 1 fully cloudy, unit 2 one valid cell out of three
+    }
+};
+
+TEST_F(SnowCoverStack, CoverFractionIsTheMeanOfTheValidPixels) {
+    SnowCoverAggregates aggregates = AggregateSnowCover(_grids, _unitMap, {1, 2}, NAN_D, NAN_D, 100, 0.01);
+
+    ASSERT_EQ(aggregates.coverFraction.rows(), 3);
+    ASSERT_EQ(aggregates.coverFraction.cols(), 2);
+    EXPECT_DOUBLE_EQ(aggregates.coverFraction(0, 0), 1.0);
+    EXPECT_DOUBLE_EQ(aggregates.coverFraction(0, 1), 0.5);
+    EXPECT_DOUBLE_EQ(aggregates.coverFraction(1, 0), 1.0);
+    EXPECT_DOUBLE_EQ(aggregates.coverFraction(1, 1), 0.5);
+    EXPECT_TRUE(std::isnan(aggregates.coverFraction(2, 0)));
+    EXPECT_DOUBLE_EQ(aggregates.coverFraction(2, 1), 1.0);
+}
+
+TEST_F(SnowCoverStack, ValidFractionIsComputedPerUnit) {
+    SnowCoverAggregates aggregates = AggregateSnowCover(_grids, _unitMap, {1, 2}, NAN_D, NAN_D, 100, 0.01);
+
+    EXPECT_DOUBLE_EQ(aggregates.validFraction(0, 0), 1.0);
+    EXPECT_DOUBLE_EQ(aggregates.validFraction(1, 0), 0.5);
+    EXPECT_DOUBLE_EQ(aggregates.validFraction(1, 1), 2.0 / 3.0);
+    EXPECT_DOUBLE_EQ(aggregates.validFraction(2, 0), 0.0);
+    EXPECT_DOUBLE_EQ(aggregates.validFraction(2, 1), 1.0 / 3.0);
+}
+
+TEST_F(SnowCoverStack, MinValidRatioDiscardsCloudyDates) {
+    SnowCoverAggregates aggregates = AggregateSnowCover(_grids, _unitMap, {1, 2}, 250, NAN_D, NAN_D, 0.01, 0.6);
+
+    EXPECT_TRUE(std::isnan(aggregates.coverFraction(1, 0)));
+    EXPECT_DOUBLE_EQ(aggregates.coverFraction(1, 1), 0.5);
+    EXPECT_TRUE(std::isnan(aggregates.coverFraction(2, 1)));
+}
+
+TEST_F(SnowCoverStack, ResultsDoNotDependOnTheThreadsNumber) {
+    axxdRowMajor grids = _grids.replicate(40, 1);
+    SnowCoverAggregates single = AggregateSnowCover(grids, _unitMap, {1, 2, 3}, 250, NAN_D, NAN_D, 0.01, 0, 1);
+    SnowCoverAggregates multi = AggregateSnowCover(grids, _unitMap, {1, 2, 3}, 250, NAN_D, NAN_D, 0.01, 0, 4);
+
+    EXPECT_TRUE(single.validFraction.isApprox(multi.validFraction));
+    EXPECT_TRUE((single.coverFraction.isNaN() == multi.coverFraction.isNaN()).all());
+    EXPECT_TRUE(single.coverFraction.isNaN().col(2).all());
+}
+
+TEST_F(SnowCoverStack, GridSizeMismatchThrows) {
+    axxdRowMajor grids = axxdRowMajor::Zero(2, 5);
+
+    EXPECT_THROW(AggregateSnowCover(grids, _unitMap, {1, 2}), InputError);
+}
+
+TEST_F(SnowCoverStack, FilesAreReadAndConcatenated) {
+    string dir = std::filesystem::temp_directory_path().string();
+    vecStr paths;
+    for (int i = 0; i < 2; ++i) {
+        // First file: a single grid; second file: a stack of two grids.
+        int timeStepsNb = i == 0 ? 1 : 2;
+        string path = dir + std::format("/hb_test_snow_cover_{}.nc", i);
+        FileNetcdf file;
+        ASSERT_TRUE(file.Create(path));
+        vecInt dimIds;
+        if (timeStepsNb > 1) {
+            dimIds.push_back(file.DefDim("time", timeStepsNb));
+        }
+        dimIds.push_back(file.DefDim("y", 2));
+        dimIds.push_back(file.DefDim("x", 3));
+        int varId = file.DefVarDouble("snow_cover", dimIds, static_cast<int>(dimIds.size()));
+        vecDouble values;
+        for (int t = 0; t < timeStepsNb; ++t) {
+            for (int cell = 0; cell < 6; ++cell) {
+                values.push_back(_grids(i + t, cell));
+            }
+        }
+        file.PutVar(varId, values);
+        file.Close();
+        paths.push_back(path);
+    }
+
+    SnowCoverAggregates fromFiles =
+        AggregateSnowCoverFiles(paths, "snow_cover", _unitMap, {1, 2}, NAN_D, NAN_D, 100, 0.01);
+    SnowCoverAggregates fromStack = AggregateSnowCover(_grids, _unitMap, {1, 2}, NAN_D, NAN_D, 100, 0.01);
+
+    EXPECT_TRUE(fromFiles.validFraction.isApprox(fromStack.validFraction));
+    EXPECT_DOUBLE_EQ(fromFiles.coverFraction(1, 1), fromStack.coverFraction(1, 1));
+    EXPECT_DOUBLE_EQ(fromFiles.coverFraction(2, 1), fromStack.coverFraction(2, 1));
+
+    for (const auto& path : paths) {
+        std::filesystem::remove(path);
+    }
+}
+
+TEST(SnowCoverAggregation, MissingFileThrows) {
+    axxi unitMap = axxi::Ones(2, 2);
+
+    EXPECT_THROW(AggregateSnowCoverFiles({"missing-snow-cover.nc"}, "snow_cover", unitMap, {1}), InputError);
+}
@@ -345,6 +345,57 @@ TEST_F(SolverLinearStorage, UsingImplicitEuler) {
     EXPECT_NEAR(30.0 - basinOutputs[0].sum() - storageContent, 0, 0.00000001);
 }
 
+TEST_F(SolverLinearStorage, DiagnosticsCountTheSolverWork) {
+    SettingsBasin basinSettings;
+    basinSettings.AddHydroUnit(1, 100);
+
+    SubBasin subBasin;
+    EXPECT_TRUE(subBasin.Initialize(basinSettings));
+
+    ModelHydro model(&subBasin);
+    ASSERT_TRUE(model.Initialize(_model, basinSettings));
+
+    ASSERT_TRUE(model.AddTimeSeries(std::unique_ptr<TimeSeries>(std::move(_tsPrecip))));
+    ASSERT_TRUE(model.AttachTimeSeriesToHydroUnits());
+
+    EXPECT_TRUE(model.Run());
+
+    // One explicit Euler stage per time step, with its constraint sweeps and no bisection.
+    SolverDiagnostics diagnostics = model.GetSolverDiagnostics();
+    EXPECT_GE(diagnostics.rateEvaluations, 20);
+    EXPECT_GE(diagnostics.constraintSweeps, 20);
+    EXPECT_EQ(diagnostics.sweepLimitHits, 0);
+    EXPECT_EQ(diagnostics.bisectionIterations, 0);
+
+    // The counters are restarted with a new run.
+    model.Reset();
+    EXPECT_TRUE(model.Run());
+    EXPECT_EQ(model.GetSolverDiagnostics().rateEvaluations, diagnostics.rateEvaluations);
+    EXPECT_EQ(model.GetSolverDiagnostics().constraintSweeps, diagnostics.constraintSweeps);
+}
+
+TEST_F(SolverLinearStorage, DiagnosticsCountTheBisectionIterations) {
+    SettingsBasin basinSettings;
+    basinSettings.AddHydroUnit(1, 100);
+
+    SubBasin subBasin;
+    EXPECT_TRUE(subBasin.Initialize(basinSettings));
+
+    _model.SetSolver("implicit_euler");
+
+    ModelHydro model(&subBasin);
+    ASSERT_TRUE(model.Initialize(_model, basinSettings));
+
+    ASSERT_TRUE(model.AddTimeSeries(std::unique_ptr<TimeSeries>(std::move(_tsPrecip))));
+    ASSERT_TRUE(model.AttachTimeSeriesToHydroUnits());
+
+    EXPECT_TRUE(model.Run());
+
+    const SolverDiagnostics& diagnostics = model.GetSolverDiagnostics();
+    EXPECT_GT(diagnostics.bisectionIterations, 0);
+    EXPECT_GT(diagnostics.rateEvaluations, diagnostics.bisectionIterations);
+}
+
 TEST_F(SolverLinearStorage, UsingCrankNicolson) {
     SettingsBasin basinSettings;
     basinSettings.AddHydroUnit(1, 100);
@@ -779,6 +830,26 @@ TEST_F(SolverLinearStorageWithET, UsingEulerExplicit) {
     EXPECT_NEAR(30.0 - basinOutputs[0].sum() - unitContent[2].sum() - storageContent, 0, 0.00000000000001);
 }
 
+TEST_F(SolverLinearStorageWithET, DiagnosticsCountTheClampedFluxes) {
+    SettingsBasin basinSettings;
+    basinSettings.AddHydroUnit(1, 100);
+
+    SubBasin subBasin;
+    EXPECT_TRUE(subBasin.Initialize(basinSettings));
+
+    ModelHydro model(&subBasin);
+    ASSERT_TRUE(model.Initialize(_model, basinSettings));
+
+    ASSERT_TRUE(model.AddTimeSeries(std::unique_ptr<TimeSeries>(std::move(_tsPrecip))));
+    ASSERT_TRUE(model.AddTimeSeries(std::unique_ptr<TimeSeries>(std::move(_tsPET))));
+    ASSERT_TRUE(model.AttachTimeSeriesToHydroUnits());
+
+    EXPECT_TRUE(model.Run());
+
+    // The storage exceeds its capacity, which is handled by the overflow.
+    EXPECT_GT(model.GetSolverDiagnostics().clampedFluxes, 0);
+}
+
 TEST_F(SolverLinearStorageWithET, UsingHeunExplicit) {
     SettingsBasin basinSettings;
     basinSettings.AddHydroUnit(1, 100);
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include "StationSpatialization.h"
+
+TEST(StationSpatialization, ConstantCopiesStationData) {
+    axd data(3);
+    data << 1.0, 2.0, 3.0;
+    axi months = axi::Constant(3, 1);
+    axd elevations(2);
+    elevations << 500, 2500;
+
+    axxd values = SpatializeStationData(data, months, elevations, "constant");
+
+    ASSERT_EQ(values.rows(), 3);
+    ASSERT_EQ(values.cols(), 2);
+    EXPECT_DOUBLE_EQ(values(2, 0), 3.0);
+    EXPECT_DOUBLE_EQ(values(2, 1), 3.0);
+}
+
+TEST(StationSpatialization, AdditiveGradientWithMonthlyValues) {
+    axd data(2);
+    data << 10.0, 10.0;
+    axi months(2);
+    months << 1, 7;
+    axd elevations(2);
+    elevations << 1000, 2000;
+    axd gradients = axd::Constant(12, -0.6);
+    gradients[6] = -0.5;
+
+    axxd values = SpatializeStationData(data, months, elevations, "additive_elevation_gradient", 1000, gradients);
+
+    EXPECT_DOUBLE_EQ(values(0, 0), 10.0);
+    EXPECT_DOUBLE_EQ(values(0, 1), 4.0);
+    EXPECT_DOUBLE_EQ(values(1, 1), 5.0);
+}
+
+TEST(StationSpatialization, MultiplicativeGradientClipsNegativeValues) {
+    axd data(1);
+    data << 10.0;
+    axi months = axi::Constant(1, 3);
+    axd elevations(2);
+    elevations << 2000, 0;
+    axd gradients = axd::Constant(1, 0.1);
+
+    axxd values =
+        SpatializeStationData(data, months, elevations, "multiplicative_elevation_gradient", 1000, gradients, axd(), 0,
+                              true);
+
+    EXPECT_DOUBLE_EQ(values(0, 0), 20.0);
+    EXPECT_DOUBLE_EQ(values(0, 1), 0.0);
+}
+
+TEST(StationSpatialization, MultiplicativeThresholdGradients) {
+    axd data(1);
+    data << 10.0;
+    axi months = axi::Constant(1, 5);
+    axd elevations(2);
+    elevations << 1500, 3000;
+    axd gradients = axd::Constant(1, 0.1);
+    axd gradients2 = axd::Constant(1, 0.0);
+
+    axxd values = SpatializeStationData(data, months, elevations, "multiplicative_elevation_threshold_gradients", 1000,
+                                        gradients, gradients2, 2000);
+
+    EXPECT_DOUBLE_EQ(values(0, 0), 15.0);
+    EXPECT_DOUBLE_EQ(values(0, 1), 20.0);
+}
+
+TEST(StationSpatialization, MultithreadedMatchesSingleThreaded) {
+    int timeSize = 5000;
+    axd data = axd::LinSpaced(timeSize, -5, 20);
+    axi months(timeSize);
+    for (int t = 0; t < timeSize; ++t) {
+        months[t] = 1 + t % 12;
+    }
+    axd elevations = axd::LinSpaced(50, 400, 3800);
+    axd gradients = axd::LinSpaced(12, -0.7, -0.4);
+
+    axxd single = SpatializeStationData(data, months, elevations, "additive_elevation_gradient", 1200, gradients,
+                                        axd(), 0, false, 1);
+    axxd multi = SpatializeStationData(data, months, elevations, "additive_elevation_gradient", 1200, gradients,
+                                       axd(), 0, false, 4);
+
+    EXPECT_TRUE(single.isApprox(multi));
+}
+
+TEST(StationSpatialization, WrongGradientLengthThrows) {
+    axd data = axd::Ones(2);
+    axi months = axi::Ones(2);
+    axd elevations = axd::Ones(2);
+    axd gradients = axd::Ones(3);
+
+    EXPECT_THROW(SpatializeStationData(data, months, elevations, "additive_elevation_gradient", 0, gradients),
+                 InputError);
+}
+
+TEST(StationSpatialization, UnknownMethodThrows) {
+    axd data = axd::Ones(2);
+    axi months = axi::Ones(2);
+    axd elevations = axd::Ones(2);
+
+    EXPECT_THROW(SpatializeStationData(data, months, elevations, "kriging"), InputError);
+}
@@ -51,3 +51,40 @@ TEST(TimeMachine, IsOver) {
 
     EXPECT_TRUE(timer.IsOver());
 }
+
+TEST(TimeMachine, CalendarMatchesTheDates) {
+    TimeMachine timer;
+    timer.Initialize(GetMJD(2019, 12, 30), GetMJD(2020, 3, 2), 1, TimeUnit::Hour);
+
+    Time previous = GetTimeStructFromMJD(timer.GetDate());
+    for (int step = 0; !timer.IsOver(); ++step) {
+        ASSERT_EQ(timer.GetCurrentStep(), step);
+        Time date = GetTimeStructFromMJD(timer.GetDate());
+        const CalendarStep& calendar = timer.GetCalendar();
+        EXPECT_EQ(calendar.year, date.year);
+        EXPECT_EQ(calendar.month, date.month);
+        EXPECT_EQ(calendar.day, date.day);
+        EXPECT_EQ(calendar.hour, date.hour);
+        EXPECT_EQ(calendar.newYear, step == 0 || date.year != previous.year);
+        EXPECT_EQ(calendar.newMonth, step == 0 || date.month != previous.month);
+        previous = date;
+        timer.IncrementTime();
+    }
+
+    timer.Reset();
+    EXPECT_EQ(timer.GetCurrentStep(), 0);
+}
+
+TEST(TimeMachine, CalendarGivesTheDayOfYear) {
+    TimeMachine timer;
+    timer.Initialize(GetMJD(2020, 2, 28), GetMJD(2020, 3, 2), 1, TimeUnit::Day);
+
+    EXPECT_EQ(timer.GetCurrentDayOfYear(), 59);
+    timer.IncrementTime();
+    EXPECT_EQ(timer.GetCurrentDayOfYear(), 60);
+    timer.IncrementTime();
+    EXPECT_EQ(timer.GetCurrentDayOfYear(), 61);
+    EXPECT_EQ(timer.GetCalendar().month, 3);
+    EXPECT_TRUE(timer.GetCalendar().newMonth);
+    EXPECT_FALSE(timer.GetCalendar().newYear);
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include "Tracer.h"
+
+namespace {
+
+string ReadFile(const std::filesystem::path& path) {
+    std::ifstream file(path);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+int CountOccurrences(const string& text, const string& pattern) {
+    int count = 0;
+    for (size_t pos = text.find(pattern); pos != string::npos; pos = text.find(pattern, pos + 1)) {
+        count++;
+    }
+    return count;
+}
+
+}  // namespace
+
+TEST(Tracer, SpansAreWrittenAsChromeTraceEvents) {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "hydrobricks_trace.json";
+    {
+        TraceSpan inactive("test", "not_traced");
+    }
+
+    Tracer::Start(path.string(), 10);
+    EXPECT_TRUE(Tracer::IsActive());
+    std::filesystem::path tracePath(Tracer::GetPath());
+    EXPECT_EQ(tracePath.parent_path(), path.parent_path());
+    EXPECT_EQ(tracePath.extension(), ".json");
+    ASSERT_TRUE(tracePath.stem().string().starts_with("hydrobricks_trace."));
+    string pid = tracePath.stem().extension().string().substr(1);
+    EXPECT_EQ(Tracer::GetStepsPerSpan(), 10);
+    {
+        TraceSpan span("test", "main_thread");
+    }
+    std::thread worker([] { TraceSpan span("test", "worker_thread"); });
+    worker.join();
+    {
+        TraceStepsSpan steps("loop");
+        for (int step = 0; step < 25; ++step) {
+            steps.Step(step);
+        }
+    }
+    ASSERT_TRUE(Tracer::Stop());
+    EXPECT_FALSE(Tracer::IsActive());
+
+    EXPECT_FALSE(std::filesystem::exists(path));
+    string trace = ReadFile(tracePath);
+    EXPECT_TRUE(trace.starts_with("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+    EXPECT_EQ(trace.find("not_traced"), string::npos);
+    EXPECT_NE(trace.find(R"("name":"main_thread","cat":"test","ph":"X")"), string::npos);
+    EXPECT_NE(trace.find("\"name\":\"worker_thread\""), string::npos);
+    EXPECT_EQ(CountOccurrences(trace, "\"name\":\"thread_name\""), 2);
+    EXPECT_EQ(CountOccurrences(trace, "\"name\":\"loop (steps "), 3);
+    EXPECT_NE(trace.find(std::format("\"pid\":{},\"tid\":1", pid)), string::npos);
+
+    std::filesystem::remove(tracePath);
+}
+
+TEST(Tracer, SpanNamesAreEscaped) {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "hydrobricks_trace_escaped.json";
+
+    Tracer::Start(path.string());
+    {
+        TraceSpan span("test", "line\nbreak\ttab \"quoted\" back\\slash \x01");
+    }
+    ASSERT_TRUE(Tracer::Stop());
+
+    string trace = ReadFile(Tracer::GetPath());
+    EXPECT_NE(trace.find(R"("name":"line\nbreak\ttab \"quoted\" back\\slash \u0001")"), string::npos);
+    EXPECT_EQ(trace.find('\t'), string::npos);
+    EXPECT_EQ(trace.find('\x01'), string::npos);
+
+    std::filesystem::remove(Tracer::GetPath());
+}
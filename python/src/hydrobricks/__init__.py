@@ -39,6 +39,7 @@ from hydrobricks._optional import (  # Availability flags; Lazy-loaded modules
     xr,
     xrs,
 )
+from hydrobricks.basin_network import BasinNetwork
 from hydrobricks.catchment import Catchment
 from hydrobricks.evaluation import (
     AuxiliaryObservation,
@@ -60,11 +61,14 @@ from hydrobricks.time_series import TimeSeries
 
 from ._hydrobricks import (
     close_log,
+    get_tracing_path,
     init,
     init_log,
     set_debug_log_level,
     set_max_log_level,
     set_message_log_level,
+    start_tracing,
+    stop_tracing,
 )
 
 init()
@@ -81,6 +85,7 @@ __all__ = (
     "Catchment",
     "Results",
     "Model",
+    "BasinNetwork",
     "Plotter",
     "StructureGraph",
     "Period",
@@ -97,6 +102,10 @@ __all__ = (
     "set_debug_log_level",
     "set_max_log_level",
     "set_message_log_level",
+    # Tracing functions
+    "get_tracing_path",
+    "start_tracing",
+    "stop_tracing",
     # Optional dependency flags
     "HAS_NETCDF",
     "HAS_RASTERIO",
@@ -0,0 +1,130 @@
+from __future__ import annotations
+
+import logging
+from typing import TYPE_CHECKING
+
+from hydrobricks._exceptions import ConfigurationError, ModelError
+from hydrobricks._hydrobricks import BasinNetwork as _BasinNetwork
+
+if TYPE_CHECKING:
+    from hydrobricks.forcing import Forcing
+    from hydrobricks.models.model import Model
+    from hydrobricks.parameters import ParameterSet
+
+logger = logging.getLogger(__name__)
+
+
+class BasinNetwork:
+    """
+    Network of sub-basin models connected from upstream to downstream.
+
+    Every sub-basin is a set-up :class:`~hydrobricks.models.model.Model` with its own
+    hydro units, parameters and forcing, over the same period. The network runs the
+    sub-basins in topological order in the core engine: the outlet discharge of a
+    sub-basin is added to the outlet of its downstream sub-basin (converted to its
+    area and optionally routed along the channel reach), and independent branches
+    run concurrently.
+    """
+
+    def __init__(self) -> None:
+        self.network = _BasinNetwork()
+        self.sub_basins: list[Model] = []
+
+    def add_sub_basin(self, model: Model) -> int:
+        """
+        Add a sub-basin model to the network.
+
+        Parameters
+        ----------
+        model
+            The model of the sub-basin (already set up).
+
+        Returns
+        -------
+        The index of the sub-basin in the network.
+        """
+        index = self.network.add_model(model.model)
+        self.sub_basins.append(model)
+        return index
+
+    def connect(
+        self,
+        upstream: int,
+        downstream: int,
+        routing: str | None = None,
+        routing_parameters: dict[str, float] | None = None,
+    ) -> None:
+        """
+        Connect the outlet of a sub-basin to a downstream sub-basin.
+
+        Parameters
+        ----------
+        upstream
+            The index of the upstream sub-basin.
+        downstream
+            The index of the downstream sub-basin.
+        routing
+            Optional routing along the channel reach: 'lag_and_route' (parameters
+            'lag' [d] and 'storage_constant' [d]), 'linear_reservoir_cascade'
+            ('reservoirs_nb' and 'storage_constant' [d]) or 'muskingum_cunge'
+            ('length' [m], 'celerity' [m/s] and 'diffusivity' [m2/s]).
+        routing_parameters
+            The parameters of the reach routing.
+        """
+        try:
+            self.network.connect(upstream, downstream)
+            if routing is not None:
+                self.network.set_routing(upstream, routing, routing_parameters or {})
+        except (RuntimeError, ValueError) as e:
+            raise ConfigurationError(f"Invalid sub-basin connection: {e}") from e
+
+    def run(
+        self,
+        parameters: list[ParameterSet],
+        forcings: list[Forcing | None] | None = None,
+        threads: int = 0,
+    ) -> None:
+        """
+        Run all sub-basins of the network.
+
+        Parameters
+        ----------
+        parameters
+            The parameters of every sub-basin (in the order they were added).
+        forcings
+            The forcing of every sub-basin (in the order they were added).
+        threads
+            The number of threads to use (0: use the hardware concurrency).
+        """
+        if forcings is None:
+            forcings = [None] * len(self.sub_basins)
+        if len(parameters) != len(self.sub_basins) or len(forcings) != len(
+            self.sub_basins
+        ):
+            raise ConfigurationError(
+                "One parameter set and one forcing must be given per sub-basin."
+            )
+
+        for model, params, forcing in zip(self.sub_basins, parameters, forcings):
+            model.prepare_run(params, forcing)
+
+        try:
+            self.network.run(threads)
+        except ValueError as e:
+            logger.error(f"Basin network run failed: {e}")
+            raise ModelError(f"Basin network run failed: {e}") from e
+
+    def get_outlet_discharge(self, index: int):
+        """
+        Get the outlet discharge of a sub-basin, including its upstream inflow.
+
+        Parameters
+        ----------
+        index
+            The index of the sub-basin.
+
+        Returns
+        -------
+        The outlet discharge [mm] (relative to the sub-basin area).
+        """
+        return self.sub_basins[index].get_outlet_discharge()
@@ -5,6 +5,8 @@ from typing import TYPE_CHECKING
 
 import numpy as np
 
+from hydrobricks._exceptions import ConfigurationError
+
 if TYPE_CHECKING:
     import pandas as pd
 
@@ -116,6 +118,23 @@ class AuxiliaryObservation:
         """
         return RecordingRequest()
 
+    @staticmethod
+    def check_daily_recording(model: Model) -> None:
+        """Refuse a model recording its hydro unit values over longer periods.
+
+        The simulated values are computed from the daily recorded series, which are
+        not available when the hydro unit values are aggregated over months or years
+        (``ModelSettings.set_hydro_unit_log_period``).
+        """
+        if not model.is_recorded_daily():
+            raise ConfigurationError(
+                "The hydro unit values are aggregated over recording periods; the "
+                "auxiliary observations need them at every time step.",
+                item_name="hydro_unit_log_period",
+                item_value=model.settings.hydro_unit_log_period,
+                reason="Aggregated recording",
+            )
+
     def configure_recording(self, model: Model) -> None:
         """Enable, on ``model``, the recordings this signal needs.
 
@@ -454,6 +454,7 @@ class GlacierMassBalanceObservations(AuxiliaryObservation):
                 reason="No glacier cover",
             )
 
+        self.check_daily_recording(model)
         time = model.get_recorded_time()  # DatetimeIndex (n_time)
 
         # Sum the snowpack SWE and ice melt over all glacier covers (n_units, n_time).
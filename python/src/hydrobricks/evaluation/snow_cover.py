@@ -45,6 +45,7 @@ import numpy as np
 import pandas as pd
 
 from hydrobricks._exceptions import ConfigurationError, DataError, DependencyError
+from hydrobricks._hydrobricks import aggregate_snow_cover
 from hydrobricks._optional import (
     HAS_NETCDF,
     HAS_RASTERIO,
@@ -60,6 +61,9 @@ if TYPE_CHECKING:
 
 logger = logging.getLogger(__name__)
 
+# Number of reprojected MODIS dates aggregated per native call.
+_MODIS_BATCH_SIZE = 64
+
 
 def _swe_to_fraction(swe: np.ndarray, swe_full: float) -> np.ndarray:
     """Map SWE [mm w.e.] to a snow-cover fraction via a linear depletion curve.
@@ -857,6 +861,7 @@ class SnowCoverObservations(AuxiliaryObservation):
         if not self.targets:
             return np.array([], dtype=float)
 
+        self.check_daily_recording(model)
         covers = self.land_covers or list(model.land_cover_names)
         recorded = set(model.get_recorded_labels())
         time = model.get_recorded_time()  # DatetimeIndex (n_time)
@@ -1088,6 +1093,44 @@ def _date_index(time: pd.DatetimeIndex, date: pd.Timestamp) -> int | None:
     return pos if pos >= 0 else None
 
 
+def _unit_ids(
+    unit_arr: np.ndarray, units_nodata: float | None, hydro_units: Any | None
+) -> list[int]:
+    """Ids of the units to aggregate to (from ``hydro_units`` or from the raster)."""
+    if hydro_units is not None:
+        return np.asarray(hydro_units["id"]).squeeze().astype(int).ravel().tolist()
+    return [
+        int(u)
+        for u in np.unique(unit_arr)
+        if np.isfinite(u) and u > 0 and (units_nodata is None or u != units_nodata)
+    ]
+
+
+def _unit_map(unit_arr: np.ndarray, units_nodata: float | None) -> np.ndarray:
+    """Integer unit-id map (0 outside the units) for the native aggregation."""
+    outside = ~np.isfinite(unit_arr)
+    if units_nodata is not None:
+        outside |= unit_arr == units_nodata
+    return np.where(outside, 0, unit_arr).astype(np.int32)
+
+
+def _filter_kwargs(
+    nodata: float | None,
+    valid_min: float | None,
+    valid_max: float | None,
+    min_valid_ratio: float,
+    value_scale: float,
+) -> dict[str, float]:
+    """Pixel filtering options of the native aggregation (NaN: option not set)."""
+    return {
+        "nodata": np.nan if nodata is None else float(nodata),
+        "valid_min": np.nan if valid_min is None else float(valid_min),
+        "valid_max": np.nan if valid_max is None else float(valid_max),
+        "value_scale": float(value_scale),
+        "min_valid_ratio": float(min_valid_ratio),
+    }
+
+
 def _aggregate_stack(
     vals: np.ndarray,
     times: np.ndarray,
@@ -1107,38 +1150,13 @@ def _aggregate_stack(
     a valid-pixel ratio below ``min_valid_ratio`` is left NaN. ``unit_arr`` must share
     the spatial grid of ``vals``.
     """
-    if hydro_units is not None:
-        ids = np.asarray(hydro_units["id"]).squeeze().astype(int).ravel().tolist()
-    else:
-        ids = [
-            int(u)
-            for u in np.unique(unit_arr)
-            if np.isfinite(u) and u > 0 and (units_nodata is None or u != units_nodata)
-        ]
-
-    n_time = vals.shape[0]
-    matrix = np.full((n_time, len(ids)), np.nan, dtype=float)
-    for j, uid in enumerate(ids):
-        mask = unit_arr == uid
-        n_pix = int(mask.sum())
-        if n_pix == 0:
-            continue
-        sub = vals[:, mask]  # (n_time, n_pix_unit)
-        valid = np.isfinite(sub)
-        if nodata is not None:
-            valid &= sub != nodata
-        if valid_min is not None:
-            valid &= sub >= valid_min
-        if valid_max is not None:
-            valid &= sub <= valid_max
-        sub = np.where(valid, sub, np.nan)
-        count = valid.sum(axis=1)
-        with warnings.catch_warnings():
-            warnings.simplefilter("ignore", category=RuntimeWarning)
-            mean = np.nanmean(sub, axis=1)
-        frac_valid = count / n_pix
-        keep = (count > 0) & (frac_valid >= min_valid_ratio)
-        matrix[:, j] = np.where(keep, mean * value_scale, np.nan)
+    ids = _unit_ids(unit_arr, units_nodata, hydro_units)
+    matrix, _ = aggregate_snow_cover(
+        np.ascontiguousarray(vals.reshape(vals.shape[0], -1), dtype=float),
+        _unit_map(unit_arr, units_nodata),
+        ids,
+        **_filter_kwargs(nodata, valid_min, valid_max, min_valid_ratio, value_scale),
+    )
 
     return times, np.array(ids, dtype=int), matrix
 
@@ -1329,53 +1347,33 @@ def _aggregate_modis(
             np.empty((0, 0)),
         )
 
-    # Hydro-unit ids and a per-pixel unit index, computed once.
-    if hydro_units is not None:
-        ids = np.asarray(hydro_units["id"]).squeeze().astype(int).ravel().tolist()
-    else:
-        ids = [
-            int(u)
-            for u in np.unique(unit_arr)
-            if np.isfinite(u) and u > 0 and (units_nodata is None or u != units_nodata)
-        ]
-    n_ids = len(ids)
-    flat_units = unit_arr.ravel()
-    label = np.full(flat_units.shape, -1, dtype=np.int64)
-    for j, uid in enumerate(ids):
-        label[flat_units == uid] = j
-    in_unit = label >= 0
-    n_pix_per_unit = np.bincount(label[in_unit], minlength=n_ids).astype(float)
+    # Hydro-unit ids and the unit map, computed once.
+    ids = _unit_ids(unit_arr, units_nodata, hydro_units)
+    unit_map = _unit_map(unit_arr, units_nodata)
+    filter_kwargs = _filter_kwargs(
+        nodata, valid_min, valid_max, min_valid_ratio, value_scale
+    )
 
+    # The reprojected grids are aggregated by batches of dates in a single native
+    # (multithreaded) pass, which bounds the memory to one batch of grids.
     resampling_enum = getattr(Resampling, resampling)
     logger.info("Reading %d MODIS date(s) from %s", len(times), path)
-    matrix = np.full((len(times), n_ids), np.nan, dtype=float)
-    for i, d in enumerate(times):
-        tiles = [_read_hdf_eos_grid(f, variable, engine) for f in by_date[d]]
-        grid = tiles[0] if len(tiles) == 1 else merge_arrays(tiles, nodata=np.nan)
-        with warnings.catch_warnings():
-            warnings.filterwarnings("ignore", category=UserWarning)  # pyproj
-            grid = grid.rio.reproject_match(
-                unit_da, resampling=resampling_enum, nodata=np.nan
-            )
-        flat = np.asarray(grid.values, dtype=float).ravel()
-
-        valid = np.isfinite(flat)
-        if nodata is not None:
-            valid &= flat != nodata
-        if valid_min is not None:
-            valid &= flat >= valid_min
-        if valid_max is not None:
-            valid &= flat <= valid_max
-        valid &= in_unit
+    matrix = np.full((len(times), len(ids)), np.nan, dtype=float)
+    batch = np.empty((min(_MODIS_BATCH_SIZE, len(times)), unit_map.size))
+    for start in range(0, len(times), _MODIS_BATCH_SIZE):
+        dates = times[start : start + _MODIS_BATCH_SIZE]
+        for k, d in enumerate(dates):
+            tiles = [_read_hdf_eos_grid(f, variable, engine) for f in by_date[d]]
+            grid = tiles[0] if len(tiles) == 1 else merge_arrays(tiles, nodata=np.nan)
+            with warnings.catch_warnings():
+                warnings.filterwarnings("ignore", category=UserWarning)  # pyproj
+                grid = grid.rio.reproject_match(
+                    unit_da, resampling=resampling_enum, nodata=np.nan
+                )
+            batch[k] = np.asarray(grid.values, dtype=float).ravel()
 
-        lab = label[valid]
-        sums = np.bincount(lab, weights=flat[valid], minlength=n_ids)
-        cnts = np.bincount(lab, minlength=n_ids).astype(float)
-        safe_pix = np.where(n_pix_per_unit > 0, n_pix_per_unit, 1.0)
-        with np.errstate(invalid="ignore", divide="ignore"):
-            mean = np.where(cnts > 0, sums / np.where(cnts > 0, cnts, 1.0), np.nan)
-            frac_valid = np.where(n_pix_per_unit > 0, cnts / safe_pix, 0.0)
-        keep = (cnts > 0) & (frac_valid >= min_valid_ratio)
-        matrix[i] = np.where(keep, mean * value_scale, np.nan)
+        matrix[start : start + len(dates)], _ = aggregate_snow_cover(
+            batch[: len(dates)], unit_map, ids, **filter_kwargs
+        )
 
     return np.array(times), np.array(ids, dtype=int), matrix
@@ -16,6 +16,7 @@ from hydrobricks._exceptions import (
     DependencyError,
     ForcingError,
 )
+from hydrobricks._hydrobricks import spatialize_station_data
 from hydrobricks._optional import HAS_NETCDF, HAS_PYET, Dataset, StrEnumClass, pyet
 from hydrobricks.parameters import ParameterSet
 from hydrobricks.time_series import TimeSeries1D, TimeSeries2D
@@ -587,6 +588,10 @@ class Forcing:
         The operation is stored and applied later (deferred execution). The ``method``
         is validated immediately.
 
+        The Hamon, Oudin, Hargreaves and Priestley-Taylor methods can alternatively be
+        computed within the model at run time (``pet_method`` model option), which
+        avoids storing a PET series for every hydro unit.
+
         Parameters
         ----------
         method
@@ -1012,7 +1017,6 @@ class Forcing:
             )
 
         variable = self.get_variable_enum(variable)
-        unit_values = np.zeros((len(self.data1D.time), len(self.hydro_units)))
         hydro_units = self.hydro_units.reset_index()
         idx_1d = self.data1D.data_name.index(variable)
         data_raw = self.data1D.data[idx_1d].copy()
@@ -1040,112 +1044,54 @@ class Forcing:
         if gradient is None:
             gradient = kwargs.get("gradient_1", None)
 
-        if isinstance(gradient, list):
-            if len(gradient) not in [1, 12]:
+        # Check method and parameters
+        known_methods = [
+            "constant",
+            "additive_elevation_gradient",
+            "multiplicative_elevation_gradient",
+            "multiplicative_elevation_threshold_gradients",
+        ]
+        if method not in known_methods:
+            raise ForcingError(
+                f"Unknown method: {method}", variable=str(variable), method=method
+            )
+
+        gradients = np.zeros(1)
+        gradients_2 = np.zeros(1)
+        elevation_threshold = 0.0
+        if method != "constant":
+            if ref_elevation is None:
                 raise ConfigurationError(
-                    f"The gradient should have a length of 1 or 12. "
-                    f"Here: {len(gradient)}",
-                    item_name="gradient",
-                    item_value=len(gradient),
-                    reason="Invalid length",
+                    "Reference elevation not provided.",
+                    item_name="ref_elevation",
+                    reason="Missing required parameter",
                 )
+            gradients = self._get_gradient_values(gradient, "gradient")
 
-        # Apply methods
-        for i_unit, (_, unit) in enumerate(hydro_units.iterrows()):
-
-            elevation = unit["elevation"].values
-
-            if method == "constant":
-                unit_values[:, i_unit] = data_raw
-
-            elif method == "additive_elevation_gradient":
-                if ref_elevation is None:
-                    raise ConfigurationError(
-                        "Reference elevation not provided.",
-                        item_name="ref_elevation",
-                        reason="Missing required parameter",
-                    )
-                if (
-                    isinstance(gradient, float)
-                    or isinstance(gradient, list)
-                    and len(gradient) == 1
-                ):
-                    unit_values[:, i_unit] = (
-                        data_raw + gradient * (elevation - ref_elevation) / 100
-                    )
-                elif isinstance(gradient, list) and len(gradient) == 12:
-                    for m in range(12):
-                        month = self.data1D.time.dt.month == m + 1
-                        month = month.to_numpy()
-                        unit_values[month, i_unit] = (
-                            data_raw[month]
-                            + gradient[m] * (elevation - ref_elevation) / 100
-                        )
-                else:
-                    raise ConfigurationError(
-                        f"Wrong gradient format: {gradient}",
-                        item_name="gradient",
-                        item_value=gradient,
-                        reason="Invalid format",
-                    )
-
-            elif method == "multiplicative_elevation_gradient":
-                if ref_elevation is None:
-                    raise ConfigurationError(
-                        "Reference elevation not provided.",
-                        item_name="ref_elevation",
-                        reason="Missing required parameter",
-                    )
-                if (
-                    isinstance(gradient, float)
-                    or isinstance(gradient, list)
-                    and len(gradient) == 1
-                ):
-                    unit_values[:, i_unit] = data_raw * (
-                        1 + gradient * (elevation - ref_elevation) / 100
-                    )
-                elif isinstance(gradient, list) and len(gradient) == 12:
-                    for m in range(12):
-                        month = self.data1D.time.dt.month == m + 1
-                        month = month.to_numpy()
-                        unit_values[month, i_unit] = data_raw[month] * (
-                            1 + gradient[m] * (elevation - ref_elevation) / 100
-                        )
-                else:
-                    raise ConfigurationError(
-                        f"Wrong gradient format: {gradient}",
-                        item_name="gradient",
-                        item_value=gradient,
-                        reason="Invalid format",
-                    )
-
-            elif method == "multiplicative_elevation_threshold_gradients":
-                gradient_2 = kwargs.get("gradient_2", None)
-                elevation_threshold = kwargs.get("elevation_threshold", None)
-                if elevation < elevation_threshold:
-                    unit_values[:, i_unit] = data_raw * (
-                        1 + gradient * (elevation - ref_elevation) / 100
-                    )
-                elif ref_elevation > elevation_threshold:
-                    unit_values[:, i_unit] = data_raw * (
-                        1 + gradient_2 * (elevation - ref_elevation) / 100
-                    )
-                else:
-                    precip_below = data_raw * (
-                        1 + gradient * (elevation_threshold - ref_elevation) / 100
-                    )
-                    unit_values[:, i_unit] = precip_below * (
-                        1 + gradient_2 * (elevation - elevation_threshold) / 100
-                    )
-
-            else:
-                raise ForcingError(
-                    f"Unknown method: {method}", variable=str(variable), method=method
+        if method == "multiplicative_elevation_threshold_gradients":
+            gradients_2 = self._get_gradient_values(
+                kwargs.get("gradient_2", None), "gradient_2"
+            )
+            elevation_threshold = kwargs.get("elevation_threshold", None)
+            if elevation_threshold is None:
+                raise ConfigurationError(
+                    "Elevation threshold not provided.",
+                    item_name="elevation_threshold",
+                    reason="Missing required parameter",
                 )
 
-        # Check outputs
-        if not self._can_be_negative(variable):
-            unit_values[unit_values < 0] = 0
+        # Apply methods (vectorized over the units and multithreaded over time)
+        unit_values = spatialize_station_data(
+            data=np.asarray(data_raw, dtype=np.float64),
+            months=self.data1D.time.dt.month.to_numpy().astype(np.int32),
+            elevations=hydro_units["elevation"].to_numpy(dtype=np.float64).ravel(),
+            method=method,
+            ref_elevation=float(ref_elevation) if ref_elevation is not None else 0.0,
+            gradients=gradients,
+            gradients_2=gradients_2,
+            elevation_threshold=float(elevation_threshold),
+            clip_negative=not self._can_be_negative(variable),
+        )
 
         # Store outputs
         if variable in self.data2D.data_name:
@@ -1156,6 +1102,49 @@ class Forcing:
             self.data2D.data_name.append(variable)
             self.data2D.time = self.data1D.time
 
+    @staticmethod
+    def _get_gradient_values(gradient: Any, name: str) -> np.ndarray:
+        """
+        Convert elevation gradient(s) to an array of 1 or 12 (monthly) values.
+
+        Parameters
+        ----------
+        gradient
+            The gradient as a number or a list of 1 or 12 values.
+        name
+            Name of the option (for error messages).
+
+        Returns
+        -------
+        np.ndarray
+            The gradient values as a float array.
+        """
+        if gradient is None or isinstance(gradient, (str, bool)):
+            raise ConfigurationError(
+                f"Wrong gradient format: {gradient}",
+                item_name=name,
+                item_value=gradient,
+                reason="Invalid format",
+            )
+        try:
+            values = np.atleast_1d(np.asarray(gradient, dtype=np.float64)).ravel()
+        except (TypeError, ValueError) as e:
+            raise ConfigurationError(
+                f"Wrong gradient format: {gradient}",
+                item_name=name,
+                item_value=gradient,
+                reason="Invalid format",
+            ) from e
+        if len(values) not in [1, 12]:
+            raise ConfigurationError(
+                f"The {name} should have a length of 1 or 12. Here: {len(values)}",
+                item_name=name,
+                item_value=len(values),
+                reason="Invalid length",
+            )
+
+        return values
+
     def _apply_spatialization_from_gridded_data(
         self, variable: str, method: str = "default", **kwargs: Any
     ) -> None:
@@ -52,7 +52,8 @@ class Model(ABC):
             Name identifier for the model instance. Default: None
         **kwargs
             Additional keyword arguments for model configuration.
-            Allowed keys: 'solver', 'record_all', 'land_cover_types', 'land_cover_names'
+            Allowed keys: 'solver', 'record_all', 'land_cover_types',
+            'land_cover_names', 'pet_method'
 
         Raises
         ------
@@ -72,6 +73,7 @@ class Model(ABC):
             "record_all",
             "land_cover_types",
             "land_cover_names",
+            "pet_method",
         }
         self._is_initialized: bool = False
 
@@ -79,6 +81,7 @@ class Model(ABC):
         self.options: dict[str, Any] = dict()
         self.solver: str = "crank_nicolson"
         self.record_all: bool = False
+        self.pet_method: str | None = None
         self.land_cover_types: list[str] = ["open"]
         self.land_cover_names: list[str] = ["open"]
         self.allowed_land_cover_types: list[str] = ["open"]
@@ -100,6 +103,8 @@ class Model(ABC):
         self.settings: ModelSettings = ModelSettings(
             solver=self.solver, record_all=self.record_all
         )
+        if self.pet_method is not None:
+            self.settings.set_pet_method(self.pet_method)
 
     def __del__(self) -> None:
         """Clean up resources when model is deleted."""
@@ -280,35 +285,8 @@ class Model(ABC):
         """
         logger.debug(f"Running model: {self.name}")
 
-        if not self._is_initialized:
-            raise ModelError(
-                "The model has not been initialized. Please run setup() first.",
-                is_initialized=False,
-            )
-
-        if not parameters.is_valid():
-            undefined = parameters.get_undefined()
-            logger.debug(f"Invalid parameters: {undefined}")
-            raise ConfigurationError(
-                f"Some parameters were not defined: " f'{",".join(undefined)}.'
-            )
-
         try:
-            logger.debug("Resetting model state")
-            self.model.reset()
-
-            if forcing is not None and not forcing.is_initialized():
-                logger.debug("Applying forcing operations")
-                forcing.apply_operations(parameters)
-
-            logger.debug("Setting parameter values")
-            self._set_parameter_values(parameters)
-
-            logger.debug("Setting forcing data")
-            self._set_forcing(forcing)
-
-            if not self.model.is_valid():
-                raise ConfigurationError("The model is not properly configured.")
+            self.prepare_run(parameters, forcing)
 
             logger.debug("Starting model simulation")
             timer = Timer(text="Model simulation completed in {seconds:.2f} seconds")
@@ -331,6 +309,52 @@ class Model(ABC):
             logger.error(f"Model run failed: {e}", exc_info=True)
             raise ModelError(f"Model run failed: {e}") from e
 
+    def prepare_run(
+        self, parameters: ParameterSet, forcing: Forcing | None = None
+    ) -> None:
+        """
+        Reset the model and set the parameters and forcing of the next run, without
+        running it (e.g. for a sub-basin of a BasinNetwork).
+
+        Parameters
+        ----------
+        parameters
+            The parameters for the given model.
+        forcing
+            The forcing data.
+        """
+        self._check_ready_to_run(parameters)
+
+        logger.debug("Resetting model state")
+        self.model.reset()
+
+        if forcing is not None and not forcing.is_initialized():
+            logger.debug("Applying forcing operations")
+            forcing.apply_operations(parameters)
+
+        logger.debug("Setting parameter values")
+        self._set_parameter_values(parameters)
+
+        logger.debug("Setting forcing data")
+        self._set_forcing(forcing)
+
+        if not self.model.is_valid():
+            raise ConfigurationError("The model is not properly configured.")
+
+    def _check_ready_to_run(self, parameters: ParameterSet) -> None:
+        if not self._is_initialized:
+            raise ModelError(
+                "The model has not been initialized. Please run setup() first.",
+                is_initialized=False,
+            )
+
+        if not parameters.is_valid():
+            undefined = parameters.get_undefined()
+            logger.debug(f"Invalid parameters: {undefined}")
+            raise ConfigurationError(
+                f"Some parameters were not defined: " f'{",".join(undefined)}.'
+            )
+
     @staticmethod
     def _cleanup() -> None:
         close_log()
@@ -456,15 +480,30 @@ class Model(ABC):
     def get_total_outlet_discharge(self) -> float:
         """
         Get the outlet discharge total.
+
+        In a basin network, the outlet includes the inflow from the upstream
+        sub-basins (see :meth:`get_total_inflow`).
         """
         return self.model.get_total_outlet_discharge()
 
+    def get_total_inflow(self) -> float:
+        """
+        Get the inflow total from the upstream sub-basins (in a basin network).
+        """
+        return self.model.get_total_inflow()
+
     def get_total_et(self) -> float:
         """
         Get the total amount of water lost by evapotranspiration.
         """
         return self.model.get_total_et()
 
+    def get_total_precipitation(self) -> float:
+        """
+        Get the total precipitation, area-weighted over the hydro units.
+        """
+        return self.model.get_total_precipitation()
+
     def get_total_water_storage_changes(self) -> float:
         """
         Get the total change in water storage.
@@ -477,6 +516,50 @@ class Model(ABC):
         """
         return self.model.get_total_snow_storage_changes()
 
+    def enable_profiling(self, enable: bool = True) -> None:
+        """
+        Enable or disable the profiling of the next runs.
+
+        The profiling instrumentation must be compiled in (build with
+        ``CMAKE_ARGS="-DUSE_PROFILING=ON"``), otherwise the report stays empty.
+
+        Parameters
+        ----------
+        enable
+            True to profile the runs.
+        """
+        self.model.enable_profiling(enable)
+
+    def get_profiling_report(self) -> pd.DataFrame:
+        """
+        Get the time spent in the profiled sections of the runs.
+
+        The times are cumulated over the profiled runs and timed inclusively (e.g.
+        the 'solver' stages include the 'process' sections they call).
+
+        Returns
+        -------
+        A table with the category ('process', 'brick', 'solver' or 'model'), the
+        name, the number of calls and the cumulative time [s] of each section, by
+        decreasing time.
+        """
+        return pd.DataFrame(self.model.get_profiling_report())
+
+    def get_solver_diagnostics(self) -> dict:
+        """
+        Get the counters of the work done by the solver over the last run (spin-up
+        included), e.g. to compare the cost of the solvers on a catchment.
+
+        Returns
+        -------
+        A dict with the number of brick rate evaluations ('rate_evaluations'), of
+        storage constraint sweeps ('constraint_sweeps'), of constraint enforcements
+        stopped by the sweeps limit ('sweep_limit_hits'), of bisection iterations of
+        the implicit solvers ('bisection_iterations') and of change rates clamped by
+        the storage constraints ('clamped_fluxes').
+        """
+        return self.model.get_solver_diagnostics()
+
     def dump_outputs(self, path: str | Path | None = None) -> str:
         """
         Write the model outputs to a netCDF file.
@@ -565,7 +648,8 @@ class Model(ABC):
         -------
         The recorded series as a 2D array of shape (n_hydro_units, n_timesteps),
         matching the convention of ``Results.get_hydro_units_values``. Values are
-        NaN for hydro units to which the component does not apply.
+        NaN for hydro units to which the component does not apply. The columns
+        follow :meth:`get_recorded_hydro_unit_time`.
         """
         # The engine stores the series as (time, units); transpose to the
         # (units, time) convention used by the Results reader.
@@ -586,7 +670,8 @@ class Model(ABC):
         Returns
         -------
         The fraction series as a 2D array of shape (n_hydro_units, n_timesteps),
-        matching the convention of ``Results.get_hydro_units_values``.
+        matching the convention of ``Results.get_hydro_units_values``. The columns
+        follow :meth:`get_recorded_hydro_unit_time`.
         """
         # The engine stores the series as (time, units); transpose to (units, time).
         return np.asarray(self.model.get_hydro_unit_fractions(label)).T
@@ -604,7 +689,9 @@ class Model(ABC):
         Reconstruct the daily date axis of the recorded series.
 
         The model runs on a daily time step, so the axis is rebuilt from the
-        modelling period rather than read from the engine.
+        modelling period rather than read from the engine. It is the axis of the
+        outlet discharge, and of the hydro unit series unless they are aggregated
+        over longer periods (see :meth:`get_recorded_hydro_unit_time`).
 
         Returns
         -------
@@ -617,6 +704,36 @@ class Model(ABC):
             )
         return pd.date_range(start=self.start_date, end=self.end_date, freq="D")
 
+    def get_recorded_hydro_unit_time(self) -> pd.DatetimeIndex:
+        """
+        Get the date axis of the recorded hydro unit series.
+
+        It is the daily axis of :meth:`get_recorded_time`, or the start of each
+        recording period when the hydro unit values are aggregated over months or
+        years (see ``ModelSettings.set_hydro_unit_log_period``).
+
+        Returns
+        -------
+        A ``DatetimeIndex`` matching the columns of the recorded hydro unit series.
+        """
+        if self.is_recorded_daily():
+            return self.get_recorded_time()
+        return pd.to_datetime(
+            np.asarray(self.model.get_hydro_unit_time()),
+            unit="D",
+            origin=pd.Timestamp("1858-11-17"),
+        )
+
+    def is_recorded_daily(self) -> bool:
+        """
+        Check if the hydro unit values are recorded at every (daily) time step.
+
+        Returns
+        -------
+        False if the hydro unit values are aggregated over months or years.
+        """
+        return self.settings.hydro_unit_log_period in ("step", "day")
+
     def eval(
         self,
         metric: str,
@@ -976,6 +1093,8 @@ class Model(ABC):
         Extracts and applies the following options if present:
         - 'solver': Numerical solver name
         - 'record_all': Whether to record all state/flux values
+        - 'pet_method': PET method computed within the model (instead of the
+          PET forcing)
         - 'land_cover_types': List of land cover types
         - 'land_cover_names': List of land cover names
 
@@ -988,6 +1107,8 @@ class Model(ABC):
             self.solver = kwargs["solver"]
         if "record_all" in kwargs:
             self.record_all = kwargs["record_all"]
+        if "pet_method" in kwargs:
+            self.pet_method = kwargs["pet_method"]
         if "land_cover_types" in kwargs:
             self.land_cover_types = kwargs["land_cover_types"]
         if "land_cover_names" in kwargs:
@@ -1,7 +1,7 @@
 from typing import Any
 
 from hydrobricks._exceptions import ConfigurationError
-from hydrobricks._hydrobricks import SettingsModel
+from hydrobricks._hydrobricks import ParameterModifier, SettingsModel
 
 
 class ModelSettings:
@@ -45,6 +45,7 @@ class ModelSettings:
         self.settings: SettingsModel = SettingsModel()
         self.settings.log_all(record_all)
         self.settings.set_solver(solver)
+        self.hydro_unit_log_period: str = "step"
 
     def set_solver(self, solver: str) -> None:
         """
@@ -97,6 +98,23 @@ class ModelSettings:
         """
         self.settings.set_spinup_days(int(days))
 
+    def set_pet_method(self, method: str) -> None:
+        """
+        Compute the PET within the model instead of reading it from the forcing.
+
+        The PET is then derived at every time step from the temperature (and,
+        depending on the method, the minimum/maximum temperature and the solar
+        radiation) forcings, and from the 'latitude' (and 'elevation') properties
+        of the hydro units.
+
+        Parameters
+        ----------
+        method
+            Name of the PET method: 'Hamon', 'Oudin', 'Hargreaves' or
+            'Priestley-Taylor'.
+        """
+        self.settings.set_pet_method(method)
+
     def set_parameter_value(self, component: str, name: str, value: float) -> bool:
         """
         Set a parameter value
@@ -116,6 +134,28 @@ class ModelSettings:
         """
         return self.settings.set_parameter_value(component, name, float(value))
 
+    def set_parameter_modifier(
+        self, component: str, name: str, modifier: ParameterModifier
+    ) -> bool:
+        """
+        Change the value of a parameter over time (yearly, monthly or at given
+        dates) during the run.
+
+        Parameters
+        ----------
+        component
+            Name of the component
+        name
+            Name of the parameter
+        modifier
+            Modifier holding the values of the parameter over time
+
+        Returns
+        -------
+        True if the parameter was found, False otherwise.
+        """
+        return self.settings.set_parameter_modifier(component, name, modifier)
+
     def get_structure(self) -> list:
         """
         Export the model structure (bricks, processes, fluxes, splitters).
@@ -425,6 +465,42 @@ class ModelSettings:
         """
         self.settings.record_fractions(record)
 
+    def set_hydro_unit_log_period(self, period: str) -> None:
+        """
+        Set the recording period of the hydro unit values.
+
+        The values of each period are aggregated in a single record (see
+        :meth:`set_log_aggregation`), which reduces the memory of distributed
+        outputs. The sub-basin values (e.g. the outlet discharge) stay at the time
+        step resolution. In the results file, the aggregated values are written
+        along a separate ``hydro_units_time`` dimension holding the start of each
+        period.
+
+        Parameters
+        ----------
+        period
+            Recording period: ``'step'`` (default), ``'day'``, ``'month'`` or
+            ``'year'``.
+        """
+        self.settings.set_hydro_unit_log_period(period)
+        self.hydro_unit_log_period = period
+
+    def set_log_aggregation(self, label: str, aggregation: str) -> None:
+        """
+        Set the aggregation of a logged hydro unit value over its recording period.
+
+        By default, the contents (labels ending with ``'_content'``) keep the last
+        value of the period and the other values are summed.
+
+        Parameters
+        ----------
+        label
+            The logged label (e.g. ``'glacier:ice_content'``).
+        aggregation
+            Aggregation: ``'sum'``, ``'mean'``, ``'last'``, ``'min'`` or ``'max'``.
+        """
+        self.settings.set_log_aggregation(label, aggregation)
+
     def record_brick_state(self, brick: str, item: str) -> None:
         """
         Record a state (e.g. a content) of a hydro-unit brick.
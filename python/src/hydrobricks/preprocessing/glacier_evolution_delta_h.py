@@ -8,6 +8,7 @@ import pandas as pd
 
 from hydrobricks._constants import ICE_WE
 from hydrobricks._exceptions import ConfigurationError, DataError, DependencyError
+from hydrobricks._hydrobricks import GlacierDeltaH as _GlacierDeltaH
 from hydrobricks._optional import HAS_PYPROJ, rasterio
 from hydrobricks.preprocessing.glacier_cover import (
     extract_glacier_mask_from_shapefile,
@@ -523,6 +524,12 @@ class GlacierEvolutionDeltaH:
             self.glacier_df[self.glacier_df[("glacier_area", "m2")] == 0].index
         )
 
+        if not self.pixel_based_approach:
+            self._compute_lookup_table_native(
+                nb_increments, observed_dh, update_width, update_width_reference
+            )
+            return
+
         # Extract the relevant columns
         elev_bands_parts = self.glacier_df[("elevation", "m")].values
         initial_areas_m2 = self.glacier_df[("glacier_area", "m2")].values
@@ -570,6 +577,45 @@ class GlacierEvolutionDeltaH:
         self._compute_sub_band_parts()
         self._update_lookup_tables()
 
+    def _compute_lookup_table_native(
+        self,
+        nb_increments: int,
+        observed_dh: pd.DataFrame | None,
+        update_width: bool,
+        update_width_reference: str,
+    ):
+        """
+        Compute the lookup tables of the band-based approach with the core engine.
+        """
+        if update_width_reference not in ("initial", "previous"):
+            raise ConfigurationError(
+                "update_width_reference should be either 'previous' or 'initial'.",
+                item_name="update_width_reference",
+                item_value=update_width_reference,
+                reason="Invalid parameter value",
+            )
+
+        delta_h = _GlacierDeltaH(
+            self.glacier_df[("elevation", "m")].values.astype(float),
+            self.glacier_df[("glacier_area", "m2")].values.astype(float),
+            self.glacier_df[("glacier_thickness", "m")].values.astype(float),
+            self.glacier_df[("hydro_unit_id", "-")].values.astype(np.int32),
+            float(self.catchment_area),
+        )
+        if observed_dh is not None:
+            delta_h.set_observed_delta_h(
+                observed_dh["normalized_elevation", "-"].values.astype(float),
+                observed_dh["dh", "-"].values.astype(float),
+            )
+        delta_h.compute(nb_increments, update_width, update_width_reference)
+
+        self.elev_bands_parts = delta_h.get_elevation_parts()
+        self.hydro_unit_ids = delta_h.get_hydro_unit_id_parts()
+        self.we_parts = delta_h.get_we_parts()
+        self.areas_pc_parts = delta_h.get_areas_parts()
+        self.lookup_table_area = delta_h.get_lookup_table_area()
+        self.lookup_table_volume = delta_h.get_lookup_table_volume()
+
     def get_lookup_table_area(self) -> pd.DataFrame:
         """
         Get the glacier area evolution lookup table.
@@ -27,6 +27,7 @@ from hydrobricks._exceptions import (
     DependencyError,
     ModelError,
 )
+from hydrobricks._hydrobricks import compute_daily_potential_radiation
 from hydrobricks._optional import HAS_RASTERIO, HAS_XARRAY, rasterio, rxr, xr
 
 logger = logging.getLogger(__name__)
@@ -62,6 +63,7 @@ class PotentialSolarRadiation:
         atmos_transmissivity: float = 0.75,
         steps_per_hour: int = 4,
         with_cast_shadows: bool = True,
+        azimuth_sectors: int = 72,
     ) -> None:
         """
         Compute the daily mean potential clear-sky direct solar radiation
@@ -85,10 +87,15 @@ class PotentialSolarRadiation:
             Number of steps per hour to compute the potential radiation, default is 4.
         with_cast_shadows
             If True, the cast shadows are taken into account. Default is True.
+        azimuth_sectors
+            Number of azimuth sectors for which the horizon angles are computed to
+            derive the cast shadows. Default is 72 (5° sectors).
 
         Notes
         -----
         This function is based on the R package TopoSol, authored by Matthew Olson.
+        The computation is performed in the C++ core: the horizon angles are computed
+        once per azimuth sector and the days are processed in parallel.
 
         References
         ----------
@@ -105,9 +112,13 @@ class PotentialSolarRadiation:
         n_rows = slope.shape[0]
         n_cols = slope.shape[1]
 
-        # Pre-compute index grids once to avoid repeated allocation and fragmentation
-        dem_data_shape = dem.read(1).shape
-        xv, yv = np.indices(dem_data_shape, dtype=np.int32)
+        if with_cast_shadows and abs(dem.res[0]) != abs(dem.res[1]):
+            raise DataError(
+                "The DEM x and y resolutions must be equal "
+                "for computing the cast shadows.",
+                data_type="DEM",
+                reason="Unequal x and y resolutions",
+            )
 
         # Create an array with the day of the year (Julian Day)
         day_of_year = np.arange(1, 367)
@@ -115,73 +126,25 @@ class PotentialSolarRadiation:
         # Get some catchment attributes
         mean_elevation = self.catchment.topography.get_mean_elevation()
         mean_lat, _ = self.catchment.extract_unit_mean_lat_lon(self.catchment.dem_data)
-        lat_rad = mean_lat * TO_RAD
-
-        # Compute the solar declination
-        solar_declin = self.get_solar_declination_rad(day_of_year)
-
-        # Compute the hour angle starting value
-        ha_limit = self.get_solar_hour_angle_limit(solar_declin, lat_rad)
-
-        # Time intervals (360°/24h = 15° per hour, divided by the # of steps / hour)
-        time_interval = (15 / steps_per_hour) * TO_RAD
-
-        # Create array for the daily potential radiation
-        daily_radiation = np.full((len(day_of_year), n_rows, n_cols), np.nan)
-
-        # Loop over the days of the year
-        for i in range(len(day_of_year)):
-            # Print every 10 days
-            if day_of_year[i] % 10 == 0:
-                logger.debug(f"Computing radiation for day {day_of_year[i]}")
-
-            # List of hour angles throughout the day.
-            ha_list = np.arange(
-                -ha_limit[i], ha_limit[i] + time_interval, time_interval
-            )
-
-            # Compute the zenith and azimuth
-            zenith = self.get_solar_zenith(ha_list, lat_rad, solar_declin[i])
-            azimuth = self.get_solar_azimuth_to_south(ha_list, lat_rad, solar_declin[i])
-
-            # Potential radiation over the time intervals
-            inter_pot_radiation = np.full((len(ha_list), n_rows, n_cols), np.nan)
-            for j in range(len(zenith)):
-                # Shorten computation time, because if zenith >= 90 : no irradiation.
-                if zenith[j] >= 90:
-                    inter_pot_radiation[j, :, :] = np.zeros_like(zenith[j])
-                    continue
-
-                incidence_angle = self._calculate_angle_of_incidence(
-                    zenith[j], slope, azimuth[j], aspect
-                )
-                potential_radiation = self._calculate_radiation_hock_equation(
-                    mean_elevation,
-                    atmos_transmissivity,
-                    day_of_year[i],
-                    zenith[j],
-                    incidence_angle,
-                )
 
-                # Account for cast shadows
-                if with_cast_shadows:
-                    cast_shadows = self.calculate_cast_shadows(
-                        dem, masked_dem_data, zenith[j], azimuth[j], xv, yv
-                    )
-                    potential_radiation = potential_radiation * (1 - cast_shadows)
-
-                inter_pot_radiation[j, :, :] = potential_radiation.copy()
-                del potential_radiation
-                if with_cast_shadows:
-                    del cast_shadows
-
-            with warnings.catch_warnings():
-                # This function throws a warning for the first slides of nanmean,
-                # it is normal and due to the NaN bands at the sides of the
-                # slope rasters, etc.
-                warnings.filterwarnings(action="ignore", message="Mean of empty slice")
-                daily_radiation[i, :, :] = np.nansum(inter_pot_radiation, axis=0)
-                daily_radiation[i, :, :] /= 24 * steps_per_hour
+        # Compute the daily potential radiation (the whole topography is needed
+        # for the cast shadows, the mask is applied afterwards).
+        logger.debug("Computing the daily potential radiation.")
+        daily_radiation = compute_daily_potential_radiation(
+            np.asarray(dem.read(1), dtype=float),
+            np.asarray(slope, dtype=float),
+            np.asarray(aspect, dtype=float),
+            pixel_size=(abs(dem.res[0]) + abs(dem.res[1])) / 2,
+            latitude=float(mean_lat),
+            elevation=float(mean_elevation),
+            atmos_transmissivity=atmos_transmissivity,
+            steps_per_hour=steps_per_hour,
+            with_cast_shadows=with_cast_shadows,
+            azimuth_sectors=azimuth_sectors,
+        ).reshape((len(day_of_year), n_rows, n_cols))
+
+        if with_cast_shadows:
+            daily_radiation[:, np.isnan(masked_dem_data)] = 0
 
         # Mean annual potential radiation
         mean_annual_radiation = np.full((n_rows, n_cols), np.nan)
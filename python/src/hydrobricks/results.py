@@ -1,6 +1,7 @@
 from __future__ import annotations
 
 import numpy as np
+import pandas as pd
 
 from hydrobricks._exceptions import DependencyError
 from hydrobricks._optional import HAS_XARRAY, xr
@@ -37,6 +38,7 @@ class Results:
                 install_command="pip install xarray",
             )
         self.results: xr.Dataset = xr.open_dataset(filename)
+        self._decode_hydro_units_time()
         self.labels_distributed: str | list[str] | None = self.results.attrs.get(
             "labels_distributed"
         )
@@ -48,6 +50,23 @@ class Results:
         )
         self.hydro_units_ids: np.ndarray = self.results.hydro_units_ids.to_numpy()
 
+    def _decode_hydro_units_time(self) -> None:
+        """Make sure the ``hydro_units_time`` coordinate holds datetimes.
+
+        When the hydro unit values are aggregated over recording periods, they are
+        written along a ``hydro_units_time`` dimension holding the start of each
+        period as MJD values. They are decoded here if xarray did not already.
+        """
+        if "hydro_units_time" not in self.results.variables:
+            return
+        hydro_units_time = self.results.hydro_units_time
+        if np.issubdtype(hydro_units_time.dtype, np.datetime64):
+            return
+        dates = pd.to_datetime(
+            hydro_units_time.to_numpy(), unit="D", origin=pd.Timestamp("1858-11-17")
+        )
+        self.results = self.results.assign_coords(hydro_units_time=dates)
+
     def close(self) -> None:
         """Close the netCDF dataset and release the file handle."""
         if hasattr(self, "results") and self.results is not None:
@@ -387,12 +406,26 @@ class Results:
 
         No slicing for ``start_date=None``; a single-date snapshot when only
         ``start_date`` is given; a closed ``[start_date, end_date]`` range otherwise.
+
+        The hydro unit values aggregated over recording periods are along the
+        ``hydro_units_time`` dimension (start of each period): a date then selects
+        the period that contains it.
         """
         if start_date is None:
             return data.to_numpy()
+        if "hydro_units_time" not in data.dims:
+            if end_date is None:
+                return data.sel(time=start_date).to_numpy()
+            return data.sel(time=slice(start_date, end_date)).to_numpy()
+
+        periods = data.indexes["hydro_units_time"]
+        i_start = periods.get_indexer([pd.Timestamp(start_date)], method="ffill")[0]
         if end_date is None:
-            return data.sel(time=start_date).to_numpy()
-        return data.sel(time=slice(start_date, end_date)).to_numpy()
+            if i_start < 0:
+                raise KeyError(f"The date {start_date} precedes the recorded periods.")
+            return data.isel(hydro_units_time=i_start).to_numpy()
+        start = periods[max(i_start, 0)]
+        return data.sel(hydro_units_time=slice(start, end_date)).to_numpy()
 
     def _has_distributed_component(self, component: str) -> bool:
         """Whether a distributed component label exists (exact or suffix match)."""
@@ -0,0 +1,111 @@
+import datetime
+import os.path
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+import hydrobricks as hb
+import hydrobricks.models as models
+from hydrobricks._exceptions import ConfigurationError, ModelError
+
+TEST_FILES_DIR = Path(
+    os.path.dirname(os.path.realpath(__file__)),
+    "..",
+    "..",
+    "tests",
+    "files",
+    "catchments",
+)
+SITTER_HUS = TEST_FILES_DIR / "ch_sitter_appenzell" / "hydro_units_elevation.csv"
+
+
+def _setup_sub_basin(tmp_path, name):
+    """Set up (without running) a small SOCONT sub-basin on synthetic forcing."""
+    hydro_units = hb.HydroUnits()
+    hydro_units.load_from_csv(
+        SITTER_HUS, column_elevation="elevation", column_area="area"
+    )
+
+    meteo = tmp_path / f"meteo_{name}.csv"
+    lines = ["date,precip(mm/day),temp(C),pet(mm/day)"]
+    start = datetime.date(2020, 1, 1)
+    for i in range(60):
+        d = start + datetime.timedelta(days=i)
+        precip = 10.0 if i % 7 == 0 else 0.0
+        lines.append(f"{d.strftime('%d/%m/%Y')},{precip},5.0,1.0")
+    meteo.write_text("\n".join(lines) + "\n")
+
+    forcing = hb.Forcing(hydro_units)
+    forcing.load_station_data_from_csv(
+        meteo,
+        column_time="date",
+        time_format="%d/%m/%Y",
+        content={
+            "precipitation": "precip(mm/day)",
+            "temperature": "temp(C)",
+            "pet": "pet(mm/day)",
+        },
+    )
+    forcing.spatialize_from_station_data(
+        variable="temperature", ref_elevation=1250, gradient=-0.6
+    )
+    forcing.spatialize_from_station_data(variable="pet")
+    forcing.spatialize_from_station_data(
+        variable="precipitation", ref_elevation=1250, gradient=0.0
+    )
+
+    socont = models.Socont(surface_runoff="linear_storage")
+    parameters = socont.generate_parameters()
+    parameters.set_values({"a_snow": 3, "A": 200, "k_slow_1": 0.01, "k_quick": 0.05})
+
+    out = tmp_path / name
+    out.mkdir()
+    socont.setup(
+        spatial_structure=hydro_units,
+        output_path=str(out),
+        start_date="2020-01-01",
+        end_date="2020-02-29",
+    )
+    return socont, parameters, forcing
+
+
+def test_two_sub_basin_network_adds_the_upstream_discharge(tmp_path):
+    upstream, up_parameters, up_forcing = _setup_sub_basin(tmp_path, "upstream")
+    downstream, down_parameters, down_forcing = _setup_sub_basin(
+        tmp_path, "downstream"
+    )
+
+    network = hb.BasinNetwork()
+    up = network.add_sub_basin(upstream)
+    down = network.add_sub_basin(downstream)
+    network.connect(up, down)
+    network.run([up_parameters, down_parameters], [up_forcing, down_forcing], 2)
+
+    # Both sub-basins are identical, so the downstream outlet is twice the upstream
+    # one and its inflow total is the upstream outlet total (same areas).
+    up_discharge = network.get_outlet_discharge(up)
+    down_discharge = network.get_outlet_discharge(down)
+    assert up_discharge.sum() > 0
+    np.testing.assert_allclose(down_discharge, 2 * up_discharge, rtol=1e-10)
+    assert upstream.get_total_inflow() == 0
+    assert downstream.get_total_inflow() == pytest.approx(
+        upstream.get_total_outlet_discharge()
+    )
+
+
+def test_network_run_requires_one_parameter_set_per_sub_basin(tmp_path):
+    upstream, parameters, forcing = _setup_sub_basin(tmp_path, "upstream")
+    network = hb.BasinNetwork()
+    network.add_sub_basin(upstream)
+
+    with pytest.raises(ConfigurationError):
+        network.run([parameters, parameters], [forcing])
+
+
+def test_prepare_run_requires_setup():
+    socont = models.Socont(surface_runoff="linear_storage")
+    parameters = socont.generate_parameters()
+
+    with pytest.raises(ModelError):
+        socont.prepare_run(parameters)
@@ -9,6 +9,7 @@ import pytest
 
 import hydrobricks as hb
 import hydrobricks.models as models
+from hydrobricks.evaluation.base import AuxiliaryObservation
 
 TEST_FILES_DIR = Path(
     os.path.dirname(os.path.realpath(__file__)),
@@ -373,6 +374,7 @@ def test_socont_with_1_soil_storage_closes_water_balance():
     balance = discharge_total + et_total + storage_change + snow_change - precip_total
 
     assert balance == pytest.approx(0, abs=1e-8)
+    assert socont.get_total_precipitation() == pytest.approx(precip_total)
 
     try:
         tmp_dir.cleanup()
@@ -623,12 +625,15 @@ def test_snow_redistribution_frey_closes_water_balance(kind):
 # ---------------------------------------------------------------------------
 # Periods and spin-up
 # ---------------------------------------------------------------------------
-def _build_simple_socont_run(tmp_path, subdir, **setup_kwargs):
+def _build_simple_socont_run(
+    tmp_path, subdir, record_all=False, log_period=None, **setup_kwargs
+):
     """Build, set up and run a small SOCONT on synthetic constant forcing.
 
     The synthetic meteo spans 2020-01-01..2020-04-29 (120 days); the model period
     comes from ``setup_kwargs`` and may be shorter (the forcing may exceed the
-    modelling period).
+    modelling period). The hydro unit values are recorded over ``log_period`` if
+    given.
     """
     hydro_units = hb.HydroUnits()
     hydro_units.load_from_csv(
@@ -662,7 +667,9 @@ def _build_simple_socont_run(tmp_path, subdir, **setup_kwargs):
         variable="precipitation", ref_elevation=1250, gradient=0.0
     )
 
-    socont = models.Socont(surface_runoff="linear_storage")
+    socont = models.Socont(surface_runoff="linear_storage", record_all=record_all)
+    if log_period is not None:
+        socont.settings.set_hydro_unit_log_period(log_period)
     parameters = socont.generate_parameters()
     parameters.set_values({"a_snow": 3, "A": 200, "k_slow_1": 0.01, "k_quick": 0.05})
 
@@ -687,6 +694,50 @@ def test_setup_with_period_object(tmp_path):
     assert len(socont.get_outlet_discharge()) == period.n_days
 
 
+def test_monthly_hydro_unit_values_are_read_from_the_results(tmp_path):
+    """With a monthly recording period, the results file holds one record per
+    month along the decoded 'hydro_units_time' axis, and the dates select the
+    month that contains them."""
+    kwargs = dict(start_date="2020-01-01", end_date="2020-04-29", record_all=True)
+    daily = _build_simple_socont_run(tmp_path, "daily", **kwargs)
+    monthly = _build_simple_socont_run(
+        tmp_path, "monthly", log_period="month", **kwargs
+    )
+
+    assert not monthly.is_recorded_daily()
+    time = monthly.get_recorded_hydro_unit_time()
+    assert list(time) == list(pd.date_range("2020-01-01", periods=4, freq="MS"))
+    assert len(monthly.get_recorded_time()) == 120
+
+    daily_results = daily.get_results()
+    results = monthly.get_results()
+    assert np.issubdtype(results.results.hydro_units_time.dtype, np.datetime64)
+    assert list(results.results.hydro_units_time.to_numpy()) == list(time)
+
+    # The outputs are summed over each month; the contents keep their last value.
+    output = next(x for x in results.labels_distributed if x.endswith(":output"))
+    content = next(x for x in results.labels_distributed if x.endswith("_content"))
+    feb = results.get_hydro_units_values(output, "2020-02-15")
+    feb_daily = daily_results.get_hydro_units_values(output, "2020-02-01", "2020-02-29")
+    np.testing.assert_allclose(feb, feb_daily.sum(axis=1))
+    np.testing.assert_allclose(
+        results.get_hydro_units_values(content, "2020-03-20"),
+        daily_results.get_hydro_units_values(content, "2020-03-31"),
+    )
+
+    # A range selects the months it overlaps.
+    values = results.get_hydro_units_values(output, "2020-01-15", "2020-03-10")
+    assert values.shape == (len(results.hydro_units_ids), 3)
+    cover = results.labels_land_cover[0]
+    areas = results.get_land_cover_areas(cover, "2020-01-15", "2020-03-10")
+    assert areas.shape == values.shape
+
+    # The evaluation helpers need the daily series.
+    with pytest.raises(hb.ConfigurationError):
+        AuxiliaryObservation.check_daily_recording(monthly)
+    AuxiliaryObservation.check_daily_recording(daily)
+
+
 def test_setup_period_and_dates_are_exclusive(tmp_path):
     hydro_units = hb.HydroUnits()
     hydro_units.load_from_csv(